@@ -29,6 +29,7 @@
 
 // base
 #include "base/cli-args.hpp"
+#include "base/conv.hpp"
 #include "base/error.hpp"
 #include "base/logger.hpp"
 #include "base/scope-exit.hpp"
@@ -47,7 +48,30 @@ wait<> test_lua_ui( IEngine& engine, Planes& planes ) {
   return rn::lua_ui_test( engine, planes );
 }
 
-void run( e_mode mode ) {
+// The modes that go straight into a game without the main menu.
+maybe<StartMode> start_mode_for( e_mode const mode,
+                                 ProgramArguments& args ) {
+  auto const arg = [&]( string const& key ) -> string const& {
+    CHECK( args.key_val_args.contains( key ),
+           "mode `{}' requires the `{}' argument.", mode, key );
+    return args.key_val_args[key];
+  };
+  auto const int_arg = [&]( string const& key ) {
+    UNWRAP_CHECK_MSG( n, base::stoi( arg( key ) ),
+                      "argument `{}' must be an integer.", key );
+    return n;
+  };
+  if( mode == e_mode::record_replay )
+    return StartMode::record_replay{
+      .slot      = int_arg( "slot" ),
+      .num_turns = int_arg( "turns" ),
+      .file      = arg( "replay" ) };
+  if( mode == e_mode::replay )
+    return StartMode::replay{ .file = arg( "replay" ) };
+  return nothing;
+}
+
+void run( e_mode mode, maybe<StartMode> const& start_mode ) {
   Planes planes;
   Engine engine;
   auto const cleanup_engine_on_abort = [&] {
@@ -125,6 +149,16 @@ void run( e_mode mode ) {
                   rn::test_lua_ui( engine, planes ) );
       break;
     }
+    case e_mode::record_replay:
+    case e_mode::replay: {
+      CHECK( start_mode.has_value() );
+      engine.init( e_engine_mode::game );
+      print_bar( '-', "[ Starting Replay ]" );
+      frame_loop( engine, planes,
+                  revolution_now( engine, planes, start_mode ) );
+      print_bar( '-', "[ Shutting Down ]" );
+      break;
+    }
   }
 }
 
@@ -147,10 +181,13 @@ int main( int argc, char** argv ) {
     mode = m;
   }
 
+  maybe<StartMode> const start_mode =
+      start_mode_for( mode, args );
+
   linker_dont_discard_me();
   while( true ) {
     try {
-      run( mode );
+      run( mode, start_mode );
       break;
     } catch( exception_restart const& e ) {
       lg.info( "restarting game: {}", e.what() );
@@ -118,11 +118,15 @@ Agents create_agents( IEngine& engine, SS& ss,
   return Agents( std::move( holder ) );
 }
 
+unique_ptr<INativeAgent> create_native_agent(
+    SS& ss, IRand& rand, e_tribe const tribe ) {
+  return make_unique<AiNativeAgent>( ss, rand, tribe );
+}
+
 NativeAgents create_native_agents( SS& ss, IRand& rand ) {
   unordered_map<e_tribe, unique_ptr<INativeAgent>> holder;
   for( e_tribe const tribe : refl::enum_values<e_tribe> )
-    holder[tribe] =
-        make_unique<AiNativeAgent>( ss, rand, tribe );
+    holder[tribe] = create_native_agent( ss, rand, tribe );
   return NativeAgents( std::move( holder ) );
 }
 
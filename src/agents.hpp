@@ -100,6 +100,9 @@ Agents create_agents( IEngine& engine, SS& ss,
                       IMapUpdater& map_updater, Planes& planes,
                       IGui& gui, IRand& rand );
 
+std::unique_ptr<INativeAgent> create_native_agent(
+    SS& ss, IRand& rand, e_tribe tribe );
+
 NativeAgents create_native_agents( SS& ss, IRand& rand );
 
 } // namespace rn
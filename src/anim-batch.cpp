@@ -0,0 +1,110 @@
+/****************************************************************
+**anim-batch.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Concurrent animation of independent unit moves.
+*
+*****************************************************************/
+#include "anim-batch.hpp"
+
+// Revolution Now
+#include "anim-builders.hpp"
+#include "co-wait.hpp"
+#include "land-view.hpp"
+
+// C++ standard library
+#include <algorithm>
+
+using namespace std;
+
+namespace rn {
+
+namespace {
+
+using ::gfx::point;
+
+} // namespace
+
+/****************************************************************
+** AnimationBatch
+*****************************************************************/
+AnimationBatch::AnimationBatch( ILandViewPlane& land_view )
+  : land_view_( land_view ) {}
+
+void AnimationBatch::queue_move( GenericUnitId const unit_id,
+                                 point const src,
+                                 e_direction const direction ) {
+  point const dst     = src.moved( direction );
+  Move* prev_for_unit = nullptr;
+  if( auto const it = last_for_unit_.find( unit_id );
+      it != last_for_unit_.end() )
+    prev_for_unit = it->second;
+  vector<Move*> others;
+  for( point const tile : { src, dst } ) {
+    auto const it = last_for_tile_.find( tile );
+    if( it == last_for_tile_.end() ) continue;
+    Move* const other = it->second;
+    if( other == prev_for_unit ) continue;
+    if( other->done.try_wait() ) continue;
+    if( ranges::find( others, other ) != others.end() ) continue;
+    others.push_back( other );
+  }
+  Move& move = *moves_.emplace_back( make_unique<Move>() );
+  last_for_tile_[src]     = &move;
+  last_for_tile_[dst]     = &move;
+  last_for_unit_[unit_id] = &move;
+  move.running =
+      animate_move( move, unit_id, src, direction, prev_for_unit,
+                    std::move( others ) );
+}
+
+wait<> AnimationBatch::animate_move( Move& move,
+                                     GenericUnitId const unit_id,
+                                     point const src,
+                                     e_direction const direction,
+                                     Move* const prev_for_unit,
+                                     vector<Move*> others ) {
+  // Until the unit's previous move is done it will either be
+  // hiding or sliding the unit, so nothing to do until then.
+  if( prev_for_unit != nullptr )
+    co_await prev_for_unit->done.Wait();
+  erase_if( others, []( Move const* const other ) {
+    return other->done.try_wait();
+  } );
+  if( !others.empty() ) {
+    // The unit is already sitting on the tile that it moved to,
+    // so keep it hidden until it is its turn to slide there.
+    AnimationSequence const hide_seq =
+        anim_seq_unit_hidden( unit_id );
+    wait<> const hider =
+        land_view_.animate_if_visible_and_hold( hide_seq );
+    for( Move* const other : others )
+      co_await other->done.Wait();
+  }
+  AnimationSequence const seq =
+      anim_seq_for_moved_unit( unit_id, src, direction );
+  co_await land_view_.animate_if_visible( seq );
+  move.done.count_down();
+}
+
+wait<> AnimationBatch::finish_unit(
+    GenericUnitId const unit_id ) {
+  auto const it = last_for_unit_.find( unit_id );
+  if( it == last_for_unit_.end() ) co_return;
+  co_await it->second->done.Wait();
+}
+
+wait<> AnimationBatch::finish() {
+  // Awaiting the moves themselves (as opposed to their latches)
+  // will propagate any errors.
+  for( unique_ptr<Move> const& move : moves_ )
+    co_await std::move( move->running );
+  last_for_unit_.clear();
+  last_for_tile_.clear();
+  moves_.clear();
+}
+
+} // namespace rn
@@ -0,0 +1,93 @@
+/****************************************************************
+**anim-batch.hpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Concurrent animation of independent unit moves.
+*
+*****************************************************************/
+#pragma once
+
+// Revolution Now
+#include "latch.hpp"
+#include "wait.hpp"
+
+// ss
+#include "ss/unit-id.hpp"
+
+// gfx
+#include "gfx/cartesian.hpp"
+
+// C++ standard library
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace rn {
+
+/****************************************************************
+** Fwd. Decls.
+*****************************************************************/
+struct ILandViewPlane;
+
+/****************************************************************
+** AnimationBatch
+*****************************************************************/
+// This allows the game logic to move units without waiting for
+// the moves to be animated, which is useful for AI turns where
+// there could be many units moving. The units are moved in the
+// game state right away and the animations of their moves are
+// queued here. The animations of moves that don't touch any of
+// the same tiles will then run concurrently, while those that do
+// will run in the order that they were queued. A unit whose move
+// is waiting to be animated will be hidden until then, since it
+// is already sitting on the tile that it moved to.
+//
+// Since the animations trail behind the game state, the game
+// logic must finish the batch before doing anything that needs
+// to be animated in the normal way or that could remove a unit
+// whose move has not yet been animated.
+struct AnimationBatch {
+  explicit AnimationBatch( ILandViewPlane& land_view );
+
+  // The unit must already have been moved in the game state from
+  // the source tile to the adjacent tile in the given direction.
+  // This does not wait for anything.
+  void queue_move( GenericUnitId unit_id, gfx::point src,
+                   e_direction direction );
+
+  // Waits until all of the queued moves of the unit have been
+  // animated.
+  wait<> finish_unit( GenericUnitId unit_id );
+
+  // Waits until all of the queued moves have been animated.
+  wait<> finish();
+
+ private:
+  struct Move {
+    co::latch done;
+    wait<> running;
+  };
+
+  wait<> animate_move( Move& move, GenericUnitId unit_id,
+                       gfx::point src, e_direction direction,
+                       Move* prev_for_unit,
+                       std::vector<Move*> others );
+
+  ILandViewPlane& land_view_;
+
+  // These are only removed when the batch is finished since
+  // moves that are queued later may need to wait on them.
+  std::vector<std::unique_ptr<Move>> moves_;
+
+  // The last move queued that touched each tile. A new move only
+  // needs to wait on these, since they in turn will have waited
+  // on any earlier moves that touched the same tiles.
+  std::unordered_map<gfx::point, Move*> last_for_tile_;
+
+  std::unordered_map<GenericUnitId, Move*> last_for_unit_;
+};
+
+} // namespace rn
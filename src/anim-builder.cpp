@@ -96,9 +96,11 @@ AnimationAction& AnimationBuilder::translocate_unit(
 }
 
 AnimationAction& AnimationBuilder::slide_unit(
-    GenericUnitId unit_id, e_direction direction ) {
+    GenericUnitId unit_id, e_direction direction,
+    maybe<point> const from ) {
   return push( P::slide_unit{ .unit_id   = unit_id,
-                              .direction = direction } );
+                              .direction = direction,
+                              .from      = from } );
 }
 
 AnimationAction& AnimationBuilder::talk_unit(
@@ -367,7 +369,14 @@ AnimationContents animated_contents(
           // exist here if a unit is sliding off of the map
           // (which can happen when sailing the high seas). But
           // either way, the subsequent should remove those.
-          add( slide_unit.unit_id, slide_unit.direction );
+          if( !slide_unit.from.has_value() ) {
+            add( slide_unit.unit_id, slide_unit.direction );
+            break;
+          }
+          point const src = *slide_unit.from;
+          add( src, slide_unit.unit_id );
+          add( src.moved( slide_unit.direction ),
+               slide_unit.unit_id );
           break;
         }
         CASE( talk_unit ) {
@@ -52,8 +52,10 @@ struct AnimationBuilder {
   AnimationAction& translocate_unit( GenericUnitId unit_id,
                                      e_direction direction );
 
-  AnimationAction& slide_unit( GenericUnitId unit_id,
-                               e_direction direction );
+  // See the primitive for the meaning of `from`.
+  AnimationAction& slide_unit(
+      GenericUnitId unit_id, e_direction direction,
+      maybe<gfx::point> from = nothing );
 
   AnimationAction& talk_unit( GenericUnitId unit_id,
                               e_direction direction );
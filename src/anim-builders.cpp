@@ -707,6 +707,15 @@ AnimationSequence anim_seq_for_unit_move(
   return builder.result();
 }
 
+AnimationSequence anim_seq_for_moved_unit(
+    GenericUnitId const unit_id, point const src,
+    e_direction const direction ) {
+  AnimationBuilder builder;
+  builder.slide_unit( unit_id, direction, src );
+  builder.play_sound( e_sfx::move );
+  return builder.result();
+}
+
 AnimationSequence anim_seq_for_unit_talk(
     SSConst const& ss, GenericUnitId unit_id,
     e_direction direction ) {
@@ -884,6 +893,13 @@ AnimationSequence anim_seq_unit_to_front(
   return builder.result();
 }
 
+AnimationSequence anim_seq_unit_hidden(
+    GenericUnitId const unit_id ) {
+  AnimationBuilder builder;
+  builder.hide_unit( unit_id );
+  return builder.result();
+}
+
 AnimationSequence anim_seq_for_cheat_kill_natives(
     SSConst const& ss, IVisibility const& viz,
     set<e_tribe> const& tribes ) {
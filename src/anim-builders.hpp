@@ -25,6 +25,7 @@
 #include "ss/unit-type.rds.hpp"
 
 // gfx
+#include "gfx/cartesian.hpp"
 #include "gfx/cartesian.rds.hpp"
 
 // C++ standard library
@@ -93,6 +94,14 @@ AnimationSequence anim_seq_for_unit_move(
     SSConst const& ss, GenericUnitId unit_id,
     e_direction direction );
 
+// Same as above but for a unit that has already been moved from
+// the source tile in the game state. This does not pan the view-
+// port since it is meant for moves that are animated concur-
+// rently with others.
+AnimationSequence anim_seq_for_moved_unit(
+    GenericUnitId unit_id, gfx::point src,
+    e_direction direction );
+
 // Slides the unit in the given direction but also keeps a sprite
 // of the unit stationary on the starting square, as the OG does
 // when a brave wants to interact with a european unit or colony
@@ -150,6 +159,10 @@ AnimationSequence anim_seq_for_convert_produced(
 AnimationSequence anim_seq_unit_to_front(
     GenericUnitId unit_id );
 
+// Keeps the unit from being rendered. This never ends on its own
+// and so it should be run with the "hold" option.
+AnimationSequence anim_seq_unit_hidden( GenericUnitId unit_id );
+
 // Depixelates an entire tribe; only used in cheat mode when
 // deleting a tribe. The tribe must exist.
 AnimationSequence anim_seq_for_cheat_kill_natives(
@@ -14,6 +14,7 @@
 #include "co-wait.hpp"
 #include "console.hpp"
 #include "frame-count.hpp"
+#include "game.hpp"
 #include "gui.hpp"
 #include "iengine.hpp"
 #include "lua.hpp"
@@ -64,7 +65,8 @@ wait<> force_resolution( IEngine& engine,
 /****************************************************************
 ** Coroutine entry point.
 *****************************************************************/
-wait<> revolution_now( IEngine& engine, Planes& planes ) {
+wait<> revolution_now( IEngine& engine, Planes& planes,
+                       maybe<StartMode> const& start_mode ) {
   auto const& resolution_override =
       config_gfx.logical_resolution.force_if_available;
   if( resolution_override.has_value() )
@@ -94,6 +96,12 @@ wait<> revolution_now( IEngine& engine, Planes& planes ) {
 
   RealGui gui( planes, engine.textometer() );
 
+  if( start_mode.has_value() ) {
+    co_await run_game_with_mode( engine, planes, gui,
+                                 *start_mode );
+    co_return;
+  }
+
   co_await run_main_menu( engine, planes, gui );
 }
 
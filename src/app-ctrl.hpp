@@ -12,7 +12,11 @@
 
 #include "core-config.hpp"
 
+// rds
+#include "game.rds.hpp"
+
 // Revolution Now
+#include "maybe.hpp"
 #include "wait.hpp"
 
 namespace rn {
@@ -24,6 +28,11 @@ struct Planes;
 // into all of the other coroutines. Overall, one can think of
 // this game as an event loop that spins, taking user input,
 // until this top-level coroutine is finished.
-wait<> revolution_now( IEngine& engine, Planes& planes );
+//
+// If a start mode is given then the main menu is skipped and the
+// program ends when that game ends.
+wait<> revolution_now(
+    IEngine& engine, Planes& planes,
+    maybe<StartMode> const& start_mode = nothing );
 
 } // namespace rn
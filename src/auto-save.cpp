@@ -25,6 +25,7 @@
 #include "base/to-str-ext-std.hpp"
 
 // C++ standard library
+#include <chrono>
 #include <ranges>
 
 using namespace std;
@@ -123,4 +124,40 @@ expect<std::vector<fs::path>> autosave(
   return res;
 }
 
+/****************************************************************
+** AutosaveWorker
+*****************************************************************/
+AutosaveWorker::~AutosaveWorker() {
+  // The result is dropped here; there is nowhere left to report
+  // it, but the store method will have logged the attempt.
+  (void)wait();
+}
+
+maybe<AutosaveWorker::result_t> AutosaveWorker::start(
+    job_t job ) {
+  CHECK( job );
+  maybe<result_t> prev = wait();
+  pending_ = std::async( std::launch::async, std::move( job ) );
+  return prev;
+}
+
+maybe<AutosaveWorker::result_t> AutosaveWorker::poll() {
+  if( !pending_.valid() ) return nothing;
+  if( pending_.wait_for( chrono::seconds{ 0 } ) !=
+      future_status::ready )
+    return nothing;
+  return pending_.get();
+}
+
+maybe<AutosaveWorker::result_t> AutosaveWorker::wait() {
+  if( !pending_.valid() ) return nothing;
+  return pending_.get();
+}
+
+bool AutosaveWorker::running() const {
+  return pending_.valid() &&
+         pending_.wait_for( chrono::seconds{ 0 } ) !=
+             future_status::ready;
+}
+
 } // namespace rn
@@ -12,11 +12,14 @@
 
 // Revolution Now
 #include "expect.hpp"
+#include "maybe.hpp"
 
 // base
 #include "base/fs.hpp"
 
 // C++ standard library
+#include <functional>
+#include <future>
 #include <set>
 
 namespace rn {
@@ -34,4 +37,44 @@ struct SSConst;
     SSConst const& ss, IGameWriter const& game_writer,
     Autosave& autosave, std::set<int> autosave_slots );
 
+/****************************************************************
+** AutosaveWorker
+*****************************************************************/
+// Runs autosave jobs on a background thread so that serializing
+// and writing the game does not stall the turn. The caller is
+// expected to give the job its own snapshot of the game state.
+// Only one job runs at a time; starting a new one first waits
+// for the previous one. Results are handed back to the caller
+// (on the main thread) so that errors can be logged there.
+struct AutosaveWorker {
+  using result_t = expect<std::vector<fs::path>>;
+  using job_t    = std::function<result_t()>;
+
+  AutosaveWorker() = default;
+
+  // Waits for any job that is still running.
+  ~AutosaveWorker();
+
+  AutosaveWorker( AutosaveWorker const& )            = delete;
+  AutosaveWorker& operator=( AutosaveWorker const& ) = delete;
+
+  // Waits for the previous job, if any, then starts this one.
+  // Returns the result of the previous job if it has not yet
+  // been collected.
+  [[nodiscard]] maybe<result_t> start( job_t job );
+
+  // Returns the result of the last job if it has finished and
+  // has not yet been collected. Does not block.
+  [[nodiscard]] maybe<result_t> poll();
+
+  // Blocks until the last job finishes and returns its result if
+  // it has not yet been collected.
+  [[nodiscard]] maybe<result_t> wait();
+
+  bool running() const;
+
+ private:
+  std::future<result_t> pending_;
+};
+
 } // namespace rn
@@ -10,6 +10,9 @@
 *****************************************************************/
 #include "binary-data.hpp"
 
+// base
+#include "scope-exit.hpp"
+
 // C++ standard library
 #include <cstring>
 
@@ -120,4 +123,60 @@ bool MemBufferBinaryIO::write_bytes(
   return true;
 }
 
+/****************************************************************
+** BufferBinaryIO
+*****************************************************************/
+expect<BufferBinaryIO, string> BufferBinaryIO::read_file(
+    std::string const& path ) {
+  FILE* const fp = std::fopen( path.c_str(), "rb" );
+  if( fp == nullptr )
+    return fmt::format(
+        "failed to open file \"{}\" for reading.", path );
+  SCOPE_EXIT { std::fclose( fp ); };
+  std::fseek( fp, 0, SEEK_END );
+  long const file_size = std::ftell( fp );
+  std::fseek( fp, 0, SEEK_SET );
+  if( file_size < 0 )
+    return fmt::format( "failed to get size of file \"{}\".",
+                        path );
+  vector<unsigned char> buffer( file_size );
+  size_t const read =
+      std::fread( buffer.data(), 1, buffer.size(), fp );
+  if( read != buffer.size() )
+    return fmt::format( "failed to read file \"{}\".", path );
+  return BufferBinaryIO( std::move( buffer ) );
+}
+
+valid_or<string> BufferBinaryIO::write_file(
+    std::string const& path ) const {
+  FILE* const fp = std::fopen( path.c_str(), "wb" );
+  if( fp == nullptr )
+    return fmt::format(
+        "failed to open file \"{}\" for writing.", path );
+  SCOPE_EXIT { std::fclose( fp ); };
+  size_t const written =
+      std::fwrite( buffer_.data(), 1, buffer_.size(), fp );
+  if( written != buffer_.size() )
+    return fmt::format( "failed to write file \"{}\".", path );
+  return valid;
+}
+
+bool BufferBinaryIO::read_bytes( int const n,
+                                 unsigned char* const dst ) {
+  if( n == 0 ) return true;
+  if( remaining() < n ) return false;
+  std::memcpy( dst, buffer_.data() + idx_, n );
+  idx_ += n;
+  return true;
+}
+
+bool BufferBinaryIO::write_bytes(
+    int const n, unsigned char const* const src ) {
+  if( n == 0 ) return true;
+  if( remaining() < n ) buffer_.resize( idx_ + n );
+  std::memcpy( buffer_.data() + idx_, src, n );
+  idx_ += n;
+  return true;
+}
+
 } // namespace base
@@ -13,6 +13,7 @@
 // base
 #include "error.hpp"
 #include "expect.hpp"
+#include "valid.hpp"
 #include "zero.hpp"
 
 // C++ standard library.
@@ -20,6 +21,7 @@
 #include <concepts>
 #include <span>
 #include <type_traits>
+#include <vector>
 
 namespace base {
 
@@ -74,6 +76,18 @@ struct IBinaryIO {
                         reinterpret_cast<Byte const*>( &in ) );
   }
 
+  // Reads or writes a run of bytes in one call, which is faster
+  // than doing it one byte at a time.
+  bool read_bytes( std::span<Byte> const dst ) {
+    if( dst.empty() ) return true;
+    return read_bytes( dst.size(), dst.data() );
+  }
+
+  bool write_bytes( std::span<Byte const> const src ) {
+    if( src.empty() ) return true;
+    return write_bytes( src.size(), src.data() );
+  }
+
   // Note that this is not quite the same as std::feof, which
   // will only be set when attempting to go beyond the end. This
   // just tells you whether or not you are at the end, which is
@@ -155,6 +169,52 @@ struct MemBufferBinaryIO : IBinaryIO {
   int idx_ = 0;
 };
 
+/****************************************************************
+** BufferBinaryIO.
+*****************************************************************/
+// Reads or writes to a growable binary buffer that it owns. Both
+// reads and writes can go anywhere in the buffer, and writing
+// past the end will extend it.
+//
+// This is the one to use for reading or writing files that con-
+// sist of many small fields, since it only touches the file once
+// and then all of the field reads/writes are just memory copies,
+// as opposed to FileBinaryIO which goes through the C library
+// for each one.
+struct BufferBinaryIO : IBinaryIO {
+  BufferBinaryIO() = default;
+
+  explicit BufferBinaryIO( std::vector<unsigned char>&& buffer )
+    : buffer_( std::move( buffer ) ) {}
+
+  // Loads the entire contents of the file into the buffer.
+  static expect<BufferBinaryIO, std::string> read_file(
+      std::string const& path );
+
+  // Replaces the contents of the file with the entire buffer
+  // (regardless of the current position).
+  valid_or<std::string> write_file(
+      std::string const& path ) const;
+
+  std::vector<unsigned char> const& buffer() const {
+    return buffer_;
+  }
+
+  using IBinaryIO::read_bytes;
+  using IBinaryIO::write_bytes;
+
+  int pos() const override { return idx_; }
+
+  int size() const override { return buffer_.size(); }
+
+ private:
+  bool read_bytes( int n, unsigned char* dst ) override;
+  bool write_bytes( int n, unsigned char const* src ) override;
+
+  std::vector<unsigned char> buffer_;
+  int idx_ = 0;
+};
+
 /****************************************************************
 ** Concepts.
 *****************************************************************/
@@ -40,4 +40,16 @@ valid_or<string> copy_file_overwriting_destination(
   }
 }
 
+valid_or<string> rename_file_overwriting_destination(
+    fs::path const& from, fs::path const& to ) {
+  error_code ec;
+  fs::rename( from, to, ec );
+  if( ec )
+    return fmt::format(
+        "failed to rename file \"{}\" to \"{}\": code: {}, "
+        "error: {}",
+        from, to, ec.value(), ec.message() );
+  return valid;
+}
+
 } // namespace base
@@ -28,4 +28,11 @@ namespace base {
 valid_or<std::string> copy_file_overwriting_destination(
     fs::path const& from, fs::path const& to );
 
+// Moves `from' onto `to', replacing `to' if it exists. When both
+// are on the same filesystem this is atomic, so readers of `to'
+// will see either the old file or the new one, never a partially
+// written one.
+valid_or<std::string> rename_file_overwriting_destination(
+    fs::path const& from, fs::path const& to );
+
 }
\ No newline at end of file
@@ -16,6 +16,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <string_view>
 #include <type_traits>
 
 namespace base {
@@ -50,6 +51,17 @@ inline constexpr uint64_t hash_64_fnv1a_const(
                                 __prime_64_const );
 }
 
+// Same as above but for runtime data of arbitrary length, which
+// may include null characters.
+inline constexpr uint64_t hash_64_fnv1a(
+    std::string_view const data,
+    uint64_t value = __val_64_const ) noexcept {
+  for( char const c : data )
+    value = ( value ^ uint64_t( uint8_t( c ) ) ) *
+            __prime_64_const;
+  return value;
+}
+
 // This uses a trick, based on an idea here:
 //
 //   https://stackoverflow.com/questions/35941045/
@@ -0,0 +1,68 @@
+/****************************************************************
+**parallel.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Helpers for running independent work in parallel.
+*
+*****************************************************************/
+#include "parallel.hpp"
+
+// C++ standard library
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace base {
+
+int default_parallelism() {
+  return max( int( thread::hardware_concurrency() ), 1 );
+}
+
+void parallel_for( int const n,
+                   function_ref<void( int ) const> const fn,
+                   int const max_threads ) {
+  if( n <= 0 ) return;
+  int const num_threads = clamp( max_threads, 1, n );
+  if( num_threads == 1 ) {
+    for( int i = 0; i < n; ++i ) fn( i );
+    return;
+  }
+
+  atomic<int> next    = 0;
+  atomic<bool> failed = false;
+  mutex mtx;
+  exception_ptr first_error;
+
+  auto const worker = [&] {
+    while( !failed.load( memory_order_relaxed ) ) {
+      int const i = next.fetch_add( 1, memory_order_relaxed );
+      if( i >= n ) break;
+      try {
+        fn( i );
+      } catch( ... ) {
+        lock_guard const lock( mtx );
+        if( !first_error ) first_error = current_exception();
+        failed = true;
+      }
+    }
+  };
+
+  vector<thread> threads;
+  threads.reserve( num_threads - 1 );
+  for( int t = 1; t < num_threads; ++t )
+    threads.emplace_back( worker );
+  worker();
+  for( thread& th : threads ) th.join();
+
+  if( first_error ) rethrow_exception( first_error );
+}
+
+} // namespace base
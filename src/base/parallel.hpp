@@ -0,0 +1,37 @@
+/****************************************************************
+**parallel.hpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Helpers for running independent work in parallel.
+*
+*****************************************************************/
+#pragma once
+
+#include "config.hpp"
+
+// base
+#include "function-ref.hpp"
+
+namespace base {
+
+// Number of threads that the parallel helpers will use when not
+// otherwise specified. Always at least one.
+int default_parallelism();
+
+// Calls fn( i ) once for each i in [0, n), distributing the
+// calls over up to `max_threads` threads, one of which is the
+// calling thread. Indices are handed out dynamically so that un-
+// even work per index still balances. Returns only when all
+// calls have finished. The order in which the calls happen is
+// unspecified, so fn must not depend on it; typically each call
+// writes its result into slot i of a pre-sized vector.
+//
+// If any call throws then the remaining indices are skipped and
+// the first exception is rethrown on the calling thread.
+void parallel_for( int n, function_ref<void( int ) const> fn,
+                   int max_threads = default_parallelism() );
+
+} // namespace base
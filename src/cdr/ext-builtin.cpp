@@ -245,4 +245,16 @@ result<double> from_canonical( converter& conv, value const& v,
       type_name( v ) );
 }
 
+/****************************************************************
+** value
+*****************************************************************/
+value to_canonical( converter&, value const& o, tag_t<value> ) {
+  return o;
+}
+
+result<value> from_canonical( converter&, value const& v,
+                              tag_t<value> ) {
+  return v;
+}
+
 } // namespace cdr
@@ -98,4 +98,14 @@ value to_canonical( converter& conv, double o, tag_t<double> );
 result<double> from_canonical( converter& conv, value const& v,
                                tag_t<double> );
 
+/****************************************************************
+** value
+*****************************************************************/
+// Identity conversion; allows a reflected struct to hold a field
+// whose contents are arbitrary canonical data.
+value to_canonical( converter& conv, value const& o,
+                    tag_t<value> );
+result<value> from_canonical( converter& conv, value const& v,
+                              tag_t<value> );
+
 } // namespace cdr
@@ -244,7 +244,11 @@ value to_canonical( converter& conv,
   // want them to be omitted when they have default values, even
   // when that serialization mode is enabled.
   if( converts_to_string ) {
-    table res;
+    // Gather the entries and let the table sort them all at
+    // once, since the string keys need not be in the same order
+    // as the original keys.
+    std::vector<table::entry_type> entries;
+    entries.reserve( o.size() );
     for( auto const& [k, v] : o ) {
       value key = conv.to( k );
       CHECK( key.holds<std::string>(),
@@ -252,9 +256,10 @@ value to_canonical( converter& conv,
              "consistently, therefore it is not suitable to use "
              "as a type in a map.",
              type_name( key ) );
-      res[std::move( key.as<std::string>() )] = conv.to( v );
+      entries.emplace_back( std::move( key.as<std::string>() ),
+                            conv.to( v ) );
     }
-    return res;
+    return table( std::move( entries ) );
   } else {
     // Since this is an unordered container and we are converting
     // it to a list, we must sort the keys first so that we get a
@@ -317,7 +322,7 @@ unordered_map_from_canonical_table( converter& conv,
   for( auto const& [k, v] : tbl ) {
     UNWRAP_RETURN( key, conv.from<K>( k ) );
     // There should never be a duplicate key even upon invalid
-    // user input because `tbl` is backed by a real map.
+    // user input because table keys are unique.
     CHECK( !res.contains( key ) );
     UNWRAP_RETURN( val,
                    conv.from_field_no_tracking<V>( tbl, k ) );
@@ -412,7 +417,11 @@ value to_canonical( converter& conv, std::map<K, V> const& o,
   // want them to be omitted when they have default values, even
   // when that serialization mode is enabled.
   if( converts_to_string ) {
-    table res;
+    // Gather the entries and let the table sort them all at
+    // once, since the string keys need not be in the same order
+    // as the original keys.
+    std::vector<table::entry_type> entries;
+    entries.reserve( o.size() );
     for( auto const& [k, v] : o ) {
       value key = conv.to( k );
       CHECK( key.holds<std::string>(),
@@ -420,9 +429,10 @@ value to_canonical( converter& conv, std::map<K, V> const& o,
              "consistently, therefore it is not suitable to use "
              "as a type in a map.",
              type_name( key ) );
-      res[std::move( key.as<std::string>() )] = conv.to( v );
+      entries.emplace_back( std::move( key.as<std::string>() ),
+                            conv.to( v ) );
     }
-    return res;
+    return table( std::move( entries ) );
   } else {
     list res; // this is a cdr list.
     res.reserve( o.size() );
@@ -465,7 +475,7 @@ result<std::map<K, V>> map_from_canonical_table(
   for( auto const& [k, v] : tbl ) {
     UNWRAP_RETURN( key, conv.from<K>( k ) );
     // There should never be a duplicate key even upon invalid
-    // user input because `tbl` is backed by a real map.
+    // user input because table keys are unique.
     CHECK( !res.contains( key ) );
     UNWRAP_RETURN( val,
                    conv.from_field_no_tracking<V>( tbl, k ) );
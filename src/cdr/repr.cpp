@@ -11,11 +11,13 @@
 *****************************************************************/
 #include "repr.hpp"
 
-#include <algorithm>
-
 // base
 #include "base/to-str-ext-std.hpp"
 
+// C++ standard library
+#include <algorithm>
+#include <ranges>
+
 using namespace std;
 
 namespace cdr {
@@ -47,16 +49,29 @@ table::table( table&& )      = default;
 table& table::operator=( table const& ) = default;
 table& table::operator=( table&& )      = default;
 
-// This is a template to break the cyclic dependency.
 table::table( map_type<std::string, value> const& m )
-  : o_( m ) {}
+  : o_( m.begin(), m.end() ) {}
+
+table::table( map_type<std::string, value>&& m ) {
+  o_.reserve( m.size() );
+  // The map is already sorted.
+  while( !m.empty() ) {
+    auto node = m.extract( m.begin() );
+    o_.emplace_back( std::move( node.key() ),
+                     std::move( node.mapped() ) );
+  }
+}
 
-// This is a template to break the cyclic dependency.
-table::table( map_type<std::string, value>&& m )
-  : o_( std::move( m ) ) {}
+table::table( vector<entry_type>&& entries )
+  : o_( std::move( entries ) ) {
+  // Stable so that the first of any duplicates is kept.
+  ranges::stable_sort( o_, {}, &entry_type::first );
+  auto const dups = ranges::unique( o_, {}, &entry_type::first );
+  o_.erase( dups.begin(), dups.end() );
+}
 
 table::table( std::initializer_list<value_type> const il )
-  : o_( il.begin(), il.end() ) {}
+  : table( vector<entry_type>( il.begin(), il.end() ) ) {}
 
 size_t table::size() const { return o_.size(); }
 
@@ -64,27 +79,48 @@ long table::ssize() const { return long( o_.size() ); }
 
 bool table::empty() const { return o_.empty(); }
 
-map_type<std::string, value>::const_iterator table::begin()
-    const {
-  return o_.begin();
-}
-map_type<std::string, value>::const_iterator table::end() const {
-  return o_.end();
+void table::reserve( size_t const n ) { o_.reserve( n ); }
+
+table::const_iterator table::begin() const { return o_.begin(); }
+
+table::const_iterator table::end() const { return o_.end(); }
+
+table::iterator table::begin() { return o_.begin(); }
+
+table::iterator table::end() { return o_.end(); }
+
+table::iterator table::lower_bound( string_view const key ) {
+  // Most tables are built in key order (e.g. when parsed from
+  // an emitted document or converted from a std::map), so check
+  // the end first.
+  if( o_.empty() || o_.back().first < key ) return o_.end();
+  return ranges::lower_bound( o_, key, {}, &entry_type::first );
 }
 
-map_type<std::string, value>::iterator table::begin() {
-  return o_.begin();
+table::const_iterator table::lower_bound(
+    string_view const key ) const {
+  return ranges::lower_bound( o_, key, {}, &entry_type::first );
 }
-map_type<std::string, value>::iterator table::end() {
-  return o_.end();
+
+pair<table::iterator, bool> table::emplace_impl( string&& key,
+                                                 value&& v ) {
+  auto it = lower_bound( key );
+  if( it != o_.end() && it->first == key ) return { it, false };
+  it = o_.emplace( it, std::move( key ), std::move( v ) );
+  return { it, true };
 }
 
-value& table::operator[]( string const& key ) { return o_[key]; }
+value& table::operator[]( string const& key ) {
+  auto it = lower_bound( key );
+  if( it == o_.end() || it->first != key )
+    it = o_.emplace( it, key, null );
+  return it->second;
+}
 
 maybe<value const&> table::operator[](
     string const& key ) const {
-  auto it = o_.find( key );
-  if( it == o_.end() ) return nothing;
+  auto it = lower_bound( key );
+  if( it == o_.end() || it->first != key ) return nothing;
   return it->second;
 }
 
@@ -92,27 +128,26 @@ bool table::operator==( table const& rhs ) const {
   return o_ == rhs.o_;
 }
 
-bool table::contains( string const& key ) const {
-  return ( *this )[key].has_value();
+bool table::contains( string_view const key ) const {
+  auto it = lower_bound( key );
+  return it != o_.end() && it->first == key;
+}
+
+void table::insert( value_type const& o ) {
+  emplace( o.first, o.second );
 }
 
-void table::insert( value_type const& o ) { o_.insert( o ); }
 void table::insert( value_type&& o ) {
-  o_.insert( std::move( o ) );
+  // The key can't be moved from since it is const.
+  emplace( o.first, std::move( o.second ) );
 }
 
 void to_str( table const& o, std::string& out,
              base::tag<table> ) {
   out += '{';
   bool remove_comma = false;
-
-  vector<pair<string, value>> pairs( o.begin(), o.end() );
-  std::sort( pairs.begin(), pairs.end(),
-             []( auto const& l, auto const& r ) {
-               return l.first < r.first;
-             } );
-
-  for( auto const& [k, v] : pairs ) {
+  // Already sorted by key.
+  for( auto const& [k, v] : o ) {
     base::to_str( k, out );
     out += '=';
     base::to_str( v, out );
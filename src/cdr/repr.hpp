@@ -19,6 +19,7 @@
 // C++ standard library
 #include <map>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace cdr {
@@ -66,18 +67,8 @@ struct value;
 using integer_type = int64_t;
 using float_type   = double;
 
-// Use std::map instead of std::unordered_map so that we get a
-// stable ordering of map elements, which is useful generally fo
-// getting deterministic results when converting, serializing,
-// and testing these types. Performance-wise, std::map should not
-// be a problem (or at least any worse than std::unordered_map)
-// for this use case, because 1) unordered_map does a heap allo-
-// cation per node just like std::map, and 2) these cdr tables
-// are really meant to be short-lived and to be iterated over (a
-// use case where std::map excels) as opposed to being long-lived
-// and queried many times for specific keys (a use case where
-// unordered_map would excel). Hence, std::map might be more per-
-// formant here than unordered_map, but no profiling was done.
+// This is only used for constructing tables from maps. Tables
+// themselves are stored as sorted vectors; see below.
 template<typename K, typename V>
 using map_type = std::map<K, V>;
 
@@ -96,8 +87,24 @@ inline constexpr null_t null;
 /****************************************************************
 ** table
 *****************************************************************/
+// The key/value pairs are stored in a vector that is kept sorted
+// by key. This gives us the same (deterministic) iteration order
+// as a std::map but only one heap allocation per table instead
+// of one per key, and lookups are binary searches over contigu-
+// ous memory. Tables are built once (and often very many of them
+// when converting large structures) and then iterated or queried
+// a few times, so this is a better fit than a node-based map.
+//
+// NOTE: unlike with a std::map, inserting a new key invalidates
+// references and iterators to other elements of the table.
 struct table {
   using value_type = std::pair<std::string const, value>;
+  // This is what the table actually holds; the keys must not be
+  // modified through the iterators.
+  using entry_type = std::pair<std::string, value>;
+
+  using iterator       = std::vector<entry_type>::iterator;
+  using const_iterator = std::vector<entry_type>::const_iterator;
 
   table();
   ~table();
@@ -110,6 +117,10 @@ struct table {
   table( map_type<std::string, value> const& m );
   table( map_type<std::string, value>&& m );
 
+  // The entries need not be sorted. If there are duplicate keys
+  // then the first one wins, as with inserting into a map.
+  explicit table( std::vector<entry_type>&& entries );
+
   // Beware this one entails copying since elements in initial-
   // izer lists can't be moved from.
   table( std::initializer_list<value_type> il );
@@ -121,16 +132,21 @@ struct table {
   base::maybe<value const&> operator[](
       std::string const& key ) const;
 
+  // Does not overwrite the value if the key already exists.
   template<typename K, typename V>
-  auto emplace( K&& k, V&& v ) {
-    return o_.emplace( std::forward<K>( k ),
-                       std::forward<V>( v ) );
+  std::pair<iterator, bool> emplace( K&& k, V&& v ) {
+    return emplace_impl( std::string( std::forward<K>( k ) ),
+                         value( std::forward<V>( v ) ) );
   }
 
   void insert( value_type const& o );
   void insert( value_type&& o );
 
-  [[nodiscard]] bool contains( std::string const& key ) const;
+  // Only affects the capacity, for when the number of keys is
+  // known ahead of time.
+  void reserve( size_t n );
+
+  [[nodiscard]] bool contains( std::string_view key ) const;
 
   [[nodiscard]] size_t size() const;
   [[nodiscard]] long ssize() const;
@@ -138,17 +154,25 @@ struct table {
 
   [[nodiscard]] bool operator==( table const& rhs ) const;
 
-  map_type<std::string, value>::const_iterator begin() const;
-  map_type<std::string, value>::const_iterator end() const;
+  const_iterator begin() const;
+  const_iterator end() const;
 
-  map_type<std::string, value>::iterator begin();
-  map_type<std::string, value>::iterator end();
+  iterator begin();
+  iterator end();
 
   friend void to_str( table const& o, std::string& out,
                       ::base::tag<table> );
 
  private:
-  map_type<std::string, value> o_;
+  // Returns the position of the key, or where it would be in-
+  // serted if it is not present.
+  iterator lower_bound( std::string_view key );
+  const_iterator lower_bound( std::string_view key ) const;
+
+  std::pair<iterator, bool> emplace_impl( std::string&& key,
+                                          value&& v );
+
+  std::vector<entry_type> o_;
 };
 
 /****************************************************************
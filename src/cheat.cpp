@@ -37,6 +37,7 @@
 #include "plane-stack.hpp"
 #include "player-mgr.hpp"
 #include "player.rds.hpp"
+#include "production.hpp"
 #include "promotion.hpp"
 #include "query-enum.hpp"
 #include "rebel-sentiment.hpp"
@@ -1157,10 +1158,11 @@ void cheat_decrease_commodity( Colony& colony,
 }
 
 void cheat_advance_colony_one_turn(
-    IColonyEvolver const& colony_evolver, Colony& colony ) {
+    SSConst const& ss, IColonyEvolver const& colony_evolver,
+    Colony& colony ) {
   lg.debug( "advancing colony {}. notifications:", colony.name );
-  ColonyEvolution ev =
-      colony_evolver.evolve_colony_one_turn( colony );
+  ColonyEvolution ev = colony_evolver.evolve_colony_one_turn(
+      colony, production_for_colony( ss, colony ) );
   for( ColonyNotification const& notification :
        ev.notifications )
     lg.debug( "{}", notification );
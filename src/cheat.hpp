@@ -124,7 +124,8 @@ void cheat_decrease_commodity( Colony& colony,
 // done when it is evolved at the start of a turn, though it
 // won't display any notifications, it will just log them.
 void cheat_advance_colony_one_turn(
-    IColonyEvolver const& colony_evolver, Colony& colony );
+    SSConst const& ss, IColonyEvolver const& colony_evolver,
+    Colony& colony );
 
 // This is called when the player asks to just create a unit on
 // the map. It will allow the player to select the unit type.
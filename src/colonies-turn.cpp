@@ -24,6 +24,8 @@
 #include "igui.hpp"
 #include "immigration.hpp"
 #include "isignal.hpp"
+#include "production-cache.hpp"
+#include "production.hpp"
 #include "ts.hpp"
 
 // config
@@ -42,6 +44,7 @@
 
 // base
 #include "base/logger.hpp"
+#include "base/parallel.hpp"
 
 // C++ standard library
 #include <numeric>
@@ -54,6 +57,10 @@ namespace rn {
 
 namespace {
 
+// Below this many colonies the cost of starting the threads out-
+// weighs what is saved by computing production in parallel.
+int constexpr kMinColoniesForParallelProduction = 8;
+
 struct ColonyNotificationWithMessage {
   ColonyNotification notification;
   string msg;
@@ -121,6 +128,54 @@ void give_new_crosses_to_player(
                       crosses_calc.dock_crosses_bonus );
 }
 
+// Computing the production is the most expensive part of evolv-
+// ing a colony and it only reads the game state, so it is done
+// for all of the colonies up front in parallel. Each result de-
+// pends only on the state of its own colony (and its player) and
+// no random numbers are drawn, so the results do not depend on
+// the number of threads. The colonies themselves are then
+// evolved sequentially in order since that mutates the state.
+// The land yields, which are the expensive part, are cached
+// across turns and so only need to be recomputed for colonies
+// whose outdoor units or surroundings have changed. The cache is
+// not thread safe, so it is only accessed outside of the paral-
+// lel section.
+vector<ColonyProduction> production_for_colonies(
+    SSConst const& ss, ColonyProductionCache& cache,
+    vector<ColonyId> const& colonies ) {
+  vector<ColonyProduction> res( colonies.size() );
+  vector<maybe<ColonyLandYields const&>> cached;
+  cached.reserve( colonies.size() );
+  vector<ColonyLandYields> computed( colonies.size() );
+  int misses = 0;
+  for( ColonyId const colony_id : colonies ) {
+    cached.push_back(
+        cache.find( ss, ss.colonies.colony_for( colony_id ) ) );
+    if( !cached.back().has_value() ) ++misses;
+  }
+  int const max_threads =
+      ( misses >= kMinColoniesForParallelProduction )
+          ? base::default_parallelism()
+          : 1;
+  base::parallel_for(
+      ssize( colonies ),
+      [&]( int const i ) {
+        Colony const& colony =
+            ss.colonies.colony_for( colonies[i] );
+        if( !cached[i].has_value() )
+          computed[i] = land_yields_for_colony( ss, colony );
+        res[i] = production_for_colony(
+            ss, colony,
+            cached[i].has_value() ? *cached[i] : computed[i] );
+      },
+      max_threads );
+  for( int i = 0; i < ssize( colonies ); ++i )
+    if( !cached[i].has_value() )
+      cache.store( ss, ss.colonies.colony_for( colonies[i] ),
+                   computed[i] );
+  return res;
+}
+
 wait<> run_colony_starvation( SS& ss, TS& ts, Colony& colony ) {
   // Must extract this info before destroying the colony.
   IAgent& agent = ts.agents()[colony.player];
@@ -174,19 +229,34 @@ wait<> evolve_colonies_for_player(
   // This is so that we process them in a deterministic order
   // that doesn't depend on hash map iteration order.
   sort( colonies.begin(), colonies.end() );
+  vector<ColonyProduction> const productions =
+      production_for_colonies(
+          ss, ts.colony_production_cache(), colonies );
+  // Evolving a colony does not change the production of the
+  // other colonies, but the player can change anything while in
+  // the colony view, so after that we can no longer trust what
+  // was computed up front.
+  bool productions_valid = true;
   vector<ColonyEvolution> evolutions;
   // These will be accumulated for all colonies and then dis-
   // played at the end.
   vector<ColonyNotificationWithMessage> transient_messages;
-  for( ColonyId const colony_id : colonies ) {
-    Colony& colony = ss.colonies.colony_for( colony_id );
+  for( int i = 0; i < ssize( colonies ); ++i ) {
+    Colony& colony = ss.colonies.colony_for( colonies[i] );
     lg.debug( "evolving colony \"{}\".", colony.name );
     // The OG appears to do this precisely here, namely at the
     // start of each colony's evolution, but before evolving the
     // colony and showing colony notifications.
     co_await fire_fortifications( ss, ts, player, colony );
-    evolutions.push_back(
-        colony_evolver.evolve_colony_one_turn( colony ) );
+    maybe<ColonyProduction> recomputed;
+    if( !productions_valid )
+      recomputed =
+          ts.colony_production_cache().production_for_colony(
+              ss, colony );
+    ColonyProduction const& production =
+        recomputed.has_value() ? *recomputed : productions[i];
+    evolutions.push_back( colony_evolver.evolve_colony_one_turn(
+        colony, production ) );
     ColonyEvolution const& ev = evolutions.back();
     if( ev.colony_disappeared ) {
       co_await run_colony_starvation( ss, ts, colony );
@@ -224,6 +294,7 @@ wait<> evolve_colonies_for_player(
             agent, ts.gui, blocking_messages );
     if( zoom_to_colony ) {
       // This should only ever happen for human players.
+      productions_valid = false;
       e_colony_abandoned abandoned =
           co_await ts.colony_viewer.show( ts, colony.id );
       if( abandoned == e_colony_abandoned::yes ) continue;
@@ -21,6 +21,7 @@
 #include "fathers.hpp"
 #include "irand.hpp"
 #include "on-map.hpp"
+#include "production-cache.hpp"
 #include "production.hpp"
 #include "promotion.hpp"
 #include "revolution.rds.hpp"
@@ -758,11 +759,11 @@ ColonyNotificationMessage generate_colony_notification_message(
   return res;
 }
 
-ColonyEvolution evolve_colony_one_turn( SS& ss, TS& ts,
-                                        IRand& rand,
-                                        Colony& colony ) {
+ColonyEvolution evolve_colony_one_turn(
+    SS& ss, TS& ts, IRand& rand, Colony& colony,
+    ColonyProduction const& production ) {
   ColonyEvolution ev;
-  ev.production = production_for_colony( ss, colony );
+  ev.production = production;
 
   Player& player =
       player_for_player_or_die( ss.players, colony.player );
@@ -863,4 +864,13 @@ ColonyEvolution evolve_colony_one_turn( SS& ss, TS& ts,
   return ev;
 }
 
+ColonyEvolution evolve_colony_one_turn( SS& ss, TS& ts,
+                                        IRand& rand,
+                                        Colony& colony ) {
+  return evolve_colony_one_turn(
+      ss, ts, rand, colony,
+      ts.colony_production_cache().production_for_colony(
+          ss.as_const, colony ) );
+}
+
 } // namespace rn
@@ -32,6 +32,17 @@ struct TS;
 // used for the AI players, 3) we want to be able to have a way
 // to evolve a colony (e.g. for cheat mode) where we can control
 // what is shown to the user.
+//
+// The production must be what production_for_colony returns for
+// the colony in its current state. It is taken as a parameter so
+// that the production for many colonies can be computed up front
+// (and in parallel) since it only reads the game state and is
+// the most expensive part of the evolution.
+ColonyEvolution evolve_colony_one_turn(
+    SS& ss, TS& ts, IRand& rand, Colony& colony,
+    ColonyProduction const& production );
+
+// Same as above but computes the production first.
 ColonyEvolution evolve_colony_one_turn( SS& ss, TS& ts,
                                         IRand& rand,
                                         Colony& colony );
@@ -219,7 +219,7 @@ struct ColonyPlane : public IPlane {
           break;
         case ::SDLK_SPACE:
           cheat_advance_colony_one_turn(
-              RealColonyEvolver( ss_, ts_, engine_.rand() ),
+              ss_, RealColonyEvolver( ss_, ts_, engine_.rand() ),
               colony_ );
           update_colony_view( ss_, colony_ );
           break;
@@ -280,6 +280,7 @@ struct ColonyPlane : public IPlane {
         default:
           break;
       }
+      update_colony_view( ss_, colony_ );
       co_return false;
     }
     if( co_await colview_top_level().perform_click( event ) ) {
@@ -207,6 +207,12 @@ void ColViewBuildings::draw_workers(
 
 void ColViewBuildings::draw( rr::Renderer& renderer,
                              Coord coord ) const {
+  retained_.draw( renderer, coord, delta(),
+                  [&] { draw_impl( renderer, coord ); } );
+}
+
+void ColViewBuildings::draw_impl( rr::Renderer& renderer,
+                                  Coord coord ) const {
   SCOPED_RENDERER_MOD_ADD(
       painter_mods.repos.translation2,
       gfx::size( coord.distance_from_origin() ).to_double() );
@@ -361,16 +367,21 @@ bool ColViewBuildings::try_drag( ColViewObject const& o,
   CHECK( o.holds<ColViewObject::unit>() );
   CHECK( o.get<ColViewObject::unit>().id == unit.id );
   dragging_ = Dragging{ .id = unit.id, .slot = slot };
+  retained_.invalidate();
   return true;
 }
 
 // Implement IDragSource.
-void ColViewBuildings::cancel_drag() { dragging_ = nothing; }
+void ColViewBuildings::cancel_drag() {
+  dragging_ = nothing;
+  retained_.invalidate();
+}
 
 // Implement IDragSource.
 wait<> ColViewBuildings::disown_dragged_object() {
   CHECK( dragging_.has_value() );
   UnitOwnershipChanger( ss_, dragging_->id ).change_to_free();
+  retained_.invalidate();
   co_return;
 }
 
@@ -451,6 +462,7 @@ void ColViewBuildings::update_this_and_children() {
   // This method is only called when the logical resolution
   // hasn't changed, so we assume the size hasn't changed.
   layout_ = create_layout( engine_, ss_, layout_.size, colony_ );
+  retained_.invalidate();
 }
 
 std::unique_ptr<ColViewBuildings> ColViewBuildings::create(
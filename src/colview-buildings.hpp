@@ -15,6 +15,7 @@
 // Revolution Now
 #include "colview-entities.hpp"
 #include "spread-render.rds.hpp"
+#include "views.hpp"
 
 // ss
 #include "ss/colony-enums.rds.hpp"
@@ -133,6 +134,8 @@ class ColViewBuildings : public ui::View,
   void draw_workers( rr::Renderer& renderer,
                      e_colony_building_slot const slot ) const;
 
+  void draw_impl( rr::Renderer& renderer, Coord coord ) const;
+
   struct Dragging {
     UnitId id                   = {};
     e_colony_building_slot slot = {};
@@ -141,6 +144,10 @@ class ColViewBuildings : public ui::View,
   Colony& colony_;
   maybe<Dragging> dragging_ = {};
   Layout layout_;
+  // Everything drawn here only changes when the layout is re-
+  // built or when a drag starts or ends, so we draw in retained
+  // mode and invalidate at those points.
+  ui::RetainedDrawing retained_;
 };
 
 } // namespace rn
@@ -203,6 +203,7 @@ wait_bool ColonyLandView::perform_click(
   Colony& colony = ss_.colonies.colony_for( colony_.id );
   change_unit_outdoor_job( colony, *unit_id, *new_job );
   update_production( ss_, colony_ );
+  retained_.invalidate();
   co_return true;
 }
 
@@ -324,24 +325,30 @@ bool ColonyLandView::try_drag( ColViewObject const&,
   UNWRAP_CHECK( d, direction_under_cursor( where ) );
   UNWRAP_CHECK( job, job_for_direction( d ) );
   dragging_ = Draggable{ .d = d, .job = job };
+  retained_.invalidate();
   return true;
 }
 
-void ColonyLandView::cancel_drag() { dragging_ = nothing; }
+void ColonyLandView::cancel_drag() {
+  dragging_ = nothing;
+  retained_.invalidate();
+}
 
 wait<> ColonyLandView::disown_dragged_object() {
   UNWRAP_CHECK( draggable, dragging_ );
   UNWRAP_CHECK( unit_id, unit_for_direction( draggable.d ) );
   UnitOwnershipChanger( ss_, unit_id ).change_to_free();
+  retained_.invalidate();
   co_return;
 }
 
-void ColonyLandView::draw_land_3x3( rr::Renderer& renderer,
-                                    Coord const coord ) const {
-  point const mouse_pos =
-      input::current_mouse_position().to_gfx();
-  bool const hover = mouse_pos.is_inside( bounds( coord ) );
+void ColonyLandView::update_this_and_children() {
+  retained_.invalidate();
+}
 
+void ColonyLandView::draw_land_3x3( rr::Renderer& renderer,
+                                    Coord const coord,
+                                    bool const hover ) const {
   SCOPED_RENDERER_MOD_ADD(
       painter_mods.repos.translation2,
       gfx::size( coord.distance_from_origin() ).to_double() );
@@ -504,10 +511,11 @@ void ColonyLandView::draw_spread(
 }
 
 void ColonyLandView::draw_land_6x6( rr::Renderer& renderer,
-                                    Coord const coord ) const {
+                                    Coord const coord,
+                                    bool const hover ) const {
   {
     SCOPED_RENDERER_MOD_MUL( painter_mods.repos.scale, 2.0 );
-    draw_land_3x3( renderer, coord );
+    draw_land_3x3( renderer, coord, hover );
   }
   // Further drawing should not be scaled.
 
@@ -578,23 +586,41 @@ void ColonyLandView::draw_land_6x6( rr::Renderer& renderer,
   }
 }
 
-void ColonyLandView::draw( rr::Renderer& renderer,
-                           Coord coord ) const {
+void ColonyLandView::draw_impl( rr::Renderer& renderer,
+                                Coord const coord,
+                                bool const hover ) const {
   rr::Painter painter = renderer.painter();
   switch( mode_ ) {
     case e_render_mode::_3x3:
-      draw_land_3x3( renderer, coord );
+      draw_land_3x3( renderer, coord, hover );
       break;
     case e_render_mode::_5x5:
       painter.draw_solid_rect( bounds( coord ), pixel::wood() );
-      draw_land_3x3( renderer, coord + g_tile_delta );
+      draw_land_3x3( renderer, coord + g_tile_delta, hover );
       break;
     case e_render_mode::_6x6:
-      draw_land_6x6( renderer, coord );
+      draw_land_6x6( renderer, coord, hover );
       break;
   }
 }
 
+void ColonyLandView::draw( rr::Renderer& renderer,
+                           Coord coord ) const {
+  Coord const land_coord = ( mode_ == e_render_mode::_5x5 )
+                               ? coord + g_tile_delta
+                               : coord;
+  point const mouse_pos =
+      input::current_mouse_position().to_gfx();
+  bool const hover = mouse_pos.is_inside( bounds( land_coord ) );
+  if( hover != retained_hover_ ) {
+    retained_.invalidate();
+    retained_hover_ = hover;
+  }
+  retained_.draw( renderer, coord, delta(), [&] {
+    draw_impl( renderer, coord, hover );
+  } );
+}
+
 unique_ptr<ColonyLandView> ColonyLandView::create(
     IEngine& engine, SS& ss, TS& ts, Player& player,
     Colony& colony, e_render_mode mode ) {
@@ -14,6 +14,7 @@
 
 // Revolution Now
 #include "colview-entities.hpp"
+#include "views.hpp"
 
 // ss
 #include "ss/colony-enums.rds.hpp"
@@ -58,6 +59,9 @@ struct ColonyLandView : public ui::View,
   // Implement ui::object.
   Delta delta() const override;
 
+  // Implement ColonySubView.
+  void update_this_and_children() override;
+
  private:
   maybe<e_direction> direction_under_cursor( Coord coord ) const;
 
@@ -121,11 +125,14 @@ struct ColonyLandView : public ui::View,
                     e_tile tile, int quantity,
                     bool is_colony_tile ) const;
 
-  void draw_land_3x3( rr::Renderer& renderer,
-                      Coord coord ) const;
+  void draw_land_3x3( rr::Renderer& renderer, Coord coord,
+                      bool hover ) const;
+
+  void draw_land_6x6( rr::Renderer& renderer, Coord coord,
+                      bool hover ) const;
 
-  void draw_land_6x6( rr::Renderer& renderer,
-                      Coord coord ) const;
+  void draw_impl( rr::Renderer& renderer, Coord coord,
+                  bool hover ) const;
 
   void draw( rr::Renderer& renderer,
              Coord coord ) const override;
@@ -140,6 +147,12 @@ struct ColonyLandView : public ui::View,
   // land is owned by the natives.
   refl::enum_map<e_direction, maybe<DwellingId>>
       native_owned_land_;
+  // The land only changes in response to actions in the colony
+  // view (after which update_this_and_children is called), to
+  // drags, and to the mouse moving over it, so it is drawn in
+  // retained mode and invalidated at those points.
+  mutable ui::RetainedDrawing retained_;
+  mutable bool retained_hover_ = false;
 };
 
 } // namespace rn
@@ -0,0 +1,326 @@
+/****************************************************************
+**combat-odds.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Side-effect free odds of battle outcomes.
+*
+*****************************************************************/
+#include "combat-odds.hpp"
+
+// Revolution Now
+#include "damaged.hpp"
+#include "icombat.rds.hpp"
+#include "promotion.hpp"
+#include "unit-mgr.hpp"
+
+// config
+#include "config/combat.rds.hpp"
+#include "config/unit-type.hpp"
+
+// ss
+#include "ss/colonies.hpp"
+#include "ss/native-unit.rds.hpp"
+#include "ss/players.hpp"
+#include "ss/ref.hpp"
+#include "ss/unit.hpp"
+#include "ss/units.hpp"
+
+// C++ standard library
+#include <unordered_map>
+
+using namespace std;
+
+namespace rn {
+
+namespace {
+
+// Evaluating whether a unit can be promoted requires a bit of
+// work, and when the odds of many battles are evaluated at once
+// the same units tend to appear in many of them.
+struct PromotionCache {
+  maybe<CombatPromotionOdds> const& get( SSConst const& ss,
+                                         Unit const& unit ) {
+    auto it = cache_.find( unit.id() );
+    if( it == cache_.end() )
+      it = cache_
+               .emplace( unit.id(),
+                         combat_promotion_odds( ss, unit ) )
+               .first;
+    return it->second;
+  }
+
+ private:
+  unordered_map<UnitId, maybe<CombatPromotionOdds>> cache_;
+};
+
+// Mirrors euro_unit_combat_outcome in the combat module.
+CombatOutcomeOdds euro_unit_outcome_odds(
+    Unit const& unit,
+    maybe<CombatPromotionOdds> const& promotion,
+    bool const opponent_is_native, double const win ) {
+  CombatOutcomeOdds res;
+  double const promote =
+      promotion.has_value() ? promotion->roll.value_or( 1.0 )
+                            : 0.0;
+  res.promoted  = win * promote;
+  res.no_change = win * ( 1.0 - promote );
+  double const lose = 1.0 - win;
+  switch( unit.desc().on_death.to_enum() ) {
+    using e = UnitDeathAction::e;
+    case e::capture:
+    case e::capture_and_demote:
+      // When the natives defeat a unit that is otherwise cap-
+      // turable then it just gets destroyed.
+      ( opponent_is_native ? res.destroyed : res.captured ) +=
+          lose;
+      break;
+    case e::destroy:
+      res.destroyed += lose;
+      break;
+    case e::demote:
+      res.demoted += lose;
+      break;
+    case e::naval:
+      SHOULD_NOT_BE_HERE;
+  }
+  return res;
+}
+
+CombatOdds euro_attack_euro_odds( SSConst const& ss,
+                                  PromotionCache& promotions,
+                                  Unit const& attacker,
+                                  Unit const& defender ) {
+  CombatOdds res;
+  res.attacker_wins = attacker_win_probability(
+      attacker.desc().combat, defender.desc().combat );
+  res.defender_wins = 1.0 - res.attacker_wins;
+  res.attacker      = euro_unit_outcome_odds(
+      attacker, promotions.get( ss, attacker ),
+      /*opponent_is_native=*/false, res.attacker_wins );
+  res.defender = euro_unit_outcome_odds(
+      defender, promotions.get( ss, defender ),
+      /*opponent_is_native=*/false, res.defender_wins );
+  return res;
+}
+
+CombatOdds euro_attack_brave_odds( SSConst const& ss,
+                                   PromotionCache& promotions,
+                                   Unit const& attacker,
+                                   NativeUnit const& defender ) {
+  CombatOdds res;
+  double const defense_points =
+      unit_attr( defender.type ).combat;
+  res.attacker_wins = attacker_win_probability(
+      attacker.desc().combat, defense_points );
+  res.defender_wins = 1.0 - res.attacker_wins;
+  res.attacker      = euro_unit_outcome_odds(
+      attacker, promotions.get( ss, attacker ),
+      /*opponent_is_native=*/true, res.attacker_wins );
+  // A brave that loses is always destroyed, and a brave that
+  // wins while defending is never changed.
+  res.defender.no_change = res.defender_wins;
+  res.defender.destroyed = res.attacker_wins;
+  return res;
+}
+
+// Mirrors the naval combat in the combat module. The other ships
+// on the defender's square that are also affected when it loses
+// are not included here.
+CombatOdds ship_attack_ship_odds( SSConst const& ss,
+                                  Unit const& attacker,
+                                  Unit const& defender ) {
+  UNWRAP_CHECK( attacker_ship_combat,
+                attacker.desc().ship_combat_extra );
+  UNWRAP_CHECK( defender_ship_combat,
+                defender.desc().ship_combat_extra );
+  CombatOdds res;
+  NavalEvadeWeights const evade =
+      naval_evade_weights( ss, attacker, defender );
+  res.evaded = evade_probability( evade );
+  double const fight = 1.0 - res.evaded;
+  double const attacker_wins_fight = attacker_win_probability(
+      attacker.desc().combat, defender.desc().combat );
+  res.attacker_wins = fight * attacker_wins_fight;
+  res.defender_wins = fight * ( 1.0 - attacker_wins_fight );
+  // Whoever evades or wins is unchanged (a winning attacker
+  // moves, but that is not a change to the unit).
+  res.attacker.no_change = res.evaded + res.attacker_wins;
+  res.defender.no_change = res.evaded + res.defender_wins;
+  auto const set_loser = [&]( Unit const& loser,
+                              CombatOutcomeOdds& outcome,
+                              Sinking const& sinking,
+                              double const lose ) {
+    double const sinks = sink_probability( sinking );
+    outcome.destroyed += lose * sinks;
+    // A ship that would be damaged sinks instead when there is
+    // nowhere to repair it.
+    Coord const coord = ss.units.coord_for( loser.id() );
+    bool const can_repair =
+        find_repair_port_for_ship( ss, loser.player_type(),
+                                   coord )
+            .has_value();
+    ( can_repair ? outcome.damaged : outcome.destroyed ) +=
+        lose * ( 1.0 - sinks );
+  };
+  set_loser( attacker, res.attacker,
+             Sinking{ .guns = defender_ship_combat.guns,
+                      .hull = attacker_ship_combat.hull },
+             res.defender_wins );
+  set_loser( defender, res.defender,
+             Sinking{ .guns = attacker_ship_combat.guns,
+                      .hull = defender_ship_combat.hull },
+             res.attacker_wins );
+  return res;
+}
+
+CombatOdds combat_odds_impl( SSConst const& ss,
+                             PromotionCache& promotions,
+                             CombatOddsQuery const& query ) {
+  Unit const& attacker = ss.units.unit_for( query.attacker );
+  switch( ss.units.unit_kind( query.defender ) ) {
+    case e_unit_kind::euro: {
+      Unit const& defender =
+          ss.units.euro_unit_for( query.defender );
+      if( attacker.desc().ship )
+        return ship_attack_ship_odds( ss, attacker, defender );
+      return euro_attack_euro_odds( ss, promotions, attacker,
+                                    defender );
+    }
+    case e_unit_kind::native: {
+      NativeUnit const& defender =
+          ss.units.native_unit_for( query.defender );
+      return euro_attack_brave_odds( ss, promotions, attacker,
+                                     defender );
+    }
+  }
+}
+
+} // namespace
+
+/****************************************************************
+** Shared with RealCombat.
+*****************************************************************/
+double attacker_win_probability( double const attacker_weight,
+                                 double const defender_weight ) {
+  CHECK_GE( attacker_weight, 0 );
+  CHECK_GE( defender_weight, 0 );
+  if( attacker_weight == 0 && defender_weight == 0 ) return 1.0;
+  double const probability =
+      attacker_weight / ( attacker_weight + defender_weight );
+  CHECK_LE( probability, 1.0 );
+  return probability;
+}
+
+maybe<CombatPromotionOdds> combat_promotion_odds(
+    SSConst const& ss, Unit const& unit ) {
+  if( maybe<e_unit_activity> const activity =
+          current_activity_for_unit( ss.units, ss.colonies,
+                                     unit.id() );
+      activity != e_unit_activity::fighting )
+    return nothing;
+  expect<UnitComposition> const promoted =
+      promoted_from_activity( unit.composition(),
+                              e_unit_activity::fighting );
+  if( !promoted.has_value() ) return nothing;
+  UNWRAP_CHECK( player, ss.players.players[unit.player_type()] );
+  // During the war of independence, veteran units (only) can be
+  // promoted to continental units as a result of winning in com-
+  // bat. Here is what appears to affect it:
+  //
+  //   * SoL in colony: the SoL in the colony appears to have no
+  //     effect, since even when it is zero, the promotion still
+  //     seems to happen with the usual probability (unless
+  //     George Washington was acquired in which case it happens
+  //     always upon victory).
+  //   * George Washington: having George Washington seems to (as
+  //     usual) make the promotion happen always upon winning,
+  //     even if the colony has zero SoL.
+  //   * Happens the same outside of the colony.
+  //
+  // That makes things pretty simple, since promotion to conti-
+  // nental units introduces no new mechanics.
+  if( promoted->type_obj().unit_type_modifiers().contains(
+          e_unit_type_modifier::independence ) &&
+      player.revolution.status < e_revolution_status::declared )
+    // Don't allow promoting to a continental unit before inde-
+    // pendence is declared.
+    return nothing;
+  CombatPromotionOdds res{ .to = promoted->type_obj() };
+  if( !player.fathers.has[e_founding_father::george_washington] )
+    res.roll = config_combat.promotion_in_combat.probability;
+  return res;
+}
+
+NavalEvadeWeights naval_evade_weights( SSConst const& ss,
+                                       Unit const& attacker,
+                                       Unit const& defender ) {
+  Player const& attacking_player = player_for_player_or_die(
+      ss.players, attacker.player_type() );
+  Player const& defending_player = player_for_player_or_die(
+      ss.players, attacker.player_type() );
+  UNWRAP_CHECK( attacker_ship_combat,
+                attacker.desc().ship_combat_extra );
+  UNWRAP_CHECK( defender_ship_combat,
+                defender.desc().ship_combat_extra );
+  int const attacker_attack_strength =
+      attacker.desc().can_attack ? attacker.desc().combat : 0;
+  int const defender_attack_strength =
+      defender.desc().can_attack ? defender.desc().combat : 0;
+  CHECK_GT( attacker_attack_strength, 0 );
+  // The attacker obviously doesn't evade; this is just the name
+  // used for the attacker's weight in the evade calculation.
+  int const attacker_evade_bonus =
+      attacker_ship_combat.evasion_bonus ? 2 : 1;
+  int const defender_evade_bonus =
+      defender_ship_combat.evasion_bonus ? 2 : 1;
+  MvPoints const attacker_evade =
+      ( movement_points( attacking_player, attacker.type() ) +
+        MovementPoints( 1 ) ) *
+      attacker_evade_bonus;
+  MvPoints const defender_evade =
+      ( movement_points( defending_player, defender.type() ) +
+        MovementPoints( 1 ) ) *
+      defender_evade_bonus;
+  CHECK( attacker_evade.atoms() % 3 == 0 );
+  CHECK( defender_evade.atoms() % 3 == 0 );
+  return NavalEvadeWeights{
+    .attacker  = attacker_evade.atoms() / 3,
+    .defender  = defender_evade.atoms() / 3,
+    .can_evade = defender_attack_strength <
+                 attacker_attack_strength };
+}
+
+double evade_probability( NavalEvadeWeights const& weights ) {
+  if( !weights.can_evade ) return 0.0;
+  return double( weights.defender ) /
+         ( weights.defender + weights.attacker );
+}
+
+double sink_probability( Sinking const& sinking ) {
+  return double( sinking.guns ) /
+         ( sinking.guns + sinking.hull );
+}
+
+/****************************************************************
+** Odds.
+*****************************************************************/
+CombatOdds combat_odds( SSConst const& ss,
+                        CombatOddsQuery const& query ) {
+  PromotionCache promotions;
+  return combat_odds_impl( ss, promotions, query );
+}
+
+vector<CombatOdds> combat_odds(
+    SSConst const& ss, span<CombatOddsQuery const> queries ) {
+  PromotionCache promotions;
+  vector<CombatOdds> res;
+  res.reserve( queries.size() );
+  for( CombatOddsQuery const& query : queries )
+    res.push_back( combat_odds_impl( ss, promotions, query ) );
+  return res;
+}
+
+} // namespace rn
@@ -0,0 +1,88 @@
+/****************************************************************
+**combat-odds.hpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Side-effect free odds of battle outcomes.
+*
+*****************************************************************/
+#pragma once
+
+// rds
+#include "combat-odds.rds.hpp"
+
+// Revolution Now
+#include "maybe.hpp"
+
+// C++ standard library
+#include <span>
+#include <vector>
+
+namespace rn {
+
+/****************************************************************
+** Fwd. Decls.
+*****************************************************************/
+struct SSConst;
+struct Sinking;
+struct Unit;
+
+/****************************************************************
+** Shared with RealCombat.
+*****************************************************************/
+// These are the pieces of the combat mechanics that determine
+// the probabilities of the outcomes. They are used both by Real-
+// Combat, which rolls against them, and by the odds below, so
+// that the two always agree.
+
+// The probability that the attacker wins, given the (modified)
+// combat weights. When both weights are zero the attacker wins.
+[[nodiscard]] double attacker_win_probability(
+    double attacker_weight, double defender_weight );
+
+// If the unit would be eligible for a promotion upon winning a
+// battle then this returns the type that it would be promoted to
+// and the chance of getting it.
+[[nodiscard]] maybe<CombatPromotionOdds> combat_promotion_odds(
+    SSConst const& ss, Unit const& unit );
+
+[[nodiscard]] NavalEvadeWeights naval_evade_weights(
+    SSConst const& ss, Unit const& attacker,
+    Unit const& defender );
+
+// The probability that the defending ship evades the attack,
+// which is zero when it cannot evade.
+[[nodiscard]] double evade_probability(
+    NavalEvadeWeights const& weights );
+
+// The probability that the ship that lost a naval battle sinks
+// as opposed to being damaged.
+[[nodiscard]] double sink_probability( Sinking const& sinking );
+
+/****************************************************************
+** Odds.
+*****************************************************************/
+// Computes the exact probabilities of the outcomes of the battle
+// that would result if the attacker were to attack the defender
+// where they currently are, without rolling any dice or changing
+// any state. This is for battles between units; attacks on
+// colonies and dwellings are not supported.
+//
+// Note that the outcomes that are decided after the battle and
+// that do not affect the units themselves (such as whether a
+// tribe retains the horses of a defeated brave) are not in-
+// cluded.
+[[nodiscard]] CombatOdds combat_odds(
+    SSConst const& ss, CombatOddsQuery const& query );
+
+// Same as above but for many battles at once, e.g. for an AI to
+// score all of its candidate attacks. Results are in the same
+// order as the queries. This is cheaper than calling the above
+// in a loop when many queries share attackers.
+[[nodiscard]] std::vector<CombatOdds> combat_odds(
+    SSConst const& ss,
+    std::span<CombatOddsQuery const> queries );
+
+} // namespace rn
@@ -12,6 +12,7 @@
 
 // Revolution Now
 #include "colony-mgr.hpp"
+#include "combat-odds.hpp"
 #include "damaged.hpp"
 #include "irand.hpp"
 #include "missionary.hpp"
@@ -22,7 +23,6 @@
 #include "unit-transformation.hpp"
 
 // config
-#include "config/combat.rds.hpp"
 #include "config/natives.hpp"
 #include "config/unit-type.hpp"
 
@@ -51,13 +51,10 @@ namespace {
 e_combat_winner choose_winner( IRand& rand,
                                double attacker_weight,
                                double defender_weight ) {
-  CHECK_GE( attacker_weight, 0 );
-  CHECK_GE( defender_weight, 0 );
   if( attacker_weight == 0 && defender_weight == 0 )
     return e_combat_winner::attacker;
-  double const winning_probability =
-      attacker_weight / ( attacker_weight + defender_weight );
-  CHECK_LE( winning_probability, 1.0 );
+  double const winning_probability = attacker_win_probability(
+      attacker_weight, defender_weight );
   lg.info( "winning probability: {}", winning_probability );
   return rand.bernoulli( winning_probability )
              ? e_combat_winner::attacker
@@ -67,46 +64,12 @@ e_combat_winner choose_winner( IRand& rand,
 maybe<UnitType> should_promote_euro_unit( SSConst const& ss,
                                           IRand& rand,
                                           Unit const& unit ) {
-  if( maybe<e_unit_activity> const activity =
-          current_activity_for_unit( ss.units, ss.colonies,
-                                     unit.id() );
-      activity != e_unit_activity::fighting )
+  maybe<CombatPromotionOdds> const odds =
+      combat_promotion_odds( ss, unit );
+  if( !odds.has_value() ) return nothing;
+  if( odds->roll.has_value() && !rand.bernoulli( *odds->roll ) )
     return nothing;
-  expect<UnitComposition> const promoted =
-      promoted_from_activity( unit.composition(),
-                              e_unit_activity::fighting );
-  if( !promoted.has_value() ) return nothing;
-  UNWRAP_CHECK( player, ss.players.players[unit.player_type()] );
-  bool should_promote = true;
-  // During the war of independence, veteran units (only) can be
-  // promoted to continental units as a result of winning in com-
-  // bat. Here is what appears to affect it:
-  //
-  //   * SoL in colony: the SoL in the colony appears to have no
-  //     effect, since even when it is zero, the promotion still
-  //     seems to happen with the usual probability (unless
-  //     George Washington was acquired in which case it happens
-  //     always upon victory).
-  //   * George Washington: having George Washington seems to (as
-  //     usual) make the promotion happen always upon winning,
-  //     even if the colony has zero SoL.
-  //   * Happens the same outside of the colony.
-  //
-  // That makes things pretty simple, since promotion to conti-
-  // nental units introduces no new mechanics.
-  if( promoted->type_obj().unit_type_modifiers().contains(
-          e_unit_type_modifier::independence ) &&
-      player.revolution.status < e_revolution_status::declared )
-    // Don't allow promoting to a continental unit before inde-
-    // pendence is declared.
-    should_promote = false;
-  if( !player.fathers.has[e_founding_father::george_washington] )
-    should_promote =
-        should_promote &&
-        rand.bernoulli(
-            config_combat.promotion_in_combat.probability );
-  if( !should_promote ) return nothing;
-  return promoted->type_obj();
+  return odds->to;
 }
 
 EuroUnitCombatOutcome euro_unit_combat_outcome(
@@ -421,10 +384,6 @@ CombatShipAttackShip RealCombat::ship_attack_ship(
     Unit const& attacker, Unit const& defender ) {
   CHECK( attacker.desc().ship );
   CHECK( defender.desc().ship );
-  Player const& attacking_player = player_for_player_or_die(
-      ss_.players, attacker.player_type() );
-  Player const& defending_player = player_for_player_or_die(
-      ss_.players, attacker.player_type() );
   Coord const attacker_coord =
       ss_.units.coord_for( attacker.id() );
   Coord const defender_coord =
@@ -433,52 +392,29 @@ CombatShipAttackShip RealCombat::ship_attack_ship(
                 attacker.desc().ship_combat_extra );
   UNWRAP_CHECK( defender_ship_combat,
                 defender.desc().ship_combat_extra );
-  int const attacker_attack_strength =
-      attacker.desc().can_attack ? attacker.desc().combat : 0;
-  int const defender_attack_strength =
-      defender.desc().can_attack ? defender.desc().combat : 0;
-  CHECK_GT( attacker_attack_strength, 0 );
-  // The attacker obviously doesn't evade; this is just the name
-  // used for the attacker's weight in the evade calculation.
-  int const attacker_evade_bonus =
-      attacker_ship_combat.evasion_bonus ? 2 : 1;
-  int const defender_evade_bonus =
-      defender_ship_combat.evasion_bonus ? 2 : 1;
-  MvPoints const attacker_evade =
-      ( movement_points( attacking_player, attacker.type() ) +
-        MovementPoints( 1 ) ) *
-      attacker_evade_bonus;
-  MvPoints const defender_evade =
-      ( movement_points( defending_player, defender.type() ) +
-        MovementPoints( 1 ) ) *
-      defender_evade_bonus;
+  NavalEvadeWeights const evade_weights =
+      naval_evade_weights( ss_, attacker, defender );
   double const attacker_combat = attacker.desc().combat;
   double const defender_combat = defender.desc().combat;
   // Try evade.
   bool const evaded = [&] {
-    bool const try_evade =
-        defender_attack_strength < attacker_attack_strength;
-    if( !try_evade ) return false;
-    return rand_.bernoulli(
-        double( defender_evade.atoms() ) /
-        ( defender_evade.atoms() + attacker_evade.atoms() ) );
+    if( !evade_weights.can_evade ) return false;
+    return rand_.bernoulli( evade_probability( evade_weights ) );
   }();
 
-  CHECK( attacker_evade.atoms() % 3 == 0 );
-  CHECK( defender_evade.atoms() % 3 == 0 );
   // Fill out what we can so far.
   CombatShipAttackShip res{
     .winner       = nothing,
     .sink_weights = nothing,
     .attacker     = { .id           = attacker.id(),
                       .modifiers    = {},
-                      .evade_weight = attacker_evade.atoms() / 3,
+                      .evade_weight = evade_weights.attacker,
                       .base_combat_weight     = attacker_combat,
                       .modified_combat_weight = attacker_combat,
                       .outcome                = {} },
     .defender     = { .id           = defender.id(),
                       .modifiers    = {},
-                      .evade_weight = defender_evade.atoms() / 3,
+                      .evade_weight = evade_weights.defender,
                       .base_combat_weight     = defender_combat,
                       .modified_combat_weight = defender_combat,
                       .outcome                = {} } };
@@ -493,9 +429,8 @@ CombatShipAttackShip RealCombat::ship_attack_ship(
   }
 
   // Not evaded, so someone wins.
-  bool const attacker_wins =
-      rand_.bernoulli( double( attacker_combat ) /
-                       ( attacker_combat + defender_combat ) );
+  bool const attacker_wins = rand_.bernoulli(
+      attacker_win_probability( attacker_combat, defender_combat ) );
   res.winner = attacker_wins ? e_combat_winner::attacker
                              : e_combat_winner::defender;
   Unit const& winner_unit = attacker_wins ? attacker : defender;
@@ -525,8 +460,7 @@ CombatShipAttackShip RealCombat::ship_attack_ship(
   // Now we can compute the sink weights since we know whose guns
   // and whose hull strength we need.
   auto does_sink = [this]( Sinking sinking ) {
-    return rand_.bernoulli( double( sinking.guns ) /
-                            ( sinking.guns + sinking.hull ) );
+    return rand_.bernoulli( sink_probability( sinking ) );
   };
 
   int const guns = attacker_wins ? attacker_ship_combat.guns
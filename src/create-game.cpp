@@ -475,6 +475,7 @@ valid_or<string> create_game_from_setup(
   // used to seed it at that time. See the comments in ss/meta
   // for more details on this mechanism.
   root.meta.seeds.gameplay_seed = setup.gameplay_seed;
+  root.meta.seeds.engine        = rng::e_rng_engine::philox;
 
   // SettingsState state.
   // ------------------------------------------------------------
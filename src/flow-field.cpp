@@ -0,0 +1,161 @@
+/****************************************************************
+**flow-field.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Shared paths to a single destination.
+*
+*****************************************************************/
+#include "flow-field.hpp"
+
+// Revolution Now
+#include "igoto-viewer.hpp"
+
+// refl
+#include "refl/query-enum.hpp"
+
+// base
+#include "base/error.hpp"
+
+// C++ standard library
+#include <algorithm>
+#include <queue>
+
+using namespace std;
+
+namespace rg = std::ranges;
+
+namespace rn {
+
+namespace {
+
+using ::gfx::point;
+using ::refl::enum_values;
+
+struct QueuedTile {
+  // Must be first for comparison.
+  int cost   = {};
+  point tile = {};
+
+  [[maybe_unused]] auto operator<=>( QueuedTile const& ) const =
+      default;
+};
+
+using Queue = priority_queue<QueuedTile, vector<QueuedTile>,
+                             greater<QueuedTile>>;
+
+// This is Dijkstra's algorithm run backwards from the destina-
+// tion tile(s), which are expected to have already been given a
+// cost of zero and pushed onto the queue. A tile gets a cost if
+// a unit on it can move to a tile that has a path, but only
+// tiles that can be entered (or the destination tiles them-
+// selves) are searched from, the same as in the A* search.
+template<typename Tile>
+void fill_flow_field( IGotoMapViewer const& viewer,
+                      gfx::matrix<Tile>& tiles, Queue& todo ) {
+  while( !todo.empty() ) {
+    auto const [cost, curr] = todo.top();
+    todo.pop();
+    // A cheaper path to this tile was found after it was queued.
+    if( cost > tiles[curr].cost ) continue;
+    if( cost > 0 && !viewer.can_enter_tile( curr ) ) continue;
+    for( e_direction const d : enum_values<e_direction> ) {
+      point const from = curr.moved( d );
+      if( !tiles.exists( from ) ) continue;
+      e_direction const toward = reverse_direction( d );
+      int const proposed =
+          cost + viewer.travel_cost( from, toward );
+      Tile& tile = tiles[from];
+      if( tile.cost != -1 ) {
+        if( proposed > tile.cost ) continue;
+        // Prefer cardinal movements when costs are equal since
+        // they look more natural; the A* search does the same.
+        if( proposed == tile.cost &&
+            ( !tile.next.has_value() ||
+              !to_diagonal( toward ).has_value() ||
+              to_diagonal( *tile.next ).has_value() ) )
+          continue;
+      }
+      bool const requeue = ( tile.cost != proposed );
+      tile.cost          = proposed;
+      tile.next          = toward;
+      if( requeue )
+        todo.push( { .cost = proposed, .tile = from } );
+    }
+  }
+}
+
+} // namespace
+
+/****************************************************************
+** FlowField
+*****************************************************************/
+maybe<e_direction> FlowField::direction_from(
+    point const tile ) const {
+  if( !tiles_.exists( tile ) ) return nothing;
+  return tiles_[tile].next;
+}
+
+maybe<int> FlowField::cost_from( point const tile ) const {
+  if( !tiles_.exists( tile ) ) return nothing;
+  int const cost = tiles_[tile].cost;
+  if( cost == -1 ) return nothing;
+  return cost;
+}
+
+maybe<GotoPath> FlowField::path_from( point const src ) const {
+  if( !cost_from( src ).has_value() ) return nothing;
+  GotoPath res;
+  auto& reverse_path = res.reverse_path;
+  Delta const size   = tiles_.size();
+  for( point p = src; tiles_[p].next.has_value(); ) {
+    p = p.moved( *tiles_[p].next );
+    reverse_path.push_back( p );
+    // Costs strictly decrease along the field, so this should
+    // never happen, but guard against an infinite loop.
+    CHECK_LE( ssize( reverse_path ), size.w * size.h );
+  }
+  rg::reverse( reverse_path );
+  res.meta.tiles_touched = reverse_path.size();
+  return res;
+}
+
+/****************************************************************
+** Public API.
+*****************************************************************/
+FlowField compute_flow_field( IGotoMapViewer const& viewer,
+                              Delta const world_size,
+                              point const dst ) {
+  FlowField res;
+  res.tiles_ = gfx::matrix<FlowField::Tile>( world_size );
+  CHECK( res.tiles_.exists( dst ),
+         "flow field destination {} is not on the map.", dst );
+  res.tiles_[dst].cost = 0;
+  Queue todo;
+  todo.push( { .cost = 0, .tile = dst } );
+  fill_flow_field( viewer, res.tiles_, todo );
+  return res;
+}
+
+FlowField compute_harbor_flow_field(
+    IGotoMapViewer const& viewer, Delta const world_size ) {
+  FlowField res;
+  res.tiles_ = gfx::matrix<FlowField::Tile>( world_size );
+  Queue todo;
+  point p;
+  for( p.y = 0; p.y < world_size.h; ++p.y ) {
+    for( p.x = 0; p.x < world_size.w; ++p.x ) {
+      if( !viewer.can_enter_tile( p ) ) continue;
+      if( !viewer.is_sea_lane_launch_point( p ).has_value() )
+        continue;
+      res.tiles_[p].cost = 0;
+      todo.push( { .cost = 0, .tile = p } );
+    }
+  }
+  fill_flow_field( viewer, res.tiles_, todo );
+  return res;
+}
+
+} // namespace rn
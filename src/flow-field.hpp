@@ -0,0 +1,87 @@
+/****************************************************************
+**flow-field.hpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Shared paths to a single destination.
+*
+*****************************************************************/
+#pragma once
+
+// rds
+#include "goto.rds.hpp"
+
+// Revolution Now
+#include "maybe.hpp"
+
+// gfx
+#include "gfx/cartesian.hpp"
+#include "gfx/matrix.hpp"
+
+namespace rn {
+
+/****************************************************************
+** Fwd. Decls.
+*****************************************************************/
+struct IGotoMapViewer;
+
+/****************************************************************
+** FlowField
+*****************************************************************/
+// A flow field holds, for each tile on the map, the direction
+// that a unit on that tile should move in order to take the
+// cheapest path to a given destination. It is computed with a
+// single search outward from the destination, and once computed,
+// the path for any number of units heading to that destination
+// can be read off of it without doing any further searching.
+//
+// It uses the same cost model as the goto A* search, and so the
+// paths that it yields are just as good, though when there are
+// multiple optimal paths it may not pick the same one.
+struct FlowField {
+  FlowField() = default;
+
+  // Nothing if no path exists from the tile.
+  [[nodiscard]] maybe<e_direction> direction_from(
+      gfx::point tile ) const;
+
+  // Nothing if no path exists from the tile.
+  [[nodiscard]] maybe<int> cost_from( gfx::point tile ) const;
+
+  // Follows the field from the source tile to the destination
+  // and returns the resulting path in the same format as the
+  // goto searches. Nothing is returned if no path exists.
+  [[nodiscard]] maybe<GotoPath> path_from(
+      gfx::point src ) const;
+
+ private:
+  friend FlowField compute_flow_field(
+      IGotoMapViewer const& viewer, Delta world_size,
+      gfx::point dst );
+
+  friend FlowField compute_harbor_flow_field(
+      IGotoMapViewer const& viewer, Delta world_size );
+
+  struct Tile {
+    int cost = -1; // -1 means unreachable.
+    maybe<e_direction> next;
+  };
+
+  gfx::matrix<Tile> tiles_;
+};
+
+// Computes the field for reaching the destination tile, which
+// must be on the map. As with the A* search, the unit is always
+// allowed to attempt to enter the destination tile itself.
+[[nodiscard]] FlowField compute_flow_field(
+    IGotoMapViewer const& viewer, Delta world_size,
+    gfx::point dst );
+
+// Computes the field for reaching the nearest sea lane launch
+// point, i.e. for sailing to the harbor.
+[[nodiscard]] FlowField compute_harbor_flow_field(
+    IGotoMapViewer const& viewer, Delta world_size );
+
+} // namespace rn
@@ -36,6 +36,7 @@
 #include "panel-plane.hpp"
 #include "plane-stack.hpp"
 #include "rcl-game-storage.hpp" // FIXME: temporary
+#include "replay.hpp"
 #include "save-game.hpp"
 #include "terminal.hpp" // FIXME
 #include "test-map.hpp" // FIXME
@@ -172,8 +173,15 @@ using LoaderFunc = base::function_ref<wait_bool(
     IEngine&, Planes&, SS& ss, IGui& gui, RootState& saved,
     lua::state& lua )>;
 
+wait_bool load_from_slot( SS& ss, IGui& gui, RootState& saved,
+                          int const slot ) {
+  co_return co_await load_from_slot_interactive(
+      ss, gui, RclGameStorageLoad( ss ), saved, slot );
+}
+
 wait<> run_game( IEngine& engine, Planes& planes, IGui& gui,
-                 LoaderFunc const loader ) {
+                 LoaderFunc const loader,
+                 maybe<ReplaySession&> const replay = nothing ) {
   // This is the entire (serializable) state representing a game.
   SS ss;
   // This will hold the state of the game the last time it was
@@ -207,17 +215,34 @@ wait<> run_game( IEngine& engine, Planes& planes, IGui& gui,
     // have been displayed if appropriate.
     co_return;
 
-  TS ts( planes, gui, combat, colony_viewer, saved );
+  // When recording or replaying, all of the decisions made by
+  // the agents and all user input go through the replay session,
+  // and there are no human players.
+  maybe<ReplayGui> replay_gui;
+  if( replay.has_value() ) {
+    put_human_players_under_ai_control( ss );
+    replay_gui.emplace( gui, replay->decisions() );
+  }
+  IGui& game_gui = replay_gui.has_value() ? *replay_gui : gui;
+
+  TS ts( planes, game_gui, combat, colony_viewer, saved );
 
   NativeAgents native_agents =
-      create_native_agents( ss, engine.rand() );
+      replay.has_value()
+          ? create_replay_native_agents( *replay, ss,
+                                         engine.rand() )
+          : create_native_agents( ss, engine.rand() );
   auto _1 = ts.set_native_agents( native_agents );
 
   // This one needs to run after the loader because it needs to
   // know which nations are human.
   Agents agents =
-      create_agents( engine, ss, non_rendering_map_updater,
-                     planes, gui, engine.rand() );
+      replay.has_value()
+          ? create_replay_agents(
+                *replay, engine, ss, non_rendering_map_updater,
+                planes, game_gui, engine.rand() )
+          : create_agents( engine, ss, non_rendering_map_updater,
+                           planes, game_gui, engine.rand() );
   auto _2 = ts.set_agents( agents );
 
   rr::Renderer& renderer =
@@ -250,7 +275,7 @@ wait<> run_game( IEngine& engine, Planes& planes, IGui& gui,
       cycle_map_colors_thread( renderer, gui, cycling_enabled );
 
   // TODO: temporary
-  ensure_human_player( ss.players );
+  if( !replay.has_value() ) ensure_human_player( ss.players );
 
   // We could create a new terminal object here which would clear
   // the history, but there doesn't seem to be a good reason to
@@ -301,13 +326,28 @@ wait<> run_game( IEngine& engine, Planes& planes, IGui& gui,
   // See the comments in ss/meta for an overview of how this
   // mechanism works.
   rng::seed const gameplay_seed = [&] {
-    if( !ss.meta.seeds.gameplay_seed.has_value() )
-      return rng::entropy::from_random_device();
-    return exchange( ss.meta.seeds.gameplay_seed, nothing )
-        .value();
+    rng::seed const seed = [&] {
+      if( !ss.meta.seeds.gameplay_seed.has_value() )
+        return rng::entropy::from_random_device();
+      return exchange( ss.meta.seeds.gameplay_seed, nothing )
+          .value();
+    }();
+    // A replay must use the seed that it was recorded with.
+    if( replay.has_value() )
+      return replay->start( ss.root, seed );
+    return seed;
   }();
-  lg.info( "starting game with rng seed: {}", gameplay_seed );
+  lg.info( "starting game with rng seed: {} (engine: {})",
+           gameplay_seed, ss.meta.seeds.engine );
+  engine.rand().set_engine( ss.meta.seeds.engine );
   engine.rand().reseed( gameplay_seed );
+  // Map generation (which happens outside of gameplay) expects
+  // the default engine so that map seeds keep producing the
+  // same maps.
+  SCOPE_EXIT {
+    engine.rand().set_engine( rng::e_rng_engine::mersenne );
+    engine.rand().reseed( rng::entropy::from_random_device() );
+  };
 
   // All of the above needs to stay alive, so we must wait.
   //
@@ -325,8 +365,21 @@ wait<> run_game( IEngine& engine, Planes& planes, IGui& gui,
   //   * ...
   //
   // But this should not be done when loading an existing game.
-  auto const loop = [&] { return turn_loop( engine, ss, ts ); };
+  auto const loop = [&] {
+    if( replay.has_value() )
+      return turn_loop( engine, ss, ts, *replay );
+    return turn_loop( engine, ss, ts );
+  };
   (void)co_await co::try_<game_quit_interrupt>( loop );
+
+  if( replay.has_value() ) {
+    lg.info( "turn phase timings:\n{}", replay->phase_report() );
+    if( auto const finished = replay->finish( ss.root );
+        !finished.valid() )
+      lg.error( "{}", finished.error() );
+    else if( replay->mode() == e_replay_mode::replay )
+      lg.info( "replay matches the recording." );
+  }
 }
 
 wait<> handle_mode( IEngine& engine, Planes& planes, IGui& gui,
@@ -367,11 +420,44 @@ wait<> handle_mode( IEngine& engine, Planes& planes, IGui& gui,
             co_return false;
         }
         CHECK( slot.has_value() );
-        co_return co_await load_from_slot_interactive(
-            ss, gui, RclGameStorageLoad( ss ), saved, *slot );
+        co_return co_await load_from_slot( ss, gui, saved,
+                                           *slot );
       } );
 }
 
+wait<> handle_mode( IEngine& engine, Planes& planes, IGui& gui,
+                    StartMode::record_replay const& record ) {
+  ReplaySession session = ReplaySession::recorder(
+      record.file, record.slot, record.num_turns );
+  co_await run_game(
+      engine, planes, gui,
+      [&]( IEngine&, Planes&, SS& ss, IGui& gui,
+           RootState& saved, lua::state& ) {
+        return load_from_slot( ss, gui, saved, record.slot );
+      },
+      session );
+}
+
+wait<> handle_mode( IEngine& engine, Planes& planes, IGui& gui,
+                    StartMode::replay const& replay ) {
+  base::expect<ReplayLog> log = load_replay_log( replay.file );
+  if( !log.has_value() ) {
+    co_await gui.message_box( "Failed to load replay {}: {}",
+                              replay.file, log.error() );
+    co_return;
+  }
+  int const slot = log->slot;
+  ReplaySession session =
+      ReplaySession::replayer( std::move( *log ) );
+  co_await run_game(
+      engine, planes, gui,
+      [&]( IEngine&, Planes&, SS& ss, IGui& gui,
+           RootState& saved, lua::state& ) {
+        return load_from_slot( ss, gui, saved, slot );
+      },
+      session );
+}
+
 } // namespace
 
 /****************************************************************
@@ -203,4 +203,20 @@ GLAD_GL_METHOD( CheckFramebufferStatus, GLenum,
 
 GLAD_GL_METHOD( ActiveTexture, void, ( ( GLenum, texture ) ) );
 
+GLAD_GL_METHOD( MapBufferRange, void*,
+                ( ( GLenum, target ), ( GLintptr, offset ),
+                  ( GLsizeiptr, length ),
+                  ( GLbitfield, access ) ) );
+
+GLAD_GL_METHOD( UnmapBuffer, GLboolean, ( ( GLenum, target ) ) );
+
+GLAD_GL_METHOD( FenceSync, GLsync,
+                ( ( GLenum, condition ), ( GLbitfield, flags ) ) );
+
+GLAD_GL_METHOD( ClientWaitSync, GLenum,
+                ( ( GLsync, sync ), ( GLbitfield, flags ),
+                  ( GLuint64, timeout ) ) );
+
+GLAD_GL_METHOD( DeleteSync, void, ( ( GLsync, sync ) ) );
+
 } // namespace gl
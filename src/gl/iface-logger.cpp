@@ -299,4 +299,24 @@ LOG_AND_CALL_GL_METHOD( gl_CheckFramebufferStatus, GLenum,
 LOG_AND_CALL_GL_METHOD( gl_ActiveTexture, void,
                         ( ( GLenum, texture ) ) );
 
+LOG_AND_CALL_GL_METHOD( gl_MapBufferRange, void*,
+                        ( ( GLenum, target ),
+                          ( GLintptr, offset ),
+                          ( GLsizeiptr, length ),
+                          ( GLbitfield, access ) ) );
+
+LOG_AND_CALL_GL_METHOD( gl_UnmapBuffer, GLboolean,
+                        ( ( GLenum, target ) ) );
+
+LOG_AND_CALL_GL_METHOD( gl_FenceSync, GLsync,
+                        ( ( GLenum, condition ),
+                          ( GLbitfield, flags ) ) );
+
+LOG_AND_CALL_GL_METHOD( gl_ClientWaitSync, GLenum,
+                        ( ( GLsync, sync ), ( GLbitfield, flags ),
+                          ( GLuint64, timeout ) ) );
+
+LOG_AND_CALL_GL_METHOD( gl_DeleteSync, void,
+                        ( ( GLsync, sync ) ) );
+
 } // namespace gl
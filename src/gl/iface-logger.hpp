@@ -170,6 +170,20 @@ struct OpenGLWithLogger : IOpenGL {
   GLenum gl_CheckFramebufferStatus( GLenum target ) override;
 
   void gl_ActiveTexture( GLenum texture ) override;
+
+  void* gl_MapBufferRange( GLenum target, GLintptr offset,
+                           GLsizeiptr length,
+                           GLbitfield access ) override;
+
+  GLboolean gl_UnmapBuffer( GLenum target ) override;
+
+  GLsync gl_FenceSync( GLenum condition,
+                       GLbitfield flags ) override;
+
+  GLenum gl_ClientWaitSync( GLsync sync, GLbitfield flags,
+                            GLuint64 timeout ) override;
+
+  void gl_DeleteSync( GLsync sync ) override;
 };
 
 static_assert( !std::is_abstract_v<OpenGLWithLogger> );
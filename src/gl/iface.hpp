@@ -192,6 +192,20 @@ struct IOpenGL {
   virtual GLenum gl_CheckFramebufferStatus( GLenum target ) = 0;
 
   virtual void gl_ActiveTexture( GLenum texture ) = 0;
+
+  virtual void* gl_MapBufferRange( GLenum target, GLintptr offset,
+                                   GLsizeiptr length,
+                                   GLbitfield access ) = 0;
+
+  virtual GLboolean gl_UnmapBuffer( GLenum target ) = 0;
+
+  virtual GLsync gl_FenceSync( GLenum condition,
+                               GLbitfield flags ) = 0;
+
+  virtual GLenum gl_ClientWaitSync( GLsync sync, GLbitfield flags,
+                                    GLuint64 timeout ) = 0;
+
+  virtual void gl_DeleteSync( GLsync sync ) = 0;
 };
 
 /****************************************************************
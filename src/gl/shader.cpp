@@ -157,11 +157,18 @@ void ProgramNonTyped::free_resource() {
 
 void ProgramNonTyped::run( VertexArrayNonTyped const& vert_array,
                            int num_vertices ) const {
+  run( vert_array, /*first_vertex=*/0, num_vertices );
+}
+
+void ProgramNonTyped::run( VertexArrayNonTyped const& vert_array,
+                           int first_vertex,
+                           int num_vertices ) const {
+  DCHECK( first_vertex >= 0 );
   DCHECK( num_vertices >= 0 );
   use();
   auto binder = vert_array.bind();
-  GL_CHECK(
-      CALL_GL( gl_DrawArrays, GL_TRIANGLES, 0, num_vertices ) );
+  GL_CHECK( CALL_GL( gl_DrawArrays, GL_TRIANGLES, first_vertex,
+                     num_vertices ) );
 }
 
 int ProgramNonTyped::num_input_attribs() const {
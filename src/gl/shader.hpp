@@ -94,6 +94,9 @@ struct ProgramNonTyped : base::zero<ProgramNonTyped, ObjId> {
   void run( VertexArrayNonTyped const& vert_array,
             int num_vertices ) const;
 
+  void run( VertexArrayNonTyped const& vert_array,
+            int first_vertex, int num_vertices ) const;
+
  protected:
   ProgramNonTyped( ObjId id );
 
@@ -144,6 +147,17 @@ struct Program : ProgramNonTyped {
     this->ProgramNonTyped::run( vert_array, num_vertices );
   }
 
+  template<typename... VertexBuffers>
+  void run( VertexArray<VertexBuffers...> const& vert_array,
+            int first_vertex, int num_vertices )
+  requires std::is_same_v<
+      InputAttribTypeList,
+      typename VertexArray<VertexBuffers...>::AttribTypeList>
+  {
+    this->ProgramNonTyped::run( vert_array, first_vertex,
+                                num_vertices );
+  }
+
   /* clang-format off */
 private:
   /* clang-format on */
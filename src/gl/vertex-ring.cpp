@@ -0,0 +1,135 @@
+/****************************************************************
+**vertex-ring.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Streams per-frame vertex data through a ring of
+*              regions in a single vertex buffer.
+*
+*****************************************************************/
+#include "vertex-ring.hpp"
+
+// gl
+#include "error.hpp"
+#include "iface.hpp"
+
+// C++ standard library
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+
+namespace gl {
+
+namespace {
+
+// One second. If the GPU is that far behind then something is
+// wrong, but we keep waiting anyway since proceeding would cor-
+// rupt vertex data that is still in use.
+GLuint64 constexpr kFenceTimeoutNanos = 1'000'000'000;
+
+GLbitfield constexpr kMapFlags =
+    GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT |
+    GL_MAP_UNSYNCHRONIZED_BIT;
+
+} // namespace
+
+/****************************************************************
+** Fence
+*****************************************************************/
+Fence::Fence() {
+  GLsync const sync = GL_CHECK(
+      CALL_GL( gl_FenceSync, GL_SYNC_GPU_COMMANDS_COMPLETE, 0 ) );
+  CHECK( sync != nullptr );
+  *this = Fence( sync );
+}
+
+Fence::Fence( void* const sync )
+  : base::zero<Fence, void*>( sync ) {}
+
+void Fence::free_resource() {
+  GLsync const sync = static_cast<GLsync>( resource() );
+  CHECK( sync != nullptr );
+  GL_CHECK( CALL_GL( gl_DeleteSync, sync ) );
+}
+
+void Fence::wait() const {
+  GLsync const sync = static_cast<GLsync>( resource() );
+  while( true ) {
+    GLenum const res = GL_CHECK(
+        CALL_GL( gl_ClientWaitSync, sync,
+                 GL_SYNC_FLUSH_COMMANDS_BIT, kFenceTimeoutNanos ) );
+    switch( res ) {
+      case GL_ALREADY_SIGNALED:
+      case GL_CONDITION_SATISFIED:
+        return;
+      case GL_TIMEOUT_EXPIRED:
+        continue;
+      default:
+        FATAL( "glClientWaitSync failed with result {}.", res );
+    }
+  }
+}
+
+/****************************************************************
+** VertexRingNonTyped
+*****************************************************************/
+void VertexRingNonTyped::grow( VertexBufferNonTyped const& buffer,
+                               long const size_bytes,
+                               long const stride ) {
+  long capacity = max( size_bytes, region_capacity_bytes_ * 2 );
+  // Regions must start on a vertex boundary so that they can be
+  // addressed by the first index of the draw call.
+  capacity = ( ( capacity + stride - 1 ) / stride ) * stride;
+  // Orphaning the buffer gives us new storage, so any fences on
+  // the old one no longer matter.
+  for( auto& fence : fences_ ) fence.reset();
+  auto const binder = buffer.bind();
+  GL_CHECK( CALL_GL( gl_BufferData, GL_ARRAY_BUFFER,
+                     capacity * kNumRegions, nullptr,
+                     GL_STREAM_DRAW ) );
+  region_capacity_bytes_ = capacity;
+  region_                = 0;
+}
+
+int VertexRingNonTyped::upload_impl(
+    VertexBufferNonTyped const& buffer, void const* const data,
+    long const size_bytes, long const stride ) {
+  CHECK_GT( stride, 0 );
+  CHECK_GE( size_bytes, 0 );
+  CHECK_EQ( size_bytes % stride, 0 );
+  if( size_bytes > region_capacity_bytes_ )
+    grow( buffer, size_bytes, stride );
+  else
+    region_ = ( region_ + 1 ) % kNumRegions;
+  auto& fence = fences_[region_];
+  if( fence.has_value() ) {
+    fence->wait();
+    fence.reset();
+  }
+  long const offset = region_ * region_capacity_bytes_;
+  if( size_bytes == 0 ) return offset / stride;
+  needs_fence_      = true;
+  auto const binder = buffer.bind();
+  void* const dst   = GL_CHECK(
+      CALL_GL( gl_MapBufferRange, GL_ARRAY_BUFFER, offset,
+               size_bytes, kMapFlags ) );
+  CHECK( dst != nullptr );
+  memcpy( dst, data, size_bytes );
+  // This can return false if the buffer contents got corrupted
+  // while mapped, e.g. due to a display mode change. The data
+  // will be re-uploaded on the next frame anyway, so there isn't
+  // much that we need to do about it.
+  GL_CHECK( CALL_GL( gl_UnmapBuffer, GL_ARRAY_BUFFER ) );
+  return offset / stride;
+}
+
+void VertexRingNonTyped::fence() {
+  if( !needs_fence_ ) return;
+  needs_fence_     = false;
+  fences_[region_] = Fence();
+}
+
+} // namespace gl
@@ -0,0 +1,110 @@
+/****************************************************************
+**vertex-ring.hpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Streams per-frame vertex data through a ring of
+*              regions in a single vertex buffer.
+*
+*****************************************************************/
+#pragma once
+
+// gl
+#include "vertex-buffer.hpp"
+
+// base
+#include "base/maybe.hpp"
+#include "base/zero.hpp"
+
+// C++ standard library
+#include <array>
+#include <span>
+
+namespace gl {
+
+/****************************************************************
+** Fence
+*****************************************************************/
+// Wraps a GLsync. The handle is held as a void* so that this
+// header does not need to pull in the GL loader.
+struct Fence : base::zero<Fence, void*> {
+  // Inserts a new fence into the command stream.
+  Fence();
+
+  // Blocks until the GPU has processed all commands issued before
+  // the fence was inserted.
+  void wait() const;
+
+ private:
+  Fence( void* sync );
+
+ private:
+  // Implement base::zero.
+  friend base::zero<Fence, void*>;
+
+  void free_resource();
+};
+
+/****************************************************************
+** VertexRingNonTyped
+*****************************************************************/
+// Vertex data that gets rewritten every frame is uploaded into
+// one of kNumRegions regions of the buffer in turn, instead of
+// re-specifying the whole buffer with glBufferData each time.
+// Each region is written through an unsynchronized mapping, and
+// a fence placed after the draw call that reads it guards it
+// against being overwritten before the GPU is done with it. When
+// the data outgrows a region then the buffer is orphaned and re-
+// allocated with larger regions.
+//
+// The caller must draw starting from the vertex index returned
+// by upload, then call fence.
+struct VertexRingNonTyped {
+  static int constexpr kNumRegions = 3;
+
+  // Inserts a fence guarding the region most recently uploaded.
+  // Must be called after the draw call that reads from it.
+  void fence();
+
+  int region() const { return region_; }
+
+  long region_capacity_bytes() const {
+    return region_capacity_bytes_;
+  }
+
+ protected:
+  // Returns the index of the first vertex written, i.e. the
+  // offset of the region divided by the stride.
+  int upload_impl( VertexBufferNonTyped const& buffer,
+                   void const* data, long size_bytes,
+                   long stride );
+
+ private:
+  void grow( VertexBufferNonTyped const& buffer, long size_bytes,
+             long stride );
+
+  long region_capacity_bytes_ = 0;
+  int region_                 = 0;
+  bool needs_fence_           = false;
+  std::array<base::maybe<Fence>, kNumRegions> fences_;
+};
+
+/****************************************************************
+** VertexRing
+*****************************************************************/
+template<typename VertexType>
+struct VertexRing : VertexRingNonTyped {
+  using vertex_type = VertexType;
+
+  [[nodiscard]] int upload(
+      VertexBuffer<VertexType> const& buffer,
+      std::span<VertexType const> data ) {
+    return upload_impl( buffer, data.data(),
+                        data.size() * sizeof( VertexType ),
+                        sizeof( VertexType ) );
+  }
+};
+
+} // namespace gl
@@ -11,21 +11,77 @@
 #pragma once
 
 // Revolution Now
+#include "flow-field.hpp"
 #include "goto.rds.hpp"
 
 // ss
 #include "ss/goto.rds.hpp"
 #include "ss/unit-id.hpp"
 
+// gfx
+#include "gfx/cartesian.hpp"
+
+// C++ standard library
+#include <map>
+
 namespace rn {
 
+enum class e_player;
+enum class e_unit_type;
+
 struct GotoExecution {
   goto_target target;
   GotoPath path;
 };
 
+// Counts how paths were (re)computed. Every repair is a full
+// search that was avoided.
+struct GotoStats {
+  int full_searches    = 0;
+  int repairs          = 0;
+  int flow_fields      = 0;
+  int flow_field_paths = 0;
+};
+
+// Identifies the flow fields that can be shared between units.
+// Note that this does not include the kind of visibility that
+// the path finding is done with; that is assumed to be the same
+// for all units that share a registry.
+struct FlowFieldKey {
+  e_player player       = {};
+  e_unit_type unit_type = {};
+  // If this is false then the destination is the harbor.
+  bool to_tile    = {};
+  gfx::point tile = {};
+
+  [[maybe_unused]] auto operator<=>(
+      FlowFieldKey const& ) const = default;
+};
+
+struct CachedFlowField {
+  // A field is only computed once a second unit asks for a path
+  // to the same destination, since if only one unit is going
+  // there then a normal search is much cheaper.
+  UnitId first_unit = {};
+  maybe<FlowField> field;
+};
+
+// Flow fields for destinations that multiple units are heading
+// to. The paths are validated as units move along them just as
+// with the searched paths, but the fields are dropped at the
+// start of each turn, since by then units will have moved and
+// tiles will have been explored, and whenever the land/water
+// layout of the map changes.
+struct FlowFieldCache {
+  int turn       = -1;
+  int generation = -1;
+  std::map<FlowFieldKey, CachedFlowField> fields;
+};
+
 struct GotoRegistry {
   std::unordered_map<UnitId, GotoExecution> units;
+  FlowFieldCache flow_fields;
+  GotoStats stats;
 };
 
 } // namespace rn
@@ -13,6 +13,7 @@
 // Revolution Now
 #include "co-wait.hpp"
 #include "connectivity.hpp"
+#include "flow-field.hpp"
 #include "goto-registry.hpp"
 #include "goto-viewer.hpp"
 #include "harbor-units.hpp"
@@ -34,6 +35,7 @@
 #include "ss/players.rds.hpp"
 #include "ss/ref.hpp"
 #include "ss/terrain.hpp"
+#include "ss/turn.rds.hpp"
 #include "ss/unit.hpp"
 #include "ss/units.hpp"
 
@@ -49,6 +51,7 @@
 #include "base/timer.hpp"
 
 // C++ standard library
+#include <limits>
 #include <queue>
 #include <ranges>
 #include <unordered_map>
@@ -91,14 +94,28 @@ template<typename T>
 using PriorityQueue =
     priority_queue<T, std::vector<T>, std::greater<T>>;
 
+// When a unit's path gets blocked we first try to repair it by
+// searching only for a way around the blocked part; these limit
+// how far ahead on the old path we look for a tile to rejoin and
+// how much searching we do before giving up and falling back to
+// a full search.
+int constexpr kRepairLookahead     = 8;
+int constexpr kRepairMaxIterations = 256;
+
 // NOTE: here we are using a slightly different version of A*
 // relative to what is on the wikipedia article. Since our pri-
 // ority queue doesn't support updating priorities of nodes in
 // the queue (which happens when we find a shorter path to a pre-
 // vious tile) we will just re-insert that tile.
+//
+// If max_iterations is reached before the destination is found
+// then the search fails.
 GotoPath a_star( IGotoMapViewer const& viewer, point const src,
-                 point const dst ) {
+                 point const dst,
+                 int const max_iterations =
+                     numeric_limits<int>::max() ) {
   GotoPath goto_path;
+  bool found = false;
   unordered_map<point /*to*/, TileWithCost /*from*/> explored;
   PriorityQueue<TileWithCost> todo;
   auto const push = [&]( point const from, point const to,
@@ -111,12 +128,16 @@ GotoPath a_star( IGotoMapViewer const& viewer, point const src,
       .cost = cost, .is_diagonal = is_diagonal, .tile = from };
   };
   push( src, src, e_cdirection::c, 0 );
-  while( !todo.empty() ) {
+  while( !todo.empty() &&
+         goto_path.meta.iterations < max_iterations ) {
     ++goto_path.meta.iterations;
     point const curr = todo.top().tile;
     todo.pop();
     CHECK( explored.contains( curr ) );
-    if( curr == dst ) break;
+    if( curr == dst ) {
+      found = true;
+      break;
+    }
     for( e_direction const d : enum_values<e_direction> ) {
       point const moved = curr.moved( d );
       // This means that, whatever the target tile is, we will
@@ -153,7 +174,7 @@ GotoPath a_star( IGotoMapViewer const& viewer, point const src,
   // Note: iterations if filled in above.
   goto_path.meta.queue_size_at_end = todo.size();
   goto_path.meta.tiles_touched     = explored.size();
-  if( !explored.contains( dst ) ) return goto_path;
+  if( !found ) return goto_path;
   auto& reverse_path = goto_path.reverse_path;
   reverse_path.reserve( viewer.heuristic_cost( src, dst ) * 9 );
   for( point p = dst; p != src; p = explored[p].tile )
@@ -239,14 +260,131 @@ GotoPath sea_lane_search( IGotoMapViewer const& viewer,
   return goto_path;
 }
 
+// Called when the next step on a unit's path can't be taken be-
+// cause the tile can no longer be entered (e.g. a foreign unit
+// moved onto it or exploring revealed that it is not passable).
+// Instead of throwing away the path and searching again all the
+// way to the target, this finds the nearest tile a bit further
+// along the path that can still be entered and splices in a
+// path to it from the unit's current position. Returns false if
+// that could not be done, in which case a full search is needed.
+//
+// The result is not necessarily optimal, but since it only de-
+// viates from an optimal path locally it is close, and this is
+// much cheaper when the target is far away.
+[[nodiscard]] bool try_repair_goto( IGotoMapViewer const& viewer,
+                                    GotoRegistry& registry,
+                                    UnitId const unit_id,
+                                    goto_target const& target,
+                                    point const unit_tile ) {
+  auto const it = registry.units.find( unit_id );
+  if( it == registry.units.end() ) return false;
+  vector<point>& reverse_path = it->second.path.reverse_path;
+  if( reverse_path.empty() ) return false;
+  // If the unit is no longer adjacent to its path then it has
+  // been moved by something else and the path is stale.
+  if( !unit_tile.direction_to( reverse_path.back() ) )
+    return false;
+  auto const is_rejoin_tile = [&]( point const p ) {
+    if( p == unit_tile ) return false;
+    // See the comment in a_star about entering the target.
+    if( auto const map = target.get_if<goto_target::map>();
+        map.has_value() && p == map->tile )
+      return true;
+    return viewer.can_enter_tile( p );
+  };
+  int const size = reverse_path.size();
+  int const last = std::max( size - kRepairLookahead, 0 );
+  for( int i = size - 1; i >= last; --i ) {
+    point const rejoin = reverse_path[i];
+    if( !is_rejoin_tile( rejoin ) ) continue;
+    GotoPath detour = a_star( viewer, unit_tile, rejoin,
+                              kRepairMaxIterations );
+    if( detour.reverse_path.empty() ) return false;
+    reverse_path.resize( i );
+    reverse_path.insert( reverse_path.end(),
+                         detour.reverse_path.begin(),
+                         detour.reverse_path.end() );
+    ++registry.stats.repairs;
+    lg.debug( "goto: repaired path for unit {} via {}.", unit_id,
+              rejoin );
+    return true;
+  }
+  return false;
+}
+
+// When multiple units are heading to the same destination then
+// this will compute a flow field for it (once) and return the
+// path for the unit from it. Returns nothing if the caller needs
+// to search for the path itself.
+maybe<GotoPath> flow_field_path(
+    SSConst const& ss, TerrainConnectivity const& connectivity,
+    IGotoMapViewer const& viewer, GotoRegistry& registry,
+    Unit const& unit, goto_target const& target,
+    point const unit_tile ) {
+  FlowFieldKey key{ .player    = unit.player_type(),
+                    .unit_type = unit.type() };
+  SWITCH( target ) {
+    CASE( map ) {
+      // We don't compute fields for tiles off of the map edge;
+      // those are the player asking to sail a certain way to the
+      // harbor, which is rare enough to just search for.
+      if( !ss.terrain.square_exists( map.tile ) ) return nothing;
+      key.to_tile = true;
+      key.tile    = map.tile;
+      break;
+    }
+    CASE( harbor ) { break; }
+  }
+  FlowFieldCache& cache = registry.flow_fields;
+  int const turn        = ss.turn.time_point.turns;
+  if( cache.turn != turn ||
+      cache.generation != connectivity.generation ) {
+    cache.fields.clear();
+    cache.turn       = turn;
+    cache.generation = connectivity.generation;
+  }
+  auto [it, inserted] = cache.fields.try_emplace( key );
+  CachedFlowField& cached = it->second;
+  if( inserted ) cached.first_unit = unit.id();
+  if( !cached.field.has_value() ) {
+    if( cached.first_unit == unit.id() ) return nothing;
+    Delta const world_size = ss.terrain.world_size_tiles();
+    ScopedTimer const timer( [&] {
+      return format( "flow field for {} computed", target );
+    } );
+    cached.field =
+        key.to_tile
+            ? compute_flow_field( viewer, world_size, key.tile )
+            : compute_harbor_flow_field( viewer, world_size );
+    ++registry.stats.flow_fields;
+  }
+  auto path = cached.field->path_from( unit_tile );
+  if( path.has_value() ) ++registry.stats.flow_field_paths;
+  return path;
+}
+
 // If no new path is found then the unit will be removed from the
 // registry.
-void try_new_goto( IGotoMapViewer const& viewer,
-                   GotoRegistry& registry, UnitId const unit_id,
+void try_new_goto( SSConst const& ss,
+                   TerrainConnectivity const& connectivity,
+                   IGotoMapViewer const& viewer,
+                   GotoRegistry& registry, Unit const& unit,
                    goto_target const& target,
                    point const unit_tile ) {
+  UnitId const unit_id = unit.id();
   lg.info( "goto: {}", target );
   registry.units.erase( unit_id );
+  if( auto path = flow_field_path( ss, connectivity, viewer,
+                                   registry, unit, target,
+                                   unit_tile );
+      path.has_value() ) {
+    if( path->reverse_path.empty() ) return;
+    registry.units[unit_id] = GotoExecution{
+      .target = target, .path = std::move( *path ) };
+    return;
+  }
+  ++registry.stats.full_searches;
   SWITCH( target ) {
     CASE( map ) {
       point const dst = map.tile;
@@ -620,21 +758,14 @@ EvolveGoto find_next_move_for_unit_with_goto_target(
   point const src =
       coord_for_unit_indirect_or_die( ss.units, unit_id );
 
-  // This is the one we will use when we want to see exactly what
-  // the player is seeing on screen, and is not necessarily the
-  // one being used in the IGotoMapViewer because of the "omni-
-  // scient goto" config option.
-  auto const real_viz = create_visibility_for(
-      ss, player_for_role( ss, e_player_role::viewer ) );
-  CHECK( real_viz );
-
   // Here we try twice, and this has two purposes. First, if the
   // unit's goto orders are new and its path hasn't been computed
   // yet, then the first attempt will fail and then we'll compute
   // the path and try again. But it is also needed for a unit
   // that already has a goto path, since as a unit explores
   // hidden tiles it may discover that its current path is no
-  // longer viable and may need to recompute a path. But if the
+  // longer viable and may need to recompute a path (which we
+  // first try to do by repairing the existing path). But if the
   // second attempt to compute a path still does not succeed then
   // there is not further viable path and we cancel.
   auto const go_or_reattempt =
@@ -642,7 +773,12 @@ EvolveGoto find_next_move_for_unit_with_goto_target(
           auto const& direction_fn ) -> EvolveGoto {
     if( auto const d = direction_fn(); d.has_value() )
       return EvolveGoto::move{ .to = *d };
-    try_new_goto( viewer, registry, unit_id, target, src );
+    if( try_repair_goto( viewer, registry, unit_id, target,
+                         src ) )
+      if( auto const d = direction_fn(); d.has_value() )
+        return EvolveGoto::move{ .to = *d };
+    try_new_goto( ss, connectivity, viewer, registry, unit,
+                  target, src );
     if( auto const d = direction_fn(); d.has_value() )
       return EvolveGoto::move{ .to = *d };
     return abort();
@@ -655,10 +791,15 @@ EvolveGoto find_next_move_for_unit_with_goto_target(
         auto& reverse_path =
             registry.units[unit_id].path.reverse_path;
         if( reverse_path.empty() ) return nothing;
+        // Don't pop the tile until we know that we're moving to
+        // it, since otherwise the path may get repaired.
         point const dst = reverse_path.back();
-        reverse_path.pop_back();
-        auto const d = src.direction_to( dst );
+        auto const d    = src.direction_to( dst );
         if( !d.has_value() ) return nothing;
+        auto const go = [&] {
+          reverse_path.pop_back();
+          return *d;
+        };
         // This means that, whatever the target tile is, we will
         // allow the unit to at least attempt to enter it. This
         // allows e.g. a ship to make landfall or a land unit to
@@ -669,8 +810,8 @@ EvolveGoto find_next_move_for_unit_with_goto_target(
         // lowed onto the tile then the goto orders will be
         // cleared, but that is ok because the user specifically
         // chose the target.
-        if( dst == map.tile ) return *d;
-        if( viewer.can_enter_tile( dst ) ) return *d;
+        if( dst == map.tile ) return go();
+        if( viewer.can_enter_tile( dst ) ) return go();
         return nothing;
       };
 
@@ -698,6 +839,15 @@ EvolveGoto find_next_move_for_unit_with_goto_target(
         // that tile and automatically attacking it. This should
         // not check-fail because our unit is adjacent to this
         // tile and so it should be clear.
+        //
+        // This is the visibility that shows exactly what the
+        // player is seeing on screen, which is not necessarily
+        // the one being used in the IGotoMapViewer because of
+        // the "omniscient goto" config option. It is only cre-
+        // ated here since it is not cheap to create.
+        auto const real_viz = create_visibility_for(
+            ss, player_for_role( ss, e_player_role::viewer ) );
+        CHECK( real_viz );
         UNWRAP_CHECK_T(
             GotoTargetSnapshot const new_snapshot,
             compute_goto_target_snapshot(
@@ -726,11 +876,11 @@ EvolveGoto find_next_move_for_unit_with_goto_target(
             registry.units[unit_id].path.reverse_path;
         if( reverse_path.empty() ) return nothing;
         point const dst = reverse_path.back();
-        reverse_path.pop_back();
-        auto const d = src.direction_to( dst );
+        auto const d    = src.direction_to( dst );
         if( !d.has_value() ) return nothing;
-        if( viewer.can_enter_tile( dst ) ) return *d;
-        return nothing;
+        if( !viewer.can_enter_tile( dst ) ) return nothing;
+        reverse_path.pop_back();
+        return *d;
       };
 
       // This is an optimization that tries to take advantage of
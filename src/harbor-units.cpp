@@ -85,13 +85,9 @@ int turns_needed_for_high_seas(
 
 vector<UnitId> units_in_harbor_view(
     UnitsState const& units_state, e_player player ) {
-  vector<UnitId> res;
-  for( auto const& [id, st] : units_state.euro_all() ) {
-    if( st->unit.player_type() == player &&
-        st->ownership.holds<UnitOwnership::harbor>() )
-      res.push_back( id );
-  }
-  return res;
+  set<UnitId> const& units = units_state.euro_units_for_player(
+      player, UnitOwnership::e::harbor );
+  return vector<UnitId>( units.begin(), units.end() );
 }
 
 template<typename Func>
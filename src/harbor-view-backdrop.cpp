@@ -156,22 +156,24 @@ wait<> HarborBackdrop::flag_thread() {
 
 void HarborBackdrop::draw( rr::Renderer& renderer,
                            Coord coord ) const {
-  rr::Painter painter = renderer.painter();
+  sky_retained_.draw( renderer, coord, size_, [&] {
+    rr::Painter painter = renderer.painter();
 
-  // Draw sky.
-  painter.draw_solid_rect( Rect::from( coord, size_ ),
-                           layout_.sky_color );
+    // Draw sky.
+    painter.draw_solid_rect( Rect::from( coord, size_ ),
+                             layout_.sky_color );
 
-  // Sun.
-  {
-    SCOPED_RENDERER_MOD_MUL( painter_mods.alpha, .5 );
-    tile_sprite( renderer, e_tile::harbor_sun, layout_.sun );
-  }
+    // Sun.
+    {
+      SCOPED_RENDERER_MOD_MUL( painter_mods.alpha, .5 );
+      tile_sprite( renderer, e_tile::harbor_sun, layout_.sun );
+    }
 
-  // Clouds.
-  for( auto const& [delta, tile] : layout_.clouds )
-    render_sprite( renderer, layout_.clouds_origin + delta,
-                   tile );
+    // Clouds.
+    for( auto const& [delta, tile] : layout_.clouds )
+      render_sprite( renderer, layout_.clouds_origin + delta,
+                     tile );
+  } );
 
   // Birds.
   if( birds_state_.has_value() ) {
@@ -187,14 +189,16 @@ void HarborBackdrop::draw( rr::Renderer& renderer,
     }
   }
 
-  // Ocean.
-  tile_sprite( renderer, e_tile::harbor_ocean, layout_.ocean );
+  ocean_retained_.draw( renderer, coord, size_, [&] {
+    // Ocean.
+    tile_sprite( renderer, e_tile::harbor_ocean, layout_.ocean );
 
-  // Land.
-  render_sprite( renderer, layout_.land_origin,
-                 e_tile::harbor_land_shadows );
-  render_sprite( renderer, layout_.land_origin,
-                 e_tile::harbor_land_dirt );
+    // Land.
+    render_sprite( renderer, layout_.land_origin,
+                   e_tile::harbor_land_shadows );
+    render_sprite( renderer, layout_.land_origin,
+                   e_tile::harbor_land_dirt );
+  } );
 
   // Flag. Needs to be behind houses because in some configura-
   // tions the bottom of the pole needs to go behind a building.
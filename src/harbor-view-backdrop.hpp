@@ -12,6 +12,7 @@
 
 // Revolution Now
 #include "harbor-view-entities.hpp"
+#include "views.hpp"
 #include "wait.hpp"
 
 // gfx
@@ -113,6 +114,12 @@ struct HarborBackdrop : public ui::View, public HarborSubView {
   Delta const size_;
   Layout const layout_;
 
+  // The sky and the ocean/land layers don't change after the
+  // layout is built, but they are interleaved with animated lay-
+  // ers, so each of them is drawn in retained mode separately.
+  ui::RetainedDrawing sky_retained_;
+  ui::RetainedDrawing ocean_retained_;
+
   // Birds animation.
   struct BirdsFrameState {
     int frame = {};
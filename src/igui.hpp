@@ -265,6 +265,9 @@ struct IGui {
       std::string const& title, ui::View& view ) = 0;
 
  protected:
+  // Needs to forward these to the gui that it wraps.
+  friend struct ReplayGui;
+
   // Do not call these directly, instead call the ones in the
   // next section that make it explicit in the name and return
   // type as to whether the user input is required or not (or if
@@ -67,37 +67,6 @@ WeightsMap immigrant_weights_for_level( int level ) {
   return weights;
 }
 
-struct UnitCounts {
-  int total_units                    = 0;
-  int units_on_dock                  = 0;
-  int units_in_cargo_of_harbor_ships = 0;
-};
-
-UnitCounts unit_counts( UnitsState const& units_state,
-                        e_player player ) {
-  UnitCounts counts;
-  for( auto const& [id, state] : units_state.euro_all() ) {
-    Unit const& unit = state->unit;
-    if( unit.player_type() != player ) continue;
-    ++counts.total_units;
-    if( auto harbor =
-            state->ownership.get_if<UnitOwnership::harbor>();
-        harbor.has_value() ) {
-      if( !unit.desc().ship ) {
-        ++counts.units_on_dock;
-      } else if( harbor->port_status
-                     .holds<PortStatus::in_port>() ) {
-        maybe<vector<UnitId>> cargo_units =
-            unit.units_in_cargo();
-        if( cargo_units.has_value() )
-          counts.units_in_cargo_of_harbor_ships +=
-              cargo_units->size();
-      }
-    }
-  }
-  return counts;
-}
-
 } // namespace
 
 wait<maybe<int>> ask_player_to_choose_immigrant(
@@ -159,8 +128,11 @@ CrossesCalculation compute_crosses(
   // venting the unit dock penalty by keeping a ship in harbor
   // and just moving units onto it each time one appears on dock
   // to immediately regain the dock bonus.
-  auto const [total_units, units_on_dock, harbor_cargo_units] =
-      unit_counts( units_state, player_type );
+  PlayerUnitStats const& stats =
+      units_state.unit_stats_for_player( player_type );
+  int const total_units        = stats.total;
+  int const units_on_dock      = stats.on_dock;
+  int const harbor_cargo_units = stats.in_cargo_of_ships_in_port;
   int const effective_units_on_dock =
       units_on_dock + harbor_cargo_units;
   int const dock_crosses_bonus =
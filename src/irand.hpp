@@ -14,6 +14,7 @@
 
 // rand
 #include "rand/entropy.hpp"
+#include "rand/random.rds.hpp"
 
 // luapp
 #include "luapp/ext-userdata.hpp"
@@ -73,6 +74,12 @@ struct IRand {
 
   virtual void reseed( rng::entropy const& seed ) = 0;
 
+  // Switches the underlying engine; subsequent reseeds will ap-
+  // ply to it. This is needed because games created before the
+  // counter-based engine existed must continue to use the old
+  // one in order to remain reproducible from their seeds.
+  virtual void set_engine( rng::e_rng_engine engine ) = 0;
+
   // Biased coin flip.  Returns true with probability p.
   [[nodiscard]] virtual bool bernoulli( double p ) = 0;
 
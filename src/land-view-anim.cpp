@@ -376,12 +376,13 @@ wait<> LandViewAnimator::slide_throttler_impl(
   co_await hold.arrive_and_wait();
 }
 
-wait<> LandViewAnimator::slide_throttler_slide( co::latch& hold,
-                                                GenericUnitId id,
-                                                e_direction d ) {
+wait<> LandViewAnimator::slide_throttler_slide(
+    co::latch& hold, GenericUnitId id, e_direction d,
+    maybe<point> const from ) {
   using Anim  = UnitAnimationState::slide;
   auto popper = add_unit_animation<Anim>( id );
   Anim& slide = popper.get();
+  slide.from  = from;
   co_await slide_throttler_impl( hold, d, slide.slide );
 }
 
@@ -489,8 +490,9 @@ wait<> LandViewAnimator::animate_action_primitive(
       break;
     }
     CASE( slide_unit ) {
-      auto& [unit_id, direction] = slide_unit;
-      co_await slide_throttler_slide( hold, unit_id, direction );
+      auto& [unit_id, direction, from] = slide_unit;
+      co_await slide_throttler_slide( hold, unit_id, direction,
+                                      from );
       break;
     }
     CASE( translocate_unit ) {
@@ -178,8 +178,8 @@ struct LandViewAnimator {
                                UnitSlide& slide );
 
   wait<> slide_throttler_slide( co::latch& hold,
-                                GenericUnitId id,
-                                e_direction d );
+                                GenericUnitId id, e_direction d,
+                                maybe<gfx::point> from );
 
   wait<> slide_throttler_talk( co::latch& hold, GenericUnitId id,
                                e_direction d );
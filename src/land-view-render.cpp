@@ -368,7 +368,10 @@ void LandViewRenderer::render_units_impl() const {
         break;
       case UnitAnimationState::e::slide:
         slide[id] = &anim.get<UnitAnimationState::slide>();
-        tiles_to_fade.insert( tile );
+        tiles_to_fade.insert(
+            slide[id]->from.has_value()
+                ? Coord::from_gfx( *slide[id]->from )
+                : tile );
         break;
       case UnitAnimationState::e::talk:
         talk[id] = &anim.get<UnitAnimationState::talk>();
@@ -476,16 +479,23 @@ void LandViewRenderer::render_units_impl() const {
       };
 
   auto render_slide = [&]( GenericUnitId id,
-                           UnitSlide const& slide ) {
+                           UnitSlide const& slide,
+                           maybe<point> const from ) {
     rr::e_render_buffer const buffer =
         should_render_sliding_unit_over_obfuscation( id )
             ? rr::e_render_buffer::normal
             : rr::e_render_buffer::entities;
     SCOPED_RENDERER_MOD_SET( buffer_mods.buffer, buffer );
-    Coord const mover_coord =
+    Coord const curr =
         coord_for_unit_indirect_or_die( ss_.units, id );
+    // If the unit has already been moved then it needs to be
+    // shifted back to where it is sliding from, similar to what
+    // we do for translocation below.
+    Coord const mover_coord =
+        from.has_value() ? Coord::from_gfx( *from ) : curr;
     // Now render the sliding unit.
     Delta const pixel_delta =
+        ( mover_coord - curr ) * g_tile_delta +
         ( ( mover_coord.moved( slide.direction ) -
             mover_coord ) *
           g_tile_delta )
@@ -545,12 +555,12 @@ void LandViewRenderer::render_units_impl() const {
   // #. Render units that are talking (front+slide).
   for( auto const& [id, anim] : talk ) {
     render_front( id );
-    render_slide( id, anim->slide );
+    render_slide( id, anim->slide, /*from=*/nothing );
   }
 
   // #. Render units that are sliding.
   for( auto const& [id, anim] : slide )
-    render_slide( id, anim->slide );
+    render_slide( id, anim->slide, anim->from );
 
   // #. Render units that are translocated.
   for( auto const& [id, anim] : translocate )
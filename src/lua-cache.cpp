@@ -0,0 +1,202 @@
+/****************************************************************
+**lua-cache.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Caches compiled Lua modules as bytecode.
+*
+*****************************************************************/
+#include "lua-cache.hpp"
+
+// luapp
+#include "luapp/error.hpp"
+#include "luapp/state.hpp"
+
+// Lua
+#include "lua.h"
+
+// base
+#include "base/hash.hpp"
+#include "base/logger.hpp"
+#include "base/to-str-ext-std.hpp"
+
+// C++ standard library
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+
+using namespace std;
+
+namespace rn {
+
+namespace {
+
+using ::base::lg;
+using ::base::maybe;
+using ::base::nothing;
+
+// Bump this whenever the layout of the header changes.
+uint32_t constexpr kCacheFormatVersion = 1;
+
+array<char, 4> constexpr kCacheMagic = { 'R', 'N', 'L', 'C' };
+
+// Note that Lua itself also validates the header of the bytecode
+// (version, format, and sizes of numeric types) when loading it,
+// but we check the version here anyway so that the entry gets
+// rewritten instead of just failing to load on every run.
+struct CacheHeader {
+  array<char, 4> magic    = {};
+  uint32_t format_version = 0;
+  uint32_t lua_version    = 0;
+  uint32_t unused         = 0;
+  uint64_t source_hash    = 0;
+  uint64_t source_size    = 0;
+  // How long it took to compile the source when this entry was
+  // written. Used to estimate the time saved.
+  int64_t compile_micros = 0;
+
+  bool operator==( CacheHeader const& ) const = default;
+};
+
+static_assert( is_trivially_copyable_v<CacheHeader> );
+
+struct CacheEntry {
+  CacheHeader header;
+  string bytecode;
+};
+
+maybe<string> read_binary_file( fs::path const& p ) {
+  ifstream in( p, ios::binary );
+  if( !in.good() ) return nothing;
+  string res( ( istreambuf_iterator<char>( in ) ),
+              istreambuf_iterator<char>() );
+  if( in.bad() ) return nothing;
+  return res;
+}
+
+fs::path cache_file_for( fs::path const& cache_folder,
+                         fs::path const& source_file ) {
+  // Use the relative part so that absolute source paths still
+  // land under the cache folder.
+  fs::path res = cache_folder / source_file.relative_path();
+  res += ".bc";
+  return res;
+}
+
+CacheHeader expected_header( string_view const source ) {
+  return CacheHeader{
+    .magic          = kCacheMagic,
+    .format_version = kCacheFormatVersion,
+    .lua_version    = LUA_VERSION_RELEASE_NUM,
+    .unused         = 0,
+    .source_hash    = base::hash_64_fnv1a( source ),
+    .source_size    = source.size(),
+    .compile_micros = 0 };
+}
+
+maybe<CacheEntry> read_cache_entry(
+    fs::path const& cache_file ) {
+  error_code ec;
+  if( !fs::exists( cache_file, ec ) ) return nothing;
+  maybe<string> contents = read_binary_file( cache_file );
+  if( !contents.has_value() ) return nothing;
+  if( contents->size() < sizeof( CacheHeader ) ) return nothing;
+  CacheEntry res;
+  memcpy( &res.header, contents->data(), sizeof( CacheHeader ) );
+  res.bytecode = contents->substr( sizeof( CacheHeader ) );
+  return res;
+}
+
+// Returns false if the entry could not be written. Writes to a
+// temporary file first so that a failure (or a concurrent reader)
+// never sees a partially written entry.
+bool write_cache_entry( fs::path const& cache_file,
+                        CacheEntry const& entry ) {
+  error_code ec;
+  fs::create_directories( cache_file.parent_path(), ec );
+  if( ec ) return false;
+  fs::path tmp = cache_file;
+  tmp += ".tmp";
+  {
+    ofstream out( tmp, ios::binary | ios::trunc );
+    if( !out.good() ) return false;
+    out.write( reinterpret_cast<char const*>( &entry.header ),
+               sizeof( CacheHeader ) );
+    out.write( entry.bytecode.data(), entry.bytecode.size() );
+    if( !out.good() ) return false;
+  }
+  fs::rename( tmp, cache_file, ec );
+  return !ec;
+}
+
+} // namespace
+
+/****************************************************************
+** Public API
+*****************************************************************/
+lua::rfunction load_lua_file_cached(
+    lua::state& st, fs::path const& source_file,
+    fs::path const& cache_folder, LuaCacheStats& stats ) {
+  using Clock = chrono::steady_clock;
+  maybe<string> const source = read_binary_file( source_file );
+  LUA_CHECK( st, source.has_value(), "failed to read file {}.",
+             source_file );
+  // Same chunk name that luaL_loadfile would use.
+  string const chunkname = "@" + source_file.string();
+  CacheHeader const expected = expected_header( *source );
+  fs::path const cache_file =
+      cache_file_for( cache_folder, source_file );
+
+  if( maybe<CacheEntry> const entry =
+          read_cache_entry( cache_file );
+      entry.has_value() ) {
+    CacheHeader header    = entry->header;
+    header.compile_micros = 0;
+    if( header == expected ) {
+      auto const start = Clock::now();
+      lua::lua_expect<lua::rfunction> func =
+          st.script.load_buffer_safe( entry->bytecode, chunkname,
+                                      "b" );
+      auto const elapsed =
+          chrono::duration_cast<chrono::microseconds>(
+              Clock::now() - start );
+      if( func.has_value() ) {
+        ++stats.hits;
+        stats.time_saved +=
+            max( chrono::microseconds( 0 ),
+                 chrono::microseconds(
+                     entry->header.compile_micros ) -
+                     elapsed );
+        return *func;
+      }
+      lg.warn( "failed to load cached bytecode for {}: {}",
+               source_file, func.error() );
+    }
+  }
+
+  ++stats.misses;
+  auto const start = Clock::now();
+  lua::lua_expect<lua::rfunction> func =
+      st.script.load_buffer_safe( *source, chunkname, "t" );
+  auto const elapsed =
+      chrono::duration_cast<chrono::microseconds>( Clock::now() -
+                                                   start );
+  if( !func.has_value() )
+    st.error( "failed to load file {}: {}", source_file,
+              func.error() );
+
+  CacheEntry entry{ .header   = expected,
+                    .bytecode = st.script.dump(
+                        *func, /*strip=*/false ) };
+  entry.header.compile_micros = elapsed.count();
+  if( !write_cache_entry( cache_file, entry ) )
+    lg.warn( "failed to write Lua bytecode cache file {}.",
+             cache_file );
+  return *func;
+}
+
+} // namespace rn
@@ -0,0 +1,57 @@
+/****************************************************************
+**lua-cache.hpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Caches compiled Lua modules as bytecode.
+*
+*****************************************************************/
+#pragma once
+
+#include "core-config.hpp"
+
+// luapp
+#include "luapp/rfunction.hpp"
+
+// base
+#include "base/fs.hpp"
+
+// C++ standard library
+#include <chrono>
+
+namespace lua {
+struct state;
+}
+
+namespace rn {
+
+/****************************************************************
+** LuaCacheStats
+*****************************************************************/
+struct LuaCacheStats {
+  int hits   = 0;
+  int misses = 0;
+  // For each hit, this accumulates the time that it took to com-
+  // pile the source when the entry was written minus the time
+  // that it took to load the bytecode.
+  std::chrono::microseconds time_saved = {};
+};
+
+/****************************************************************
+** Public API
+*****************************************************************/
+// Loads the Lua source file as a function (without running it).
+// If the cache folder holds an entry for the file that was com-
+// piled from identical source by the same Lua version then the
+// bytecode is loaded from there instead. Otherwise the source is
+// compiled and the resulting bytecode is written to the cache.
+// Any problem with the cache entry is not an error; it just
+// falls back to the source. Errors compiling the source are
+// thrown as Lua errors.
+lua::rfunction load_lua_file_cached(
+    lua::state& st, fs::path const& source_file,
+    fs::path const& cache_folder, LuaCacheStats& stats );
+
+} // namespace rn
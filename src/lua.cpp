@@ -16,6 +16,10 @@
 #include "expect.hpp"
 #include "iengine.hpp"
 #include "irand.hpp"
+#include "lua-cache.hpp"
+
+// config
+#include "config/rn.rds.hpp"
 
 // luapp
 #include "luapp/c-api.hpp"
@@ -46,6 +50,10 @@ namespace rn {
 
 namespace {
 
+// Accumulates over all modules loaded, including those loaded
+// lazily after startup.
+LuaCacheStats g_lua_cache_stats;
+
 fs::path module_name_to_file_name( string const& m ) {
   string const with_slashes =
       base::str_replace_all( m, { { ".", "/" } } );
@@ -76,8 +84,15 @@ lua::table require( lua::state& st, string const& required ) {
   // Set the module to something while we're loading in order to
   // detect and break cyclic dependencies.
   modules[key] = "loading";
-  module_table =
-      st.script.run_file<lua::table>( file_name.string() );
+  auto const& cache_config = config_rn.lua.bytecode_cache;
+  if( cache_config.enabled )
+    module_table =
+        load_lua_file_cached( st, file_name, cache_config.folder,
+                              g_lua_cache_stats )
+            .call<lua::table>();
+  else
+    module_table =
+        st.script.run_file<lua::table>( file_name.string() );
   modules[key] = module_table;
   // Create nested tables to hold the module.
   vector<string> const components = base::str_split( key, '.' );
@@ -90,6 +105,20 @@ lua::table require( lua::state& st, string const& required ) {
   return module_table;
 }
 
+void log_lua_memory_stats( lua::state& st ) {
+  base::maybe<lua::AllocStats> const stats = st.memory.stats();
+  if( !stats.has_value() ) {
+    lg.info( "lua memory: stats not available." );
+    return;
+  }
+  lg.info(
+      "lua memory: live={}KB, peak={}KB, chunks={}KB, "
+      "allocs={}, frees={}, reallocs={}, failed={}.",
+      stats->live_bytes / 1024, stats->peak_bytes / 1024,
+      stats->chunk_bytes / 1024, stats->num_allocs,
+      stats->num_frees, stats->num_reallocs, stats->num_failed );
+}
+
 void add_logging_methods( lua::state& st ) {
   CHECK( st["log"] == lua::nil );
   lua::table log = lua::table::create_or_get( st["log"] );
@@ -111,6 +140,7 @@ void add_logging_methods( lua::state& st ) {
   log["critical"] = []( string const& msg ) {
     lg.critical( "{}", msg );
   };
+  log["memory"] = [&st] { log_lua_memory_stats( st ); };
   // FIXME: needs to be able to take multiple arguments.
   st["print"] = []( lua::any o ) {
     lua::push( o.this_cthread(), o );
@@ -123,6 +153,15 @@ void load_lua_modules( lua::state& st ) {
   for( auto const& path : util::wildcard( "src/lua/*.lua" ) )
     if( path.string().find( "test" ) == string::npos )
       require( st, path.stem() );
+  auto const& stats = g_lua_cache_stats;
+  if( config_rn.lua.bytecode_cache.enabled )
+    lg.info(
+        "lua bytecode cache: {} hits, {} misses, saved ~{}ms.",
+        stats.hits, stats.misses,
+        chrono::duration_cast<chrono::milliseconds>(
+            stats.time_saved )
+            .count() );
+  log_lua_memory_stats( st );
 }
 
 void set_up_lua_rng( IEngine& engine, lua::state& st ) {
@@ -212,6 +251,10 @@ void run_lua_startup_routines( lua::state& st ) {
 }
 
 void lua_init( IEngine& engine, lua::state& st ) {
+  if( auto const cap_mb = config_rn.lua.memory_cap_mb;
+      cap_mb.has_value() )
+    st.memory.set_cap( int64_t( *cap_mb ) * 1024 * 1024 );
+
   st.lib.open_all();
 
   set_up_lua_rng( engine, st );
@@ -0,0 +1,135 @@
+/****************************************************************
+**alloc.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Memory allocator for Lua states.
+*
+*****************************************************************/
+#include "alloc.hpp"
+
+// C++ standard library
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+using namespace std;
+
+namespace lua {
+
+namespace {
+
+// Zero means that the size is not served by a size class.
+size_t size_class_for( size_t const size ) {
+  if( size == 0 || size > Allocator::kMaxSmallSize ) return 0;
+  return ( size + Allocator::kGranularity - 1 ) /
+         Allocator::kGranularity;
+}
+
+size_t size_for_class( size_t const size_class ) {
+  return size_class * Allocator::kGranularity;
+}
+
+} // namespace
+
+/****************************************************************
+** Allocator
+*****************************************************************/
+void* Allocator::lua_alloc( void* ud, void* ptr, size_t osize,
+                            size_t nsize ) noexcept {
+  return static_cast<Allocator*>( ud )->realloc( ptr, osize,
+                                                 nsize );
+}
+
+void* Allocator::allocate_small(
+    size_t const size_class ) noexcept {
+  FreeBlock*& head = free_lists_[size_class - 1];
+  if( head != nullptr ) {
+    FreeBlock* const res = head;
+    head                 = head->next;
+    return res;
+  }
+  size_t const size = size_for_class( size_class );
+  if( chunk_end_ - chunk_cur_ < ptrdiff_t( size ) ) {
+    // Whatever is left in the current chunk is smaller than the
+    // largest size class, so it is not worth putting on a
+    // freelist.
+    auto* const chunk = new( nothrow ) byte[kChunkSize];
+    if( chunk == nullptr ) return nullptr;
+    chunks_.emplace_back( chunk );
+    chunk_cur_ = chunk;
+    chunk_end_ = chunk + kChunkSize;
+    stats_.chunk_bytes += kChunkSize;
+  }
+  void* const res = chunk_cur_;
+  chunk_cur_ += size;
+  return res;
+}
+
+void Allocator::free_small( void* const ptr,
+                            size_t const size_class ) noexcept {
+  FreeBlock*& head = free_lists_[size_class - 1];
+  head = new( ptr ) FreeBlock{ .next = head };
+}
+
+void* Allocator::realloc( void* const ptr, size_t osize,
+                          size_t const nsize ) noexcept {
+  // When ptr is null, osize encodes the type of object being al-
+  // located and not a size.
+  if( ptr == nullptr ) osize = 0;
+
+  if( nsize == 0 ) {
+    if( ptr == nullptr ) return nullptr;
+    if( size_t const cls = size_class_for( osize ); cls != 0 )
+      free_small( ptr, cls );
+    else
+      std::free( ptr );
+    stats_.live_bytes -= osize;
+    ++stats_.num_frees;
+    return nullptr;
+  }
+
+  if( nsize > osize && cap_bytes_.has_value() &&
+      stats_.live_bytes + int64_t( nsize - osize ) >
+          *cap_bytes_ ) {
+    ++stats_.num_failed;
+    return nullptr;
+  }
+
+  size_t const ocls = size_class_for( osize );
+  size_t const ncls = size_class_for( nsize );
+  void* res         = nullptr;
+  if( ptr != nullptr && ocls != 0 && ocls == ncls ) {
+    // Still fits in the same block.
+    res = ptr;
+  } else if( ptr != nullptr && ocls == 0 && ncls == 0 ) {
+    res = std::realloc( ptr, nsize );
+  } else {
+    res = ( ncls != 0 ) ? allocate_small( ncls )
+                        : std::malloc( nsize );
+    if( res != nullptr && ptr != nullptr ) {
+      memcpy( res, ptr, min( osize, nsize ) );
+      if( ocls != 0 )
+        free_small( ptr, ocls );
+      else
+        std::free( ptr );
+    }
+  }
+
+  if( res == nullptr ) {
+    ++stats_.num_failed;
+    return nullptr;
+  }
+  if( ptr == nullptr )
+    ++stats_.num_allocs;
+  else
+    ++stats_.num_reallocs;
+  stats_.live_bytes += int64_t( nsize ) - int64_t( osize );
+  stats_.peak_bytes = max( stats_.peak_bytes, stats_.live_bytes );
+  return res;
+}
+
+} // namespace lua
@@ -0,0 +1,113 @@
+/****************************************************************
+**alloc.hpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Memory allocator for Lua states.
+*
+*****************************************************************/
+#pragma once
+
+// base
+#include "base/maybe.hpp"
+
+// C++ standard library
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace lua {
+
+/****************************************************************
+** AllocStats
+*****************************************************************/
+struct AllocStats {
+  // Bytes requested by Lua that have not yet been freed. This
+  // does not include the slack from rounding small blocks up to
+  // their size class nor the unused parts of the chunks.
+  int64_t live_bytes = 0;
+  // High water mark of live_bytes.
+  int64_t peak_bytes = 0;
+  // Bytes obtained from the system to hold small blocks.
+  int64_t chunk_bytes = 0;
+
+  int64_t num_allocs   = 0;
+  int64_t num_frees    = 0;
+  int64_t num_reallocs = 0;
+  // Requests that were refused, either because they would have
+  // exceeded the cap or because the system was out of memory.
+  int64_t num_failed = 0;
+
+  bool operator==( AllocStats const& ) const = default;
+};
+
+/****************************************************************
+** Allocator
+*****************************************************************/
+// A lua_Alloc implementation that serves small blocks out of
+// large chunks using one freelist per size class and forwards
+// larger blocks to the system allocator. Lua creates huge num-
+// bers of small objects (tables, closures, short strings) that
+// would otherwise fragment the process heap shared with the
+// game. Since Lua always tells the allocator the size of the
+// block being freed, blocks need no headers.
+//
+// Memory obtained for small blocks is recycled via the
+// freelists but only returned to the system when the allocator
+// is destroyed, which must happen after the Lua state that uses
+// it has been closed.
+struct Allocator {
+  static constexpr size_t kGranularity    = 16;
+  static constexpr size_t kMaxSmallSize   = 256;
+  static constexpr size_t kNumSizeClasses = kMaxSmallSize /
+                                            kGranularity;
+  static constexpr size_t kChunkSize = 64 * 1024;
+
+  Allocator() = default;
+
+  Allocator( Allocator const& )            = delete;
+  Allocator& operator=( Allocator const& ) = delete;
+
+  // Has the signature of lua_Alloc; `ud` must point to an Allo-
+  // cator.
+  static void* lua_alloc( void* ud, void* ptr, size_t osize,
+                          size_t nsize ) noexcept;
+
+  AllocStats const& stats() const { return stats_; }
+
+  // When set, any request that would cause the live bytes to ex-
+  // ceed the cap is refused, which Lua reports as a memory
+  // error in the script that made the request. Requests that
+  // shrink or free a block are always honored, since Lua as-
+  // sumes that those cannot fail.
+  void set_cap( base::maybe<int64_t> cap_bytes ) {
+    cap_bytes_ = cap_bytes;
+  }
+
+  base::maybe<int64_t> cap() const { return cap_bytes_; }
+
+ private:
+  void* realloc( void* ptr, size_t osize, size_t nsize ) noexcept;
+
+  void* allocate_small( size_t size_class ) noexcept;
+  void free_small( void* ptr, size_t size_class ) noexcept;
+
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+
+  std::array<FreeBlock*, kNumSizeClasses> free_lists_ = {};
+  std::vector<std::unique_ptr<std::byte[]>> chunks_;
+  // Bump allocation within the most recent chunk.
+  std::byte* chunk_cur_ = nullptr;
+  std::byte* chunk_end_ = nullptr;
+
+  base::maybe<int64_t> cap_bytes_;
+  AllocStats stats_;
+};
+
+} // namespace lua
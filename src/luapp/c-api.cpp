@@ -123,6 +123,36 @@ lua_valid c_api::loadstring( char const* script ) noexcept {
   return res;
 }
 
+lua_valid c_api::loadbuffer( string_view const buffer,
+                             char const* const chunkname,
+                             char const* const mode ) noexcept {
+  lua_valid res = base::valid;
+  // [-0, +1, –]
+  if( luaL_loadbufferx( L_, buffer.data(), buffer.size(),
+                        chunkname, mode ) == LUA_OK )
+    // Pushes a function onto the stack.
+    enforce_stack_size_ge( 1 );
+  else
+    res = pop_and_return_error();
+  return res;
+}
+
+string c_api::dump( bool const strip ) noexcept {
+  enforce_stack_size_ge( 1 );
+  CHECK( lua_type( L_, -1 ) == LUA_TFUNCTION &&
+         !lua_iscfunction( L_, -1 ) );
+  string res;
+  auto const writer = []( lua_State*, void const* p, size_t sz,
+                          void* ud ) -> int {
+    static_cast<string*>( ud )->append(
+        static_cast<char const*>( p ), sz );
+    return 0;
+  };
+  // [-0, +0, –]
+  lua_dump( L_, writer, &res, strip ? 1 : 0 );
+  return res;
+}
+
 lua_valid c_api::dostring( char const* script ) noexcept {
   GOOD_OR_RETURN( loadstring( script ) );
   enforce_stack_size_ge( 1 );
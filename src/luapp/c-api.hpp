@@ -70,6 +70,22 @@ struct c_api {
   // turned.
   lua_valid loadfile( const char* filename );
 
+  // Loads the buffer as a chunk named `chunkname` and, if suc-
+  // cessful, pushes it onto the stack as a function (not run).
+  // `mode` is as in lua_load: "t" allows only text chunks, "b"
+  // only binary (precompiled) chunks, and "bt" either. Binary
+  // chunks are checked by Lua for version and format mismatches
+  // but are otherwise trusted, so only load ones that we dumped.
+  lua_valid loadbuffer( std::string_view buffer,
+                        char const* chunkname,
+                        char const* mode ) noexcept;
+
+  // Dumps the Lua function at the top of the stack as a binary
+  // chunk that can later be loaded with loadbuffer. The function
+  // is left on the stack. If `strip` is true then debug informa-
+  // tion (e.g. line numbers) is omitted.
+  std::string dump( bool strip ) noexcept;
+
   /**************************************************************
   ** call / pcall
   ***************************************************************/
@@ -11,6 +11,7 @@
 #include "state.hpp"
 
 // luapp
+#include "alloc.hpp"
 #include "c-api.hpp"
 #include "error.hpp"
 
@@ -36,6 +37,25 @@ namespace {
   FATAL( "uncaught lua error: {}", err );
 }
 
+// Returns the allocator used by the global state to which L be-
+// longs, or nullptr if the state was not created by us.
+Allocator* allocator_for( cthread L ) {
+  void* ud           = nullptr;
+  lua_Alloc const fn = lua_getallocf( L, &ud );
+  if( fn != &Allocator::lua_alloc ) return nullptr;
+  return static_cast<Allocator*>( ud );
+}
+
+// Same as luaL_newstate but with our own allocator. Note that
+// luaL_newstate also installs a warning function, which we don't
+// do since we don't use Lua warnings.
+cthread new_state() {
+  auto* const alloc = new Allocator;
+  cthread const L   = lua_newstate( &Allocator::lua_alloc, alloc );
+  CHECK( L != nullptr, "failed to create Lua state." );
+  return L;
+}
+
 } // namespace
 
 state::state( cthread cth )
@@ -46,17 +66,19 @@ state::state( cthread cth )
     function( resource() ),
     lib( resource() ),
     usertype( resource() ),
-    script( resource() ) {}
+    script( resource() ),
+    memory( resource() ) {}
 
 state::state()
-  : Base( luaL_newstate(), /*own=*/true ),
+  : Base( new_state(), /*own=*/true ),
     thread( resource() ),
     string( resource() ),
     table( resource() ),
     function( resource() ),
     lib( resource() ),
     usertype( resource() ),
-    script( resource() ) {
+    script( resource() ),
+    memory( resource() ) {
   // This will be called whenever an error happens in a Lua call
   // that is not run in a protected environment. For example, if
   // we call lua_getglobal from C++ (outside of a pcall) and it
@@ -64,7 +86,13 @@ state::state()
   lua_atpanic( resource(), panic );
 }
 
-void state::free_resource() { lua_close( resource() ); }
+void state::free_resource() {
+  // The allocator must outlive the state since closing it will
+  // free all of its memory.
+  Allocator* const alloc = allocator_for( resource() );
+  lua_close( resource() );
+  delete alloc;
+}
 
 /****************************************************************
 ** Threads
@@ -150,6 +178,24 @@ lua_expect<rfunction> state::Script::load_safe(
   return rfunction( L, C.ref_registry() );
 }
 
+lua_expect<rfunction> state::Script::load_buffer_safe(
+    string_view buffer, string const& chunkname,
+    char const* mode ) noexcept {
+  c_api C( L );
+  GOOD_OR_RETURN(
+      C.loadbuffer( buffer, chunkname.c_str(), mode ) );
+  return rfunction( L, C.ref_registry() );
+}
+
+string state::Script::dump( rfunction const& func,
+                            bool const strip ) {
+  c_api C( L );
+  lua::push( L, func );
+  string res = C.dump( strip );
+  C.pop();
+  return res;
+}
+
 rfunction state::Script::load( string_view code ) noexcept {
   lua_expect<rfunction> res = load_safe( code );
   if( !res.has_value() )
@@ -174,4 +220,23 @@ void state::Script::load_file( std::string_view file ) {
   if( !res ) throw_lua_error( L, "{}", res );
 }
 
+/****************************************************************
+** Memory
+*****************************************************************/
+state::Memory::Memory( cthread cth ) : L( cth ) {}
+
+base::maybe<AllocStats> state::Memory::stats() const {
+  Allocator const* const alloc = allocator_for( L );
+  if( alloc == nullptr ) return base::nothing;
+  return alloc->stats();
+}
+
+void state::Memory::set_cap( base::maybe<int64_t> cap_bytes ) {
+  Allocator* const alloc = allocator_for( L );
+  CHECK( alloc != nullptr,
+         "cannot set a memory cap on a Lua state that does not "
+         "use our allocator." );
+  alloc->set_cap( cap_bytes );
+}
+
 } // namespace lua
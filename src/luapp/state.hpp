@@ -11,6 +11,7 @@
 #pragma once
 
 // luapp
+#include "alloc.hpp"
 #include "as.hpp"
 #include "call.hpp"
 #include "cthread.hpp"
@@ -166,6 +167,17 @@ struct state : base::zero<state, cthread> {
     lua_expect<rfunction> load_safe(
         std::string_view code ) noexcept;
 
+    // Loads a chunk from a buffer that may hold either source
+    // code or a binary chunk produced by `dump`, as permitted by
+    // `mode` (see c_api::loadbuffer).
+    lua_expect<rfunction> load_buffer_safe(
+        std::string_view buffer, std::string const& chunkname,
+        char const* mode ) noexcept;
+
+    // Produces a binary chunk from a Lua function that can later
+    // be loaded with load_buffer_safe.
+    std::string dump( rfunction const& func, bool strip );
+
     void operator()( std::string_view code );
 
     template<GettableOrVoid R = void>
@@ -202,6 +214,23 @@ struct state : base::zero<state, cthread> {
     cthread L;
   } script;
 
+  /**************************************************************
+  ** Memory
+  ***************************************************************/
+  struct Memory {
+    Memory( cthread cth );
+
+    // Returns nothing if the state was not created with our al-
+    // locator (e.g. it is a view of a state created elsewhere).
+    base::maybe<AllocStats> stats() const;
+
+    // See Allocator::set_cap.
+    void set_cap( base::maybe<int64_t> cap_bytes );
+
+   private:
+    cthread L;
+  } memory;
+
   /**************************************************************
   ** Indexer
   ***************************************************************/
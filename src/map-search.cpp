@@ -21,29 +21,21 @@
 #include "ss/ref.hpp"
 #include "ss/terrain.hpp"
 
-// base
-#include "base/generator.hpp"
-#include "base/range-lite.hpp"
+// C++ standard library
+#include <span>
 
 using namespace std;
 
-namespace rl = base::rl;
+namespace rg = std::ranges;
 
 namespace rn {
 
 namespace {
 
-using ::base::generator;
 using ::gfx::point;
+using ::gfx::size;
 
-// NOTE: we want all of the coroutines in this module to be
-// static (internal only) because that allows the optimizer to
-// better optimize them, since it knows all possible ways they
-// will be used.
-#define YIELD( r ) static generator<r>
-
-// Yields an infinite stream of points spiraling outward from
-// the starting point, i.e. (a-y):
+// Offsets spiraling outward from a starting point, i.e. (a-y):
 //
 //   j k l m n
 //   y b c d o
@@ -51,52 +43,87 @@ using ::gfx::point;
 //   w h g f q
 //   v u t s r
 //
-YIELD( point ) outward_spiral_search( point const start ) {
-  point curr = start;
-  int len    = 1;
-  co_yield curr;
-  while( true ) {
-    --curr.x;
-    --curr.y;
-    len += 2;
+// including all squares out to the given chessboard radius.
+vector<size> compute_spiral_offsets( int const radius ) {
+  vector<size> res;
+  res.reserve( ( 2 * radius + 1 ) * ( 2 * radius + 1 ) );
+  size curr;
+  res.push_back( curr );
+  for( int len = 3; len <= 2 * radius + 1; len += 2 ) {
+    --curr.w;
+    --curr.h;
     // Top edge, right edge, bottom edge, left edge.
-    for( int i = 0; i < len - 1; ++i, ++curr.x ) co_yield curr;
-    for( int i = 0; i < len - 1; ++i, ++curr.y ) co_yield curr;
-    for( int i = 0; i < len - 1; ++i, --curr.x ) co_yield curr;
-    for( int i = 0; i < len - 1; ++i, --curr.y ) co_yield curr;
+    for( int i = 0; i < len - 1; ++i, ++curr.w )
+      res.push_back( curr );
+    for( int i = 0; i < len - 1; ++i, ++curr.h )
+      res.push_back( curr );
+    for( int i = 0; i < len - 1; ++i, --curr.w )
+      res.push_back( curr );
+    for( int i = 0; i < len - 1; ++i, --curr.h )
+      res.push_back( curr );
   }
+  return res;
 }
 
-// Same as above by limits the search to squares within the given
-// pythagorean distance. A distance of zero will include the
-// starting square. A distance of one will include the four car-
-// dinally adjacent squares, etc.
-YIELD( point )
-outward_spiral_pythdist_search_existing_gen(
-    SSConst const& ss, point const start, double max_distance ) {
-  auto const spiral_gen = outward_spiral_search( start );
-  // If we search a NxN grid then we should cover all of the ones
-  // that are within the requested pythagorean distance to the
-  // starting square.
-  int const N = static_cast<int>( max_distance * 2 + 1 );
-  int const kMaxSquaresToSearch = N * N;
-
-  auto close_enough = [&]( point p ) {
-    return ( start - p ).pythagorean() <= max_distance;
-  };
-
-  auto exists = [&]( point p ) {
-    return ss.terrain.square_exists( Coord::from_gfx( p ) );
-  };
-
-  // To avoid an infinite search, we need to call `take` before
-  // we call `exists`.
-  auto const points = rl::all( spiral_gen )
-                          .take( kMaxSquaresToSearch )
-                          .keep_if( exists )
-                          .keep_if( close_enough );
-
-  for( point const point : points ) co_yield point;
+// Searches within this radius (which covers all of the searches
+// done in normal game play) use a table that is computed once.
+int constexpr kSpiralTableRadius = 32;
+
+// Returns the spiral offsets out to the given radius. Larger
+// radii will be computed into `storage`.
+span<size const> spiral_offsets( int const radius,
+                                 vector<size>& storage ) {
+  static vector<size> const table =
+      compute_spiral_offsets( kSpiralTableRadius );
+  if( radius > kSpiralTableRadius ) {
+    storage = compute_spiral_offsets( radius );
+    return storage;
+  }
+  return span( table ).first( ( 2 * radius + 1 ) *
+                              ( 2 * radius + 1 ) );
+}
+
+// The index of the offset in the spiral above, so that things
+// found by other means can be put into spiral order.
+int spiral_rank( size const d ) {
+  int const r = std::max( abs( d.w ), abs( d.h ) );
+  if( r == 0 ) return 0;
+  int const ring_start = ( 2 * r - 1 ) * ( 2 * r - 1 );
+  if( d.h == -r && d.w < r ) return ring_start + ( d.w + r );
+  if( d.w == r && d.h < r ) return ring_start + 2 * r + d.h + r;
+  if( d.h == r && d.w > -r ) return ring_start + 4 * r + r - d.w;
+  return ring_start + 6 * r + r - d.h;
+}
+
+// Calls fn on each existing map square spiraling outward from
+// the start that is within the given pythagorean distance, until
+// fn returns true. A distance of zero will include the starting
+// square. A distance of one will include the four cardinally ad-
+// jacent squares, etc.
+void spiral_search_existing( SSConst const& ss,
+                             point const start,
+                             double const max_distance,
+                             auto&& fn ) {
+  if( max_distance < 0 ) return;
+  vector<size> storage;
+  int const radius = static_cast<int>( max_distance );
+  for( size const d : spiral_offsets( radius, storage ) ) {
+    if( d.pythagorean() > max_distance ) continue;
+    point const p = start + d;
+    if( !ss.terrain.square_exists( p ) ) continue;
+    if( fn( p ) ) return;
+  }
+}
+
+// Sorts the ids into the order in which a spiral search from the
+// start would have found them.
+template<typename Id>
+void sort_in_spiral_order( vector<Id>& ids, point const start,
+                           auto const& tile_for ) {
+  rg::sort( ids, [&]( Id const l, Id const r ) {
+    return spiral_rank( tile_for( l ) - start ) <
+           spiral_rank( tile_for( r ) - start );
+  } );
 }
 
 } // namespace
@@ -107,100 +134,73 @@ outward_spiral_pythdist_search_existing_gen(
 vector<point> outward_spiral_pythdist_search_existing(
     SSConst const& ss, point const start, double max_distance ) {
   vector<point> res;
-  for( point const p :
-       outward_spiral_pythdist_search_existing_gen(
-           ss, start, max_distance ) )
-    res.push_back( p );
+  spiral_search_existing( ss, start, max_distance,
+                          [&]( point const p ) {
+                            res.push_back( p );
+                            return false;
+                          } );
   return res;
 }
 
-// The idea with the implementation here is that we iterate over
-// colonies instead of squares with the assumption that there
-// will generally by fewer colonies than squares, even if we are
-// e.g. iterating over a 7x7 grid.
+// The candidates come from the spatial index and are already
+// ordered by distance and then by id.
 maybe<Colony const&> find_any_close_colony(
     SSConst const& ss, gfx::point location, double max_distance,
     base::function_ref<bool( Colony const& )> pred ) {
-  maybe<ColonyId> const last = ss.colonies.last_colony_id();
-  if( !last.has_value() ) return nothing;
-  struct ColonyWithDistance {
-    ColonyId colony_id = {};
-    double distance    = {};
-  };
-  maybe<ColonyWithDistance> state;
-  // Iterate through colonies by ID so that we get a determin-
-  // istic ordering; otherwise we'd be iterating over the un-
-  // ordered map in which the colonies are store.
-  for( ColonyId colony_id = ColoniesState::kFirstColonyId;
-       colony_id <= *last; ++colony_id ) {
+  for( ColonyId const colony_id :
+       ss.colonies.colonies_within( location, max_distance ) ) {
     Colony const& colony = ss.colonies.colony_for( colony_id );
-    double const distance =
-        ( colony.location - Coord::from_gfx( location ) )
-            .diagonal();
-    if( distance > max_distance ) continue;
-    if( !pred( colony ) ) continue;
-    if( !state.has_value() || distance < state->distance )
-      state = ColonyWithDistance{ .colony_id = colony_id,
-                                  .distance  = distance };
+    if( pred( colony ) ) return colony;
   }
-  return state.fmap(
-      [&]( ColonyWithDistance const& cwd ) -> Colony const& {
-        return ss.colonies.colony_for( cwd.colony_id );
-      } );
+  return nothing;
 }
 
+// This one has to look at squares instead of using the spatial
+// index since it has to find colonies as the player sees them,
+// which may not be the real ones.
 maybe<Colony const&> find_close_explored_colony(
     SSConst const& ss, e_player player, point location,
     double max_distance ) {
   VisibilityForPlayer const viz( ss, player );
-  base::generator<point> const search =
-      outward_spiral_pythdist_search_existing_gen(
-          ss, location, max_distance );
-  for( point const point : search ) {
-    maybe<Colony const&> colony =
-        viz.colony_at( Coord::from_gfx( point ) );
-    if( colony.has_value() ) return colony;
-  }
-  return nothing;
+  maybe<point> found;
+  spiral_search_existing(
+      ss, location, max_distance, [&]( point const p ) {
+        if( !viz.colony_at( Coord::from_gfx( p ) ).has_value() )
+          return false;
+        found = p;
+        return true;
+      } );
+  if( !found.has_value() ) return nothing;
+  return viz.colony_at( Coord::from_gfx( *found ) );
 }
 
-// Yields a finite stream of friendly colonies spiraling outward
-// from the starting point that are within a radius of
-// `max_distance` to the start.
 vector<ColonyId> close_friendly_colonies( SSConst const& ss,
                                           e_player player,
                                           gfx::point const start,
                                           double max_distance ) {
-  vector<ColonyId> res;
-  generator<gfx::point> points =
-      outward_spiral_pythdist_search_existing_gen(
-          ss, start, max_distance );
-  for( gfx::point p : points ) {
-    Coord const square = Coord::from_gfx( p );
-    // Is there a friendly colony there.
-    maybe<ColonyId> const colony_id =
-        ss.colonies.maybe_from_coord( square );
-    if( !colony_id.has_value() ) continue;
-    if( ss.colonies.colony_for( *colony_id ).player != player )
-      continue;
-    res.push_back( *colony_id );
-  }
+  vector<ColonyId> res =
+      ss.colonies.colonies_within( start, max_distance );
+  erase_if( res, [&]( ColonyId const colony_id ) {
+    return ss.colonies.colony_for( colony_id ).player != player;
+  } );
+  sort_in_spiral_order( res, start, [&]( ColonyId const id ) {
+    return ss.colonies.coord_for( id ).to_gfx();
+  } );
   return res;
 }
 
 maybe<e_tribe> find_close_encountered_tribe(
     SSConst const& ss, e_player player, gfx::point location,
     double max_distance ) {
-  generator<gfx::point> const points =
-      outward_spiral_pythdist_search_existing_gen(
-          ss, location, max_distance );
-  for( gfx::point const p : points ) {
-    Coord const square = Coord::from_gfx( p );
+  vector<DwellingId> dwellings =
+      ss.natives.dwellings_within( location, max_distance );
+  sort_in_spiral_order(
+      dwellings, location, [&]( DwellingId const id ) {
+        return ss.natives.coord_for( id ).to_gfx();
+      } );
+  for( DwellingId const dwelling_id : dwellings ) {
     // Is there a tribe there that we've met?
-    maybe<DwellingId> const dwelling_id =
-        ss.natives.maybe_dwelling_from_coord( square );
-    if( !dwelling_id.has_value() ) continue;
-    Tribe const& tribe = ss.natives.tribe_for( *dwelling_id );
+    Tribe const& tribe = ss.natives.tribe_for( dwelling_id );
     if( !tribe.relationship[player].encountered ) continue;
     return tribe.type;
   }
@@ -527,9 +527,8 @@ struct RiverStatsCollector : IMapStatsCollector {
         "land",
       };
 
-      cdr::table diff;
-      cdr::table& fail = diff["fail"].emplace<cdr::table>();
-      cdr::table& good = diff["good"].emplace<cdr::table>();
+      cdr::table fail;
+      cdr::table good;
       for( cdr::value const& col : kDiffColumns ) {
         string const& colstr = col.get<string>();
         UNWRAP_CONTINUE( double const l,
@@ -542,8 +541,12 @@ struct RiverStatsCollector : IMapStatsCollector {
         else
           fail[colstr] = ratio;
       }
-      fail["__key_order"]            = kDiffColumns;
-      good["__key_order"]            = kDiffColumns;
+      fail["__key_order"] = kDiffColumns;
+      good["__key_order"] = kDiffColumns;
+      cdr::table diff;
+      diff["fail"] = std::move( fail );
+      diff["good"] = std::move( good );
+
       string const diff_out_filename = format(
           "tools/auto-measure/auto-map-gen/rivers/generated/"
           "{}.diff.json",
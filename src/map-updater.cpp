@@ -183,14 +183,19 @@ bool NonRenderingMapUpdater::is_connectivity_dirty() const {
 }
 
 void NonRenderingMapUpdater::set_connectivity_dirty() {
-  connectivity_ = {};
+  int const generation = connectivity_.generation;
+  connectivity_            = {};
+  connectivity_.generation = generation + 1;
   CHECK( is_connectivity_dirty() );
 }
 
 TerrainConnectivity const&
 NonRenderingMapUpdater::connectivity() {
-  if( is_connectivity_dirty() )
+  if( is_connectivity_dirty() ) {
+    int const generation = connectivity_.generation;
     connectivity_ = compute_terrain_connectivity( ss_ );
+    connectivity_.generation = generation;
+  }
   CHECK( !is_connectivity_dirty() );
   return connectivity_;
 }
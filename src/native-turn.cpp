@@ -14,6 +14,7 @@
 
 // Revolution Now
 #include "agents.hpp"
+#include "anim-batch.hpp"
 #include "anim-builders.hpp"
 #include "co-wait.hpp"
 #include "iagent.hpp"
@@ -23,6 +24,7 @@
 #include "itribe-evolve.rds.hpp"
 #include "land-view.hpp"
 #include "map-square.hpp"
+#include "meet-natives.hpp"
 #include "mv-calc.hpp"
 #include "on-map.hpp"
 #include "plane-stack.hpp"
@@ -33,6 +35,7 @@
 #include "visibility.hpp"
 
 // config
+#include "config/land-view.rds.hpp"
 #include "config/natives.hpp"
 #include "config/text.rds.hpp" // FIXME
 
@@ -127,10 +130,9 @@ wait<> handle_native_unit_talk( SS& ss, TS& ts,
   native_unit.movement_points = 0;
 }
 
-wait<> handle_native_unit_travel( IEngine& engine, SS& ss,
-                                  TS& ts,
-                                  NativeUnit& native_unit,
-                                  e_direction direction ) {
+wait<> handle_native_unit_travel(
+    IEngine& engine, SS& ss, TS& ts, NativeUnit& native_unit,
+    e_direction direction, maybe<AnimationBatch&> batch ) {
   Coord const src = ss.units.coord_for( native_unit.id );
   Coord const dst = src.moved( direction );
   MovementPoints const needed = movement_points_required(
@@ -152,6 +154,19 @@ wait<> handle_native_unit_travel( IEngine& engine, SS& ss,
     CHECK_EQ( native_unit.movement_points, 0 );
     co_return;
   }
+  if( batch.has_value() ) {
+    // Meeting europeans is interactive, so in that case the move
+    // has to be done in the normal way.
+    e_tribe const tribe_type =
+        tribe_type_for_unit( ss, native_unit );
+    if( check_meet_europeans( ss, tribe_type, dst ).empty() ) {
+      UnitOnMapMover::native_unit_to_map_non_interactive(
+          ss, native_unit.id, dst );
+      batch->queue_move( native_unit.id, src, direction );
+      co_return;
+    }
+    co_await batch->finish();
+  }
   co_await ts.planes.get()
       .get_bottom<ILandViewPlane>()
       .animate_if_visible( anim_seq_for_unit_move(
@@ -163,7 +178,8 @@ wait<> handle_native_unit_travel( IEngine& engine, SS& ss,
 wait<> handle_native_unit_command(
     IEngine& engine, SS& ss, TS& ts, IRaid const& raid,
     e_tribe tribe_type, NativeUnit& native_unit,
-    NativeUnitCommand const& command ) {
+    NativeUnitCommand const& command,
+    maybe<AnimationBatch&> batch ) {
   SWITCH( command ) {
     CASE( forfeight ) {
       native_unit.movement_points = 0;
@@ -178,6 +194,9 @@ wait<> handle_native_unit_command(
                  tribe_type,
              "a tribe cannot equip a brave with muskets or "
              "horses unless it is sitting atop a dwelling." );
+      // So that the unit doesn't change while still sliding.
+      if( batch.has_value() )
+        co_await batch->finish_unit( native_unit.id );
       Tribe& tribe = ss.natives.tribe_for( tribe_type );
       tribe.muskets += equip.how.muskets_delta;
       tribe.horse_breeding += equip.how.horse_breeding_delta;
@@ -195,16 +214,18 @@ wait<> handle_native_unit_command(
       auto const society = society_on_real_square( ss, dst );
       if( !society.has_value() ) {
         co_await handle_native_unit_travel(
-            engine, ss, ts, native_unit, move.direction );
+            engine, ss, ts, native_unit, move.direction, batch );
       } else {
         SWITCH( *society ) {
           CASE( native ) {
             CHECK( native.tribe == tribe_type );
             co_await handle_native_unit_travel(
-                engine, ss, ts, native_unit, move.direction );
+                engine, ss, ts, native_unit, move.direction,
+                batch );
             break;
           }
           CASE( european ) {
+            if( batch.has_value() ) co_await batch->finish();
             co_await handle_native_unit_attack(
                 ss, ts, raid, native_unit, move.direction,
                 european.player );
@@ -222,6 +243,7 @@ wait<> handle_native_unit_command(
       SWITCH( society ) {
         CASE( native ) { SHOULD_NOT_BE_HERE; }
         CASE( european ) {
+          if( batch.has_value() ) co_await batch->finish();
           co_await handle_native_unit_talk( ss, ts, native_unit,
                                             talk.direction,
                                             european.player );
@@ -282,6 +304,14 @@ wait<> tribe_turn( IEngine& engine, SS& ss, TS& ts,
   // when the unit has 4 movement points (mounted brave or
   // mounted warrior) and it is traveling entirely along a road.
   int const kTriesWarn = 12;
+
+  // When enabled, the unit moves are made without waiting for
+  // them to be animated.
+  maybe<AnimationBatch> batch;
+  if( config_land_view.ai_moves.concurrent_animations )
+    batch.emplace(
+        ts.planes.get().get_bottom<ILandViewPlane>() );
+
   while( !units.empty() ) {
     NativeUnitId const native_unit_id =
         agent.select_unit( as_const( units ) );
@@ -302,7 +332,7 @@ wait<> tribe_turn( IEngine& engine, SS& ss, TS& ts,
 
     co_await handle_native_unit_command(
         engine, ss, ts, raid, agent.tribe_type(), native_unit,
-        agent.command_for( native_unit_id ) );
+        agent.command_for( native_unit_id ), batch );
 
     // !! Unit may no longer exist at this point.
     if( !ss.units.exists( native_unit_id ) ) {
@@ -313,6 +343,8 @@ wait<> tribe_turn( IEngine& engine, SS& ss, TS& ts,
     if( native_unit.movement_points == 0 )
       units.erase( native_unit_id );
   }
+
+  if( batch.has_value() ) co_await batch->finish();
 }
 
 } // namespace
@@ -0,0 +1,184 @@
+/****************************************************************
+**production-cache.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-19.
+*
+* Description: Caches the production of colonies.
+*
+*****************************************************************/
+#include "production-cache.hpp"
+
+// Revolution Now
+#include "production.hpp"
+
+// ss
+#include "ss/colony.rds.hpp"
+#include "ss/player.rds.hpp"
+#include "ss/players.rds.hpp"
+#include "ss/ref.hpp"
+#include "ss/settings.hpp"
+#include "ss/terrain.hpp"
+#include "ss/unit.hpp"
+#include "ss/units.hpp"
+
+// C++ standard library
+#include <vector>
+
+using namespace std;
+
+namespace rn {
+
+namespace {
+
+// The land yields of a colony can depend on the squares up to
+// two tiles away from it, since e.g. whether a water square gets
+// the ocean coast bonus depends on the squares around it.
+int constexpr kMaxDependencyDistance = 2;
+
+// Visits the squares that the land yields of a colony at the
+// given location can depend on, in a fixed order.
+template<typename Fn>
+void for_each_dependent_square( TerrainState const& terrain,
+                                Coord const location, Fn&& fn ) {
+  int constexpr N = kMaxDependencyDistance;
+  for( int y = -N; y <= N; ++y )
+    for( int x = -N; x <= N; ++x )
+      fn( terrain.maybe_square_at(
+          location + Delta{ .w = x, .h = y } ) );
+}
+
+// Visits the types of the units working outside the colony in a
+// fixed order.
+template<typename Fn>
+void for_each_outdoor_unit_type( UnitsState const& units,
+                                 Colony const& colony,
+                                 Fn&& fn ) {
+  for( auto const& [d, unit] : colony.outdoor_jobs )
+    if( unit.has_value() )
+      fn( units.unit_for( unit->unit_id ).type() );
+}
+
+BellsModifiers bells_modifiers_for( SSConst const& ss,
+                                    Player const& player,
+                                    Colony const& colony ) {
+  return compute_bells_modifiers(
+      player, colony,
+      ss.settings.game_setup_options.difficulty );
+}
+
+} // namespace
+
+/****************************************************************
+** ColonyProductionCache::Entry
+*****************************************************************/
+struct ColonyProductionCache::Entry {
+  Entry( SSConst const& ss, Colony const& colony,
+         ColonyLandYields const& yields_arg )
+    : location( colony.location ),
+      outdoor_jobs( colony.outdoor_jobs ),
+      yields( yields_arg ) {
+    UNWRAP_CHECK( player, ss.players.players[colony.player] );
+    fathers    = player.fathers.has;
+    difficulty = ss.settings.game_setup_options.difficulty;
+    bells_modifiers = bells_modifiers_for( ss, player, colony );
+    for_each_dependent_square(
+        ss.terrain, location,
+        [&]( maybe<MapSquare const&> const square ) {
+          squares.push_back( square.has_value()
+                                 ? maybe<MapSquare>( *square )
+                                 : nothing );
+        } );
+    for_each_outdoor_unit_type( ss.units, colony,
+                                [&]( e_unit_type const type ) {
+                                  unit_types.push_back( type );
+                                } );
+  }
+
+  bool matches( SSConst const& ss,
+                Colony const& current ) const {
+    // Check this first since it is the most likely to change.
+    if( current.outdoor_jobs != outdoor_jobs ) return false;
+    if( current.location != location ) return false;
+    UNWRAP_CHECK( player, ss.players.players[current.player] );
+    if( player.fathers.has != fathers ) return false;
+    if( ss.settings.game_setup_options.difficulty != difficulty )
+      return false;
+    if( bells_modifiers_for( ss, player, current ) !=
+        bells_modifiers )
+      return false;
+    // Since the outdoor jobs are the same, the units are the
+    // same, but their types could have changed.
+    int i     = 0;
+    bool same = true;
+    for_each_outdoor_unit_type( ss.units, current,
+                                [&]( e_unit_type const type ) {
+                                  same = same &&
+                                         unit_types[i] == type;
+                                  ++i;
+                                } );
+    if( !same ) return false;
+    i = 0;
+    for_each_dependent_square(
+        ss.terrain, location,
+        [&]( maybe<MapSquare const&> const square ) {
+          maybe<MapSquare> const& prev = squares[i++];
+          if( square.has_value() != prev.has_value() )
+            same = false;
+          else if( square.has_value() && *square != *prev )
+            same = false;
+        } );
+    return same;
+  }
+
+  // Inputs.
+  Coord location;
+  refl::enum_map<e_direction, maybe<OutdoorUnit>> outdoor_jobs;
+  vector<e_unit_type> unit_types;
+  vector<maybe<MapSquare>> squares;
+  refl::enum_map<e_founding_father, bool> fathers;
+  e_difficulty difficulty        = {};
+  BellsModifiers bells_modifiers = {};
+
+  // Output.
+  ColonyLandYields yields;
+};
+
+/****************************************************************
+** ColonyProductionCache
+*****************************************************************/
+ColonyProductionCache::ColonyProductionCache()  = default;
+ColonyProductionCache::~ColonyProductionCache() = default;
+
+maybe<ColonyLandYields const&> ColonyProductionCache::find(
+    SSConst const& ss, Colony const& colony ) const {
+  auto const it = entries_.find( colony.id );
+  if( it == entries_.end() ) return nothing;
+  Entry const& entry = *it->second;
+  if( !entry.matches( ss, colony ) ) return nothing;
+  ++hits_;
+  return entry.yields;
+}
+
+ColonyLandYields const& ColonyProductionCache::store(
+    SSConst const& ss, Colony const& colony,
+    ColonyLandYields const& yields ) {
+  unique_ptr<Entry>& entry = entries_[colony.id];
+  entry = make_unique<Entry>( ss, colony, yields );
+  return entry->yields;
+}
+
+ColonyProduction ColonyProductionCache::production_for_colony(
+    SSConst const& ss, Colony const& colony ) {
+  if( auto const cached = find( ss, colony );
+      cached.has_value() )
+    return rn::production_for_colony( ss, colony, *cached );
+  ColonyLandYields const& yields = store(
+      ss, colony, land_yields_for_colony( ss, colony ) );
+  return rn::production_for_colony( ss, colony, yields );
+}
+
+void ColonyProductionCache::clear() { entries_.clear(); }
+
+} // namespace rn
@@ -0,0 +1,93 @@
+/****************************************************************
+**production-cache.hpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-19.
+*
+* Description: Caches the production of colonies.
+*
+*****************************************************************/
+#pragma once
+
+// Revolution Now
+#include "maybe.hpp"
+
+// ss
+#include "ss/colony-id.hpp"
+
+// C++ standard library
+#include <memory>
+#include <unordered_map>
+
+namespace rn {
+
+/****************************************************************
+** Fwd. Decls.
+*****************************************************************/
+struct Colony;
+struct ColonyLandYields;
+struct ColonyProduction;
+struct SSConst;
+
+/****************************************************************
+** ColonyProductionCache
+*****************************************************************/
+// Remembers the land yields last computed for each colony (which
+// is the expensive part of computing its production) along with
+// everything that went into computing them, namely the colony's
+// location, its outdoor units and their jobs and types, the
+// player's founding fathers, the difficulty level, the sons of
+// liberty bonuses/penalties, and the squares within two tiles of
+// the colony (since e.g. the ocean coast bonus of a square de-
+// pends on the squares around it). Notably the colony's stock is
+// not among them, so entries survive from one turn to the next
+// as long as nobody is moved around; the rest of the production
+// (which depends on the stock but is cheap) is always recomputed
+// from the cached yields.
+//
+// Since the game state can be mutated from anywhere, an entry is
+// validated by comparing those inputs against the current state
+// instead of relying on the code that mutates things to inval-
+// idate the cache. That is still much cheaper than computing the
+// yields.
+//
+// Note that this is not thread safe, so when computing produc-
+// tion in parallel the lookups and stores must be done outside
+// of the parallel section.
+struct ColonyProductionCache {
+  ColonyProductionCache();
+  ~ColonyProductionCache();
+
+  // Computes the production of the colony using the cached land
+  // yields if they are still valid, otherwise computes them and
+  // caches them.
+  ColonyProduction production_for_colony( SSConst const& ss,
+                                          Colony const& colony );
+
+  // Returns the cached land yields of the colony if they are
+  // still valid.
+  maybe<ColonyLandYields const&> find(
+      SSConst const& ss, Colony const& colony ) const;
+
+  // The yields must have been computed from the current state of
+  // the colony.
+  ColonyLandYields const& store(
+      SSConst const& ss, Colony const& colony,
+      ColonyLandYields const& yields );
+
+  int size() const { return entries_.size(); }
+
+  // Number of times that find has returned the cached yields.
+  int hits() const { return hits_; }
+
+  void clear();
+
+ private:
+  struct Entry;
+
+  std::unordered_map<ColonyId, std::unique_ptr<Entry>> entries_;
+  mutable int hits_ = 0;
+};
+
+} // namespace rn
@@ -0,0 +1,269 @@
+/****************************************************************
+**production-eval.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-19.
+*
+* Description: Evaluates the production of hypothetical job as-
+*              signments in a colony.
+*
+*****************************************************************/
+#include "production-eval.hpp"
+
+// Revolution Now
+#include "colony-buildings.hpp"
+
+// ss
+#include "ss/colony.rds.hpp"
+#include "ss/player.rds.hpp"
+#include "ss/players.rds.hpp"
+#include "ss/ref.hpp"
+#include "ss/settings.hpp"
+#include "ss/terrain.hpp"
+#include "ss/unit.hpp"
+#include "ss/units.hpp"
+
+// rds
+#include "rds/switch-macro.hpp"
+
+using namespace std;
+
+namespace rn {
+
+namespace {
+
+Player const& colony_player( SSConst const& ss,
+                             Colony const& colony ) {
+  UNWRAP_CHECK( player, ss.players.players[colony.player] );
+  return player;
+}
+
+} // namespace
+
+/****************************************************************
+** ProductionEvaluator
+*****************************************************************/
+ProductionEvaluator::ProductionEvaluator( SSConst const& ss,
+                                          Colony const& colony )
+  : ss_( ss ),
+    colony_( colony ),
+    player_( colony_player( ss, colony ) ) {
+  // This is done only once and is the easiest way to get the
+  // center square production, which does not depend on the job
+  // assignments.
+  ColonyProduction const pr =
+      production_for_colony( ss, colony );
+  center_food_      = pr.center_food_production;
+  center_secondary_ = pr.center_extra_production;
+
+  // These are computed based on the state of things last turn,
+  // and only depend on the population.
+  BellsModifiers const bells_modifiers = compute_bells_modifiers(
+      player_, colony,
+      ss.settings.game_setup_options.difficulty );
+
+  for( e_indoor_job const job : refl::enum_values<e_indoor_job> )
+    buildings_[job] =
+        building_for_slot( colony, slot_for_indoor_job( job ) );
+  for( e_direction const d : refl::enum_values<e_direction> )
+    on_map_[d] = ss.terrain.square_exists(
+        colony.location.moved( d ) );
+
+  auto const add_unit = [&]( UnitId const unit_id,
+                             ColonyJob const& job ) {
+    e_unit_type const type = ss.units.unit_for( unit_id ).type();
+    UnitYields& yields     = yields_.emplace_back();
+    for( e_direction const d : refl::enum_values<e_direction> ) {
+      if( !on_map_[d] ) continue;
+      for( e_outdoor_job const outdoor_job :
+           refl::enum_values<e_outdoor_job> )
+        yields.outdoor[d][outdoor_job] =
+            outdoor_production_for_unit(
+                ss.terrain, player_, bells_modifiers,
+                outdoor_job, type, colony.location.moved( d ) );
+    }
+    for( e_indoor_job const indoor_job :
+         refl::enum_values<e_indoor_job> ) {
+      if( !buildings_[indoor_job].has_value() ) continue;
+      yields.indoor[indoor_job] = indoor_production_for_unit(
+          ss, player_, bells_modifiers, indoor_job,
+          *buildings_[indoor_job], type );
+    }
+    unit_ids_.push_back( unit_id );
+    jobs_.push_back( job );
+    add( ssize( jobs_ ) - 1, +1 );
+  };
+
+  for( auto const& [job, unit_ids] : colony.indoor_jobs )
+    for( UnitId const unit_id : unit_ids )
+      add_unit( unit_id, ColonyJob::indoor{ .job = job } );
+  for( auto const& [d, unit] : colony.outdoor_jobs )
+    if( unit.has_value() )
+      add_unit( unit->unit_id,
+                ColonyJob::outdoor{ .direction = d,
+                                    .job       = unit->job } );
+}
+
+UnitId ProductionEvaluator::unit_id( int const idx ) const {
+  CHECK_LT( idx, ssize( unit_ids_ ) );
+  return unit_ids_[idx];
+}
+
+ColonyJob const& ProductionEvaluator::job(
+    int const idx ) const {
+  CHECK_LT( idx, ssize( jobs_ ) );
+  return jobs_[idx];
+}
+
+int ProductionEvaluator::yield( int const idx,
+                                ColonyJob const& job ) const {
+  CHECK_LT( idx, ssize( yields_ ) );
+  UnitYields const& yields = yields_[idx];
+  SWITCH( job ) {
+    CASE( indoor ) { return yields.indoor[indoor.job]; }
+    CASE( outdoor ) {
+      return yields.outdoor[outdoor.direction][outdoor.job];
+    }
+  }
+}
+
+bool ProductionEvaluator::has_room(
+    ColonyJob const& job ) const {
+  SWITCH( job ) {
+    CASE( indoor ) {
+      maybe<e_colony_building> const building =
+          buildings_[indoor.job];
+      if( !building.has_value() ) return false;
+      return indoor_count_[indoor.job] <
+             max_workers_for_building( *building );
+    }
+    CASE( outdoor ) {
+      return on_map_[outdoor.direction] &&
+             !occupied_[outdoor.direction];
+    }
+  }
+}
+
+void ProductionEvaluator::assign( int const idx,
+                                  ColonyJob const& job ) {
+  CHECK_LT( idx, ssize( jobs_ ) );
+  if( jobs_[idx] == job ) return;
+  CHECK( has_room( job ) );
+  add( idx, -1 );
+  jobs_[idx] = job;
+  add( idx, +1 );
+}
+
+void ProductionEvaluator::add( int const idx, int const sign ) {
+  ColonyJob const& job = jobs_[idx];
+  int const quantity   = sign * yield( idx, job );
+  SWITCH( job ) {
+    CASE( indoor ) {
+      indoor_total_[indoor.job] += quantity;
+      indoor_count_[indoor.job] += sign;
+      break;
+    }
+    CASE( outdoor ) {
+      outdoor_total_[outdoor.job] += quantity;
+      occupied_[outdoor.direction] = ( sign > 0 );
+      break;
+    }
+  }
+}
+
+RawMaterialAndProduct ProductionEvaluator::raw_and_product(
+    e_outdoor_job const outdoor_job,
+    maybe<e_indoor_job> const indoor_job,
+    int const available_raw ) const {
+  RawMaterialAndProduct res;
+  res.raw_produced = outdoor_total_[outdoor_job];
+  if( center_secondary_.has_value() &&
+      center_secondary_->what == outdoor_job )
+    res.raw_produced += center_secondary_->quantity;
+  res.raw_delta_theoretical = res.raw_produced;
+  if( !indoor_job.has_value() ) return res;
+  maybe<e_colony_building> const building =
+      buildings_[*indoor_job];
+  if( !building.has_value() ) return res;
+  product_from_units( *building, indoor_total_[*indoor_job],
+                      available_raw + res.raw_produced, res );
+  return res;
+}
+
+// This mirrors what is done in production_for_colony.
+EvaluatedProduction ProductionEvaluator::evaluate() const {
+  EvaluatedProduction res;
+  auto const& stock = colony_.commodities;
+
+  auto const net_raw = [&]( e_commodity const raw,
+                            RawMaterialAndProduct const& rp ) {
+    res.net[raw] += rp.raw_produced - rp.raw_consumed_actual;
+  };
+
+  auto const chain = [&]( e_outdoor_job const outdoor_job,
+                          e_indoor_job const indoor_job,
+                          e_commodity const raw,
+                          e_commodity const product ) {
+    RawMaterialAndProduct const rp =
+        raw_and_product( outdoor_job, indoor_job, stock[raw] );
+    net_raw( raw, rp );
+    res.net[product] += rp.product_produced_actual;
+  };
+
+  chain( e_outdoor_job::sugar, e_indoor_job::rum,
+         e_commodity::sugar, e_commodity::rum );
+  chain( e_outdoor_job::tobacco, e_indoor_job::cigars,
+         e_commodity::tobacco, e_commodity::cigars );
+  chain( e_outdoor_job::cotton, e_indoor_job::cloth,
+         e_commodity::cotton, e_commodity::cloth );
+  chain( e_outdoor_job::furs, e_indoor_job::coats,
+         e_commodity::furs, e_commodity::coats );
+
+  net_raw( e_commodity::silver,
+           raw_and_product( e_outdoor_job::silver, nothing,
+                            stock[e_commodity::silver] ) );
+
+  RawMaterialAndProduct const lumber_hammers =
+      raw_and_product( e_outdoor_job::lumber,
+                       e_indoor_job::hammers,
+                       stock[e_commodity::lumber] );
+  net_raw( e_commodity::lumber, lumber_hammers );
+  res.hammers = lumber_hammers.product_produced_actual;
+
+  // Tools made from ore this turn can be used to make muskets
+  // this turn.
+  RawMaterialAndProduct const ore_tools = raw_and_product(
+      e_outdoor_job::ore, e_indoor_job::tools,
+      stock[e_commodity::ore] );
+  net_raw( e_commodity::ore, ore_tools );
+  RawMaterialAndProduct tools_muskets;
+  tools_muskets.raw_produced = ore_tools.product_produced_actual;
+  tools_muskets.raw_delta_theoretical =
+      tools_muskets.raw_produced;
+  if( auto const armory = buildings_[e_indoor_job::muskets];
+      armory.has_value() )
+    product_from_units( *armory,
+                        indoor_total_[e_indoor_job::muskets],
+                        stock[e_commodity::tools] +
+                            tools_muskets.raw_produced,
+                        tools_muskets );
+  net_raw( e_commodity::tools, tools_muskets );
+  res.net[e_commodity::muskets] +=
+      tools_muskets.product_produced_actual;
+
+  int const food_produced = center_food_ +
+                            outdoor_total_[e_outdoor_job::food] +
+                            outdoor_total_[e_outdoor_job::fish];
+  res.net[e_commodity::food] +=
+      food_produced - ssize( unit_ids_ ) * 2;
+
+  res.bells = bells_production_from_units(
+      ss_, player_, colony_,
+      indoor_total_[e_indoor_job::bells] );
+  res.crosses = crosses_production_from_units(
+      colony_, indoor_total_[e_indoor_job::crosses] );
+  return res;
+}
+
+} // namespace rn
@@ -0,0 +1,125 @@
+/****************************************************************
+**production-eval.hpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-19.
+*
+* Description: Evaluates the production of hypothetical job as-
+*              signments in a colony.
+*
+*****************************************************************/
+#pragma once
+
+#include "core-config.hpp"
+
+// Rds
+#include "production-eval.rds.hpp"
+
+// Revolution Now
+#include "maybe.hpp"
+#include "production.hpp"
+
+// ss
+#include "ss/colony-job.rds.hpp"
+#include "ss/unit-id.hpp"
+
+// refl
+#include "refl/enum-map.hpp"
+
+// C++ standard library
+#include <vector>
+
+namespace rn {
+
+/****************************************************************
+** Fwd. Decls.
+*****************************************************************/
+struct Colony;
+struct Player;
+struct SSConst;
+
+/****************************************************************
+** ProductionEvaluator
+*****************************************************************/
+// For searching over assignments of a colony's units to jobs, as
+// e.g. an AI or an auto-arrange feature would do. Everything
+// that does not depend on the assignment is computed once up
+// front: what each unit would yield working each job (which
+// covers the land yields, the building levels, expert and
+// founding father bonuses, and the sons of liberty modifiers) as
+// well as what the center square produces. After that, moving a
+// unit to a different job is O(1) and evaluating the resulting
+// assignment does not depend on the number of units.
+//
+// The units are the ones that are in the colony when this is
+// created and they start out working their current jobs. Only
+// their jobs can be changed, so the population and hence the
+// sons of liberty modifiers stay the same. Whether a unit is
+// actually allowed to work a given square (e.g. when it is owned
+// by the natives or it requires docks) is up to the caller. The
+// colony itself is never modified and it, along with the rest of
+// the game state, must not change while this is in use.
+//
+// The results agree with what production_for_colony yields for
+// the same assignment.
+struct ProductionEvaluator {
+  ProductionEvaluator( SSConst const& ss, Colony const& colony );
+
+  int num_units() const { return unit_ids_.size(); }
+
+  UnitId unit_id( int idx ) const;
+
+  ColonyJob const& job( int idx ) const;
+
+  // What the unit would produce by itself working the job. For
+  // manufactured goods this is before any limitation on the raw
+  // material. Teachers produce nothing.
+  int yield( int idx, ColonyJob const& job ) const;
+
+  // Whether there is room for another unit to work the job, i.e.
+  // the building exists and is not full, or the square exists
+  // and is not being worked.
+  bool has_room( ColonyJob const& job ) const;
+
+  // The unit must either already be working the job or there
+  // must be room for it.
+  void assign( int idx, ColonyJob const& job );
+
+  EvaluatedProduction evaluate() const;
+
+ private:
+  struct UnitYields {
+    refl::enum_map<e_direction,
+                   refl::enum_map<e_outdoor_job, int>>
+        outdoor;
+    refl::enum_map<e_indoor_job, int> indoor;
+  };
+
+  void add( int idx, int sign );
+
+  RawMaterialAndProduct raw_and_product(
+      e_outdoor_job outdoor_job, maybe<e_indoor_job> indoor_job,
+      int available_raw ) const;
+
+  // Fixed.
+  SSConst const& ss_;
+  Colony const& colony_;
+  Player const& player_;
+  std::vector<UnitId> unit_ids_;
+  std::vector<UnitYields> yields_;
+  refl::enum_map<e_indoor_job, maybe<e_colony_building>>
+      buildings_;
+  refl::enum_map<e_direction, bool> on_map_;
+  int center_food_ = 0;
+  maybe<SquareProduction> center_secondary_;
+
+  // Depends on the assignment.
+  std::vector<ColonyJob> jobs_;
+  refl::enum_map<e_outdoor_job, int> outdoor_total_;
+  refl::enum_map<e_indoor_job, int> indoor_total_;
+  refl::enum_map<e_indoor_job, int> indoor_count_;
+  refl::enum_map<e_direction, bool> occupied_;
+};
+
+} // namespace rn
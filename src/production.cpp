@@ -46,30 +46,6 @@ namespace rn {
 
 namespace {
 
-/****************************************************************
-** BellsModifiers
-*****************************************************************/
-struct BellsModifiers {
-  void apply( e_unit_activity activity, e_unit_type type,
-              int& to ) const {
-    bool const is_expert =
-        unit_attr( type ).expertise == activity;
-    if( to == 0 ) return;
-    to += is_expert ? sons_of_liberty_bonus_expert
-                    : sons_of_liberty_bonus_non_expert;
-    to -= tory_penalty;
-    if( to < 0 ) to = 0;
-  }
-
-  // Shouldn't really access these directly except to construct
-  // this object; to apply the bonuses use the above apply
-  // methods so that we ensure that the correct logic gets ap-
-  // plied.
-  int sons_of_liberty_bonus_non_expert = 0;
-  int sons_of_liberty_bonus_expert     = 0;
-  int tory_penalty                     = 0;
-};
-
 /****************************************************************
 ** Helpers
 *****************************************************************/
@@ -206,47 +182,36 @@ struct BuildingBonusResult {
   int put = 0;
 };
 
-int bells_production( SSConst const& ss, Player const& player,
-                      Colony const& colony,
-                      BellsModifiers const& bells_modifiers ) {
-  maybe<e_colony_building> maybe_building = building_for_slot(
-      colony, e_colony_building_slot::town_hall );
-  if( !maybe_building.has_value() ) {
-    // If we have no relevant buildings then we're left with the
-    // base value. Sanity check and leave.
-    CHECK( colony.indoor_jobs[e_indoor_job::bells].size() == 0 );
-    return 0;
-  }
-
-  e_colony_building const building = *maybe_building;
-
-  // For base bells from the building itself, the original game
-  // seems to do the following:
-  //
-  // 1. Add free building production (== 1).
-  // 2. Add Paine bonus, multiply by (1+tax rate) (round down).
-  //
-  // Note the Jefferson bonus does not apply here. This is prob-
-  // ably because the original game docs mention that his bonus
-  // only increases the bell production of statesmen.
-  //
-  // Also, sons of liberty bonuses don't appear to apply to base
-  // bell production. If they did, then a colony with one or two
-  // colonists, once it gets to 100, could (depending on liberty
-  // bell consumption) stay there comfortably with no statesmen.
-  // Also, the base production is not produced by a colonist, and
-  // sons of liberty bonuses (or tory penalties) are really sup-
-  // posed to apply to colonists.
-  //
-  // Not sure if the original game applies the Paine bonus, but
-  // it wouldn't really make a difference anyway, since even if
-  // the tax rate is 99% then the bonus (which rounds down) would
-  // yield nothing when applied to the base building production
-  // of 1. So we're just including it here for consistency.
-  //
-  // The printing press/newspaper bonuses also apply here techni-
-  // cally, but the original game appears to apply them at the
-  // very end after the colonist contributions are added in.
+// For base bells from the building itself, the original game
+// seems to do the following:
+//
+// 1. Add free building production (== 1).
+// 2. Add Paine bonus, multiply by (1+tax rate) (round down).
+//
+// Note the Jefferson bonus does not apply here. This is probably
+// because the original game docs mention that his bonus only in-
+// creases the bell production of statesmen.
+//
+// Also, sons of liberty bonuses don't appear to apply to base
+// bell production. If they did, then a colony with one or two
+// colonists, once it gets to 100, could (depending on liberty
+// bell consumption) stay there comfortably with no statesmen.
+// Also, the base production is not produced by a colonist, and
+// sons of liberty bonuses (or tory penalties) are really sup-
+// posed to apply to colonists.
+//
+// Not sure if the original game applies the Paine bonus, but it
+// wouldn't really make a difference anyway, since even if the
+// tax rate is 99% then the bonus (which rounds down) would yield
+// nothing when applied to the base building production of 1. So
+// we're just including it here for consistency.
+//
+// The printing press/newspaper bonuses also apply here techni-
+// cally, but the original game appears to apply them at the very
+// end after the colonist contributions are added in.
+int bells_production_for_building( SSConst const& ss,
+                                   Player const& player,
+                                   e_colony_building building ) {
   int buildings_quantity =
       config_production.free_building_production[building];
   if( player.fathers.has[e_founding_father::thomas_paine] )
@@ -265,84 +230,105 @@ int bells_production( SSConst const& ss, Player const& player,
     apply_int_percent_bonus_rnd_down(
         buildings_quantity,
         old_world_state( ss, player.type ).taxes.tax_rate );
+  return buildings_quantity;
+}
 
-  // For bells production from colonists, the original game seems
-  // to do the following:
-  //
-  //   1. Non-expert colonist amount (1, 2, 3); for expert
-  //      colonist use 3 (free colonist amount).
-  //   2. Add sons of liberty bonus/penalty (+1/+2).
-  //   3. Subtract tory penalty (-1)*tory_population/N, where N
-  //      is determined by difficulty level.
-  //   4. Multiply by two for expert.
-  //   5. Add Jefferson bonus, multiply by 1.5 (rounding up).
-  //   6. Add Paine bonus, multiply by (1+tax rate) (round down).
-
-  vector<UnitId> const& unit_ids =
-      colony.indoor_jobs[e_indoor_job::bells];
-  int units_quantity = 0;
-  bool const has_jefferson =
-      player.fathers.has[e_founding_father::thomas_jefferson];
-  bool const has_paine =
-      player.fathers.has[e_founding_father::thomas_paine];
-  for( UnitId id : unit_ids ) {
-    e_unit_type const unit_type = ss.units.unit_for( id ).type();
-    int unit_quantity =
-        base_indoor_production_for_colonist_indoor_job(
-            unit_type );
-    bells_modifiers.apply( e_unit_activity::bell_ringing,
-                           unit_type, unit_quantity );
-    if( indoor_unit_is_expert( e_indoor_job::bells, unit_type ) )
-      apply_int_percent_bonus_rnd_down(
-          unit_quantity,
-          config_production.indoor_production.expert_bonus );
-    if( has_jefferson )
-      apply_int_percent_bonus_rnd_up(
-          unit_quantity, config_production.indoor_production
-                             .thomas_jefferson_bells_bonus );
-    if( has_paine )
-      apply_int_percent_bonus_rnd_down(
-          unit_quantity,
-          old_world_state( ss, player.type ).taxes.tax_rate );
-
-    units_quantity += unit_quantity;
-  }
-
-  int const pre_newspaper_total =
-      buildings_quantity + units_quantity;
-
-  // Lastly, the original game will apply the printing press/new-
-  // paper bonuses after all others are added. This means:
-  //
-  //   - Multiply by 1.5 for printing press (rounding down) or 2
-  //     for newspaper.
-  //
-  // To emphasize, this multiplicative bonus applies to both the
-  // unit quantities and the town hall quantity.
-  int const post_newspaper_total = [&] {
-    maybe<e_colony_building> bells_bonus_building =
-        building_for_slot( colony,
-                           e_colony_building_slot::newspapers );
-    int res = pre_newspaper_total;
+// For bells production from colonists, the original game seems
+// to do the following:
+//
+//   1. Non-expert colonist amount (1, 2, 3); for expert colonist
+//      use 3 (free colonist amount).
+//   2. Add sons of liberty bonus/penalty (+1/+2).
+//   3. Subtract tory penalty (-1)*tory_population/N, where N is
+//      determined by difficulty level.
+//   4. Multiply by two for expert.
+//   5. Add Jefferson bonus, multiply by 1.5 (rounding up).
+//   6. Add Paine bonus, multiply by (1+tax rate) (round down).
+int bells_production_for_unit(
+    SSConst const& ss, Player const& player,
+    BellsModifiers const& bells_modifiers,
+    e_unit_type const unit_type ) {
+  int unit_quantity =
+      base_indoor_production_for_colonist_indoor_job(
+          unit_type );
+  bells_modifiers.apply( e_unit_activity::bell_ringing,
+                         unit_type, unit_quantity );
+  if( indoor_unit_is_expert( e_indoor_job::bells, unit_type ) )
     apply_int_percent_bonus_rnd_down(
-        res, bells_bonus_building.has_value()
-                 ? config_production.building_production_bonus
-                       [*bells_bonus_building]
-                 : 0 );
-    return res;
-  }();
+        unit_quantity,
+        config_production.indoor_production.expert_bonus );
+  if( player.fathers.has[e_founding_father::thomas_jefferson] )
+    apply_int_percent_bonus_rnd_up(
+        unit_quantity, config_production.indoor_production
+                           .thomas_jefferson_bells_bonus );
+  if( player.fathers.has[e_founding_father::thomas_paine] )
+    apply_int_percent_bonus_rnd_down(
+        unit_quantity,
+        old_world_state( ss, player.type ).taxes.tax_rate );
+  return unit_quantity;
+}
 
-  int const total = post_newspaper_total;
+int bells_production( SSConst const& ss, Player const& player,
+                      Colony const& colony,
+                      BellsModifiers const& bells_modifiers ) {
+  maybe<e_colony_building> maybe_building = building_for_slot(
+      colony, e_colony_building_slot::town_hall );
+  if( !maybe_building.has_value() ) {
+    // If we have no relevant buildings then we're left with the
+    // base value. Sanity check and leave.
+    CHECK( colony.indoor_jobs[e_indoor_job::bells].size() == 0 );
+    return 0;
+  }
+  int units_quantity = 0;
+  for( UnitId id : colony.indoor_jobs[e_indoor_job::bells] )
+    units_quantity += bells_production_for_unit(
+        ss, player, bells_modifiers,
+        ss.units.unit_for( id ).type() );
+  return bells_production_from_units( ss, player, colony,
+                                      units_quantity );
+}
 
-  return total;
+// The original game seems to compute colonist contributions in
+// this way:
+//
+//   1. Non-expert colonist amount (1, 2, 3); for expert colonist
+//      use 3 (free colonist amount).
+//   2. Multiply by two for expert.
+//   3. Add sons of liberty bonus/penalty (+2).
+//   4. Subtract tory penalty (-1)*tory_population/N, where N is
+//      determined by difficulty level.
+//   5. Multiply by two for building bonus.
+//   6. Add William Penn bonus, multiply by 1.5 (round down).
+//
+// The original game appears to apply the William Penn bonus on a
+// per-colonist basis, and rounds down.
+int crosses_production_for_unit(
+    Player const& player, BellsModifiers const& bells_modifiers,
+    e_colony_building const building,
+    e_unit_type const unit_type ) {
+  int unit_quantity =
+      base_indoor_production_for_colonist_indoor_job(
+          unit_type );
+  if( indoor_unit_is_expert( e_indoor_job::crosses, unit_type ) )
+    apply_int_percent_bonus_rnd_down(
+        unit_quantity,
+        config_production.indoor_production.expert_bonus );
+  bells_modifiers.apply( e_unit_activity::preaching, unit_type,
+                         unit_quantity );
+  apply_int_percent_bonus_rnd_down(
+      unit_quantity,
+      config_production.building_production_bonus[building] );
+  if( player.fathers.has[e_founding_father::william_penn] )
+    apply_int_percent_bonus_rnd_down(
+        unit_quantity, config_production.indoor_production
+                           .william_penn_crosses_bonus );
+  return unit_quantity;
 }
 
 int crosses_production_for_colony(
     UnitsState const& units_state, Player const& player,
     Colony const& colony,
     BellsModifiers const& bells_modifiers ) {
-  int const base_quantity = config_production.base_crosses;
-
   maybe<e_colony_building> maybe_building = building_for_slot(
       colony, e_colony_building_slot::crosses );
   if( !maybe_building.has_value() ) {
@@ -350,104 +336,30 @@ int crosses_production_for_colony(
     // base value. Sanity check and leave.
     CHECK( colony.indoor_jobs[e_indoor_job::crosses].size() ==
            0 );
-    return base_quantity;
+    return crosses_production_from_units( colony, 0 );
   }
-  e_colony_building const building = *maybe_building;
-
-  int const buildings_quantity =
-      config_production.free_building_production[building];
-
-  // In the original game, base crosses don't seem to have any
-  // bonuses applied, even together with colonists.
-
-  // The original game seems to compute colonist contributions in
-  // this way:
-  //
-  //   1. Non-expert colonist amount (1, 2, 3); for expert
-  //      colonist use 3 (free colonist amount).
-  //   2. Multiply by two for expert.
-  //   3. Add sons of liberty bonus/penalty (+2).
-  //   4. Subtract tory penalty (-1)*tory_population/N, where N
-  //      is determined by difficulty level.
-  //   5. Multiply by two for building bonus.
-  //   6. Add William Penn bonus, multiply by 1.5 (round down).
-  //
-  // The original game appears to apply the William Penn bonus on
-  // a per-colonist basis, and rounds down.
-  vector<UnitId> const& unit_ids =
-      colony.indoor_jobs[e_indoor_job::crosses];
   int units_quantity = 0;
-  bool const has_penn =
-      player.fathers.has[e_founding_father::william_penn];
-  for( UnitId id : unit_ids ) {
-    int unit_quantity = 0;
-    e_unit_type const unit_type =
-        units_state.unit_for( id ).type();
-    unit_quantity =
-        base_indoor_production_for_colonist_indoor_job(
-            unit_type );
-    if( indoor_unit_is_expert( e_indoor_job::crosses,
-                               unit_type ) )
-      apply_int_percent_bonus_rnd_down(
-          unit_quantity,
-          config_production.indoor_production.expert_bonus );
-    bells_modifiers.apply( e_unit_activity::preaching, unit_type,
-                           unit_quantity );
-    apply_int_percent_bonus_rnd_down(
-        unit_quantity,
-        config_production.building_production_bonus[building] );
-    if( has_penn )
-      apply_int_percent_bonus_rnd_down(
-          unit_quantity, config_production.indoor_production
-                             .william_penn_crosses_bonus );
-    units_quantity += unit_quantity;
-  }
-
-  int total =
-      base_quantity + buildings_quantity + units_quantity;
-
-  return total;
+  for( UnitId id : colony.indoor_jobs[e_indoor_job::crosses] )
+    units_quantity += crosses_production_for_unit(
+        player, bells_modifiers, *maybe_building,
+        units_state.unit_for( id ).type() );
+  return crosses_production_from_units( colony, units_quantity );
 }
 
 void compute_food_production(
-    TerrainState const& terrain_state,
-    UnitsState const& units_state, Colony const& colony,
-    Player const& player, BellsModifiers const& bells_modifiers,
-    int const center_food_produced, FoodProduction& out,
-    refl::enum_map<e_direction, SquareProduction>&
-        out_land_production ) {
+    Colony const& colony, ColonyLandYields const& yields,
+    FoodProduction& out ) {
   for( e_direction d : refl::enum_values<e_direction> ) {
     if( maybe<OutdoorUnit> const& unit = colony.outdoor_jobs[d];
-        unit.has_value() && unit->job == e_outdoor_job::food ) {
-      e_unit_type const unit_type =
-          units_state.unit_for( unit->unit_id ).type();
-      int quantity = production_on_square(
-          e_outdoor_job::food, terrain_state, player.fathers.has,
-          unit_type, colony.location.moved( d ) );
-      bells_modifiers.apply( e_unit_activity::farming, unit_type,
-                             quantity );
-      out.corn_produced += quantity;
-      out_land_production[d] = SquareProduction{
-        .what = e_outdoor_job::food, .quantity = quantity };
-    }
+        unit.has_value() && unit->job == e_outdoor_job::food )
+      out.corn_produced += yields.land_production[d].quantity;
   }
-  // This must have already been computed.
-  out.corn_produced += center_food_produced;
+  out.corn_produced += yields.center_food_production;
 
   for( e_direction d : refl::enum_values<e_direction> ) {
     if( maybe<OutdoorUnit> const& unit = colony.outdoor_jobs[d];
-        unit.has_value() && unit->job == e_outdoor_job::fish ) {
-      e_unit_type const unit_type =
-          units_state.unit_for( unit->unit_id ).type();
-      int quantity = production_on_square(
-          e_outdoor_job::fish, terrain_state, player.fathers.has,
-          unit_type, colony.location.moved( d ) );
-      bells_modifiers.apply( e_unit_activity::fishing, unit_type,
-                             quantity );
-      out.fish_produced += quantity;
-      out_land_production[d] = SquareProduction{
-        .what = e_outdoor_job::fish, .quantity = quantity };
-    }
+        unit.has_value() && unit->job == e_outdoor_job::fish )
+      out.fish_produced += yields.land_production[d].quantity;
   }
 
   out.food_produced = out.corn_produced + out.fish_produced;
@@ -551,42 +463,65 @@ void compute_food_production(
   }
 }
 
-void compute_raw(
-    Colony const& colony, TerrainState const& terrain_state,
-    UnitsState const& units_state, Player const& player,
-    e_outdoor_job outdoor_job,
-    maybe<SquareProduction const&> center_secondary,
-    BellsModifiers const& bells_modifiers,
-    RawMaterialAndProduct& out,
-    refl::enum_map<e_direction, SquareProduction>&
-        out_land_production ) {
+void compute_raw( Colony const& colony,
+                  ColonyLandYields const& yields,
+                  e_outdoor_job outdoor_job,
+                  RawMaterialAndProduct& out ) {
   for( e_direction d : refl::enum_values<e_direction> ) {
     if( maybe<OutdoorUnit> const& unit = colony.outdoor_jobs[d];
-        unit.has_value() && unit->job == outdoor_job ) {
-      e_unit_type const unit_type =
-          units_state.unit_for( unit->unit_id ).type();
-      int quantity = production_on_square(
-          outdoor_job, terrain_state, player.fathers.has,
-          unit_type, colony.location.moved( d ) );
-      bells_modifiers.apply(
-          activity_for_outdoor_job( outdoor_job ), unit_type,
-          quantity );
-      out.raw_produced += quantity;
-      out_land_production[d] = SquareProduction{
-        .what = outdoor_job, .quantity = quantity };
-    }
+        unit.has_value() && unit->job == outdoor_job )
+      out.raw_produced += yields.land_production[d].quantity;
   }
 
-  if( center_secondary.has_value() &&
-      center_secondary->what == outdoor_job )
-    // This must have already been computed.
-    out.raw_produced += center_secondary->quantity;
+  if( yields.center_extra_production.has_value() &&
+      yields.center_extra_production->what == outdoor_job )
+    out.raw_produced += yields.center_extra_production->quantity;
 
   // This may be ammended if there is a product produced from
   // this raw good.
   out.raw_delta_theoretical = out.raw_produced;
 }
 
+// For each unit, the original game appears to apply bonuses in
+// the following way to arrive at the "put" quantity per colo-
+// nist, which is the amount produced per colonist. In general
+// this differs from the amount of raw material consumed due to
+// factory level buildings. The original game appears to compute
+// the "put" first, sum it over all colonists, then derive the
+// consumed quantity from it.
+//
+//   1. Non-expert colonist amount (1, 2, 3); for expert colonist
+//      use 3 (free colonist amount).
+//   2. Multiply by 2 for building upgrade.
+//   3. Add sons of liberty bonus (+1/+2).
+//   4. Subtract tory penalty (-1)*tory_population/N, where N is
+//      determined by difficulty level.
+//   5. Multiply by 1.5 for factory level (rounding down).
+//   6. Multiply by 2 for expert.
+//
+int product_put_for_unit( BellsModifiers const& bells_modifiers,
+                          e_indoor_job const indoor_job,
+                          e_colony_building const building,
+                          e_unit_type const unit_type ) {
+  int unit_quantity_put =
+      base_indoor_production_for_colonist_indoor_job(
+          unit_type );
+  apply_int_percent_bonus_rnd_down(
+      unit_quantity_put,
+      config_production.building_production_bonus[building] );
+  bells_modifiers.apply( activity_for_indoor_job( indoor_job ),
+                         unit_type, unit_quantity_put );
+  // Note the factory bonus may be zero.
+  apply_int_percent_bonus_rnd_down(
+      unit_quantity_put,
+      config_production.factory_bonus[building] );
+  if( indoor_unit_is_expert( indoor_job, unit_type ) )
+    apply_int_percent_bonus_rnd_down(
+        unit_quantity_put,
+        config_production.indoor_production.expert_bonus );
+  return unit_quantity_put;
+}
+
 void compute_product( Colony const& colony,
                       e_indoor_job indoor_job,
                       UnitsState const& units_state,
@@ -602,91 +537,22 @@ void compute_product( Colony const& colony,
     return;
   }
 
-  // For each unit, the original game appears to apply bonuses in
-  // the following way to arrive at the "put" quantity per
-  // colonist, which is the amount produced per colonist. In gen-
-  // eral this differs from the amount of raw material consumed
-  // due to factory level buildings. The original game appears to
-  // compute the "put" first, sum it over all colonists, then de-
-  // rive the consumed quantity from it.
-  //
-  //   1. Non-expert colonist amount (1, 2, 3); for expert
-  //      colonist use 3 (free colonist amount).
-  //   2. Multiply by 2 for building upgrade.
-  //   3. Add sons of liberty bonus (+1/+2).
-  //   4. Subtract tory penalty (-1)*tory_population/N, where N
-  //      is determined by difficulty level.
-  //   5. Multiply by 1.5 for factory level (rounding down).
-  //   6. Multiply by 2 for expert.
-  //
   int units_quantity_put = 0;
-  for( UnitId unit_id : colony.indoor_jobs[indoor_job] ) {
-    int unit_quantity_put = 0;
-    e_unit_type const unit_type =
-        units_state.unit_for( unit_id ).type();
-    unit_quantity_put +=
-        base_indoor_production_for_colonist_indoor_job(
-            unit_type );
-    apply_int_percent_bonus_rnd_down(
-        unit_quantity_put,
-        config_production.building_production_bonus[*building] );
-    bells_modifiers.apply( activity_for_indoor_job( indoor_job ),
-                           unit_type, unit_quantity_put );
-    // Note the factory bonus may be zero.
-    apply_int_percent_bonus_rnd_down(
-        unit_quantity_put,
-        config_production.factory_bonus[*building] );
-    if( indoor_unit_is_expert( indoor_job, unit_type ) )
-      apply_int_percent_bonus_rnd_down(
-          unit_quantity_put,
-          config_production.indoor_production.expert_bonus );
-
-    units_quantity_put += unit_quantity_put;
-  }
-
-  out.product_produced_theoretical += units_quantity_put;
-
-  // The "put" quantity has already been inflated, so now we de-
-  // flate it to get the consumption quantity (this seems to be
-  // how the original game does it, and it matters because of the
-  // fact that it is being applied to the sum of all colonists'
-  // production and the rounding behavior).
-  int const consumed_theoretical = apply_factory_reduction(
-      units_quantity_put,
-      config_production.factory_bonus[*building] );
-
-  out.raw_consumed_theoretical = consumed_theoretical;
-  out.raw_delta_theoretical -= out.raw_consumed_theoretical;
+  for( UnitId unit_id : colony.indoor_jobs[indoor_job] )
+    units_quantity_put += product_put_for_unit(
+        bells_modifiers, indoor_job, *building,
+        units_state.unit_for( unit_id ).type() );
 
-  // The quantities actually produced and consumed might have to
-  // be lowered from their theoretical values if there isn't
-  // enough total supply of the raw material. But because the
-  // building might be factory-level we need to then recompute
-  // what is actually produced using the factory bonus.
-  //
   // Note that the colony commodities at this point will already
   // include the raw product this turn.
-  int const available_raw_input =
-      colony.commodities[raw_commodity];
-  out.raw_consumed_actual = std::min(
-      out.raw_consumed_theoretical, available_raw_input );
-  // Theoretically there is an ambiguity here as to whether we
-  // should round up or down. In the above, when we apply the
-  // factory bonus to derive the "put" value, we round down (be-
-  // cause the original game seems to do that). That means that
-  // there are multiple values that could lead to a certain "con-
-  // sumed" value. The original game appears to round up here, so
-  // we will do that.
-  out.product_produced_actual = out.raw_consumed_actual;
-  apply_int_percent_bonus_rnd_up(
-      out.product_produced_actual,
-      config_production.factory_bonus[*building] );
+  product_from_units( *building, units_quantity_put,
+                      colony.commodities[raw_commodity], out );
 }
 
 void compute_land_production(
     ColonyProduction& pr, Colony const& colony_pristine,
-    TerrainState const& terrain_state,
-    UnitsState const& units_state, Player const& player,
+    ColonyLandYields const& yields,
+    UnitsState const& units_state,
     BellsModifiers const& bells_modifiers ) {
   // FIXME: copying not optimal.
   Colony colony = colony_pristine;
@@ -706,10 +572,7 @@ void compute_land_production(
 
   auto compute = [&]( e_outdoor_job outdoor_job,
                       RawMaterialAndProduct& raw_and_product ) {
-    compute_raw( colony, terrain_state, units_state, player,
-                 outdoor_job, pr.center_extra_production,
-                 bells_modifiers, raw_and_product,
-                 pr.land_production );
+    compute_raw( colony, yields, outdoor_job, raw_and_product );
     e_commodity const raw =
         commodity_for_outdoor_job( outdoor_job );
     colony.commodities[raw] += raw_and_product.raw_produced;
@@ -773,10 +636,7 @@ void compute_land_production(
   colony.commodities[e_commodity::tools] -=
       pr.tools_muskets.raw_consumed_actual;
 
-  compute_food_production( terrain_state, units_state, colony,
-                           player, bells_modifiers,
-                           pr.center_food_production,
-                           pr.food_horses, pr.land_production );
+  compute_food_production( colony, yields, pr.food_horses );
   colony.commodities[e_commodity::horses] +=
       pr.food_horses.horses_produced_actual;
 
@@ -827,7 +687,7 @@ void compute_land_production(
 void fill_in_center_square(
     SSConst const& ss, Colony const& colony,
     Player const& player, BellsModifiers const& bells_modifiers,
-    ColonyProduction& pr ) {
+    ColonyLandYields& yields ) {
   MapSquare const& square =
       ss.terrain.square_at( colony.location );
 
@@ -836,10 +696,11 @@ void fill_in_center_square(
   e_unit_type const unit_type = e_unit_type::free_colonist;
 
   // Food.
-  pr.center_food_production = food_production_on_center_square(
-      square, ss.settings.game_setup_options.difficulty );
+  yields.center_food_production =
+      food_production_on_center_square(
+          square, ss.settings.game_setup_options.difficulty );
   bells_modifiers.apply( e_unit_activity::farming, unit_type,
-                         pr.center_food_production );
+                         yields.center_food_production );
 
   // Secondary good.
   maybe<e_outdoor_commons_secondary_job> center_secondary =
@@ -849,7 +710,7 @@ void fill_in_center_square(
   if( !center_secondary.has_value() ) return;
   e_outdoor_job const outdoor_job =
       to_outdoor_job( *center_secondary );
-  pr.center_extra_production = SquareProduction{
+  yields.center_extra_production = SquareProduction{
     .what = outdoor_job,
     // Note that this quantity must be checked by the functions
     // dedicated to individual goods in order to factor them in
@@ -857,58 +718,9 @@ void fill_in_center_square(
     .quantity = commodity_production_on_center_square(
         *center_secondary, square, player,
         ss.settings.game_setup_options.difficulty ) };
-  bells_modifiers.apply( activity_for_outdoor_job( outdoor_job ),
-                         unit_type,
-                         pr.center_extra_production->quantity );
-}
-
-BellsModifiers compute_bells_modifiers(
-    Player const& player, Colony const& colony,
-    e_difficulty difficulty ) {
-  int const population = colony_population( colony );
-
-  // This won't happen in practice because the game does not
-  // allow zero-population colonies, but it is useful for unit
-  // tests where that something happens, and which would other-
-  // wise cause code below to check-fail. Conceptually it makes
-  // sense either way, because a population zero colony cannot
-  // have any sons of liberty, and thus no sons of liberty bonus,
-  // and also has no tories, so cannot have a tory penalty.
-  if( population == 0 ) return BellsModifiers{};
-
-  double const sons_of_liberty_percent =
-      compute_sons_of_liberty_percent(
-          colony.sons_of_liberty.num_rebels_from_bells_only,
-          population,
-          player.fathers.has[e_founding_father::simon_bolivar] );
-
-  int const sons_of_liberty_integral_percent =
-      compute_sons_of_liberty_integral_percent(
-          sons_of_liberty_percent );
-
-  int const sons_of_liberty_number =
-      compute_sons_of_liberty_number(
-          sons_of_liberty_integral_percent, population );
-
-  int const tory_number =
-      compute_tory_number( sons_of_liberty_number, population );
-
-  int const tory_penalty =
-      compute_tory_penalty( difficulty, tory_number );
-
-  int const sons_of_liberty_bonus_non_expert =
-      compute_sons_of_liberty_bonus(
-          sons_of_liberty_integral_percent,
-          /*is_expert=*/false );
-  int const sons_of_liberty_bonus_expert =
-      compute_sons_of_liberty_bonus(
-          sons_of_liberty_integral_percent, /*is_expert=*/true );
-
-  return BellsModifiers{
-    .sons_of_liberty_bonus_non_expert =
-        sons_of_liberty_bonus_non_expert,
-    .sons_of_liberty_bonus_expert = sons_of_liberty_bonus_expert,
-    .tory_penalty                 = tory_penalty };
+  bells_modifiers.apply(
+      activity_for_outdoor_job( outdoor_job ), unit_type,
+      yields.center_extra_production->quantity );
 }
 
 } // namespace
@@ -1031,8 +843,40 @@ maybe<int> production_for_slot( ColonyProduction const& pr,
   }
 }
 
+ColonyLandYields land_yields_for_colony(
+    SSConst const& ss, Colony const& colony ) {
+  ColonyLandYields res;
+  UNWRAP_CHECK( player, ss.players.players[colony.player] );
+
+  BellsModifiers const bells_modifiers = compute_bells_modifiers(
+      player, colony,
+      ss.settings.game_setup_options.difficulty );
+
+  fill_in_center_square( ss, colony, player, bells_modifiers,
+                         res );
+
+  for( auto const& [d, unit] : colony.outdoor_jobs ) {
+    if( !unit.has_value() ) continue;
+    e_unit_type const unit_type =
+        ss.units.unit_for( unit->unit_id ).type();
+    res.land_production[d] = SquareProduction{
+      .what     = unit->job,
+      .quantity = outdoor_production_for_unit(
+          ss.terrain, player, bells_modifiers, unit->job,
+          unit_type, colony.location.moved( d ) ) };
+  }
+  return res;
+}
+
 ColonyProduction production_for_colony( SSConst const& ss,
                                         Colony const& colony ) {
+  return production_for_colony(
+      ss, colony, land_yields_for_colony( ss, colony ) );
+}
+
+ColonyProduction production_for_colony(
+    SSConst const& ss, Colony const& colony,
+    ColonyLandYields const& yields ) {
   ColonyProduction res;
   UNWRAP_CHECK( player, ss.players.players[colony.player] );
 
@@ -1047,13 +891,12 @@ ColonyProduction production_for_colony( SSConst const& ss,
   res.bells =
       bells_production( ss, player, colony, bells_modifiers );
 
-  // Note that this must be done before processing any of the
-  // other land squares.
-  fill_in_center_square( ss, colony, player, bells_modifiers,
-                         res );
+  res.land_production         = yields.land_production;
+  res.center_food_production  = yields.center_food_production;
+  res.center_extra_production = yields.center_extra_production;
 
-  compute_land_production( res, colony, ss.terrain, ss.units,
-                           player, bells_modifiers );
+  compute_land_production( res, colony, yields, ss.units,
+                           bells_modifiers );
 
   CHECK( res.trade_goods == 0 );
   return res;
@@ -1106,4 +949,189 @@ ColonyViewFoodStats compute_colony_view_food_stats(
                               .deficit  = deficit };
 }
 
+/****************************************************************
+** Building Blocks
+*****************************************************************/
+void BellsModifiers::apply( e_unit_activity activity,
+                            e_unit_type type, int& to ) const {
+  bool const is_expert = unit_attr( type ).expertise == activity;
+  if( to == 0 ) return;
+  to += is_expert ? sons_of_liberty_bonus_expert
+                  : sons_of_liberty_bonus_non_expert;
+  to -= tory_penalty;
+  if( to < 0 ) to = 0;
+}
+
+BellsModifiers compute_bells_modifiers(
+    Player const& player, Colony const& colony,
+    e_difficulty difficulty ) {
+  int const population = colony_population( colony );
+
+  // This won't happen in practice because the game does not
+  // allow zero-population colonies, but it is useful for unit
+  // tests where that something happens, and which would other-
+  // wise cause code below to check-fail. Conceptually it makes
+  // sense either way, because a population zero colony cannot
+  // have any sons of liberty, and thus no sons of liberty bonus,
+  // and also has no tories, so cannot have a tory penalty.
+  if( population == 0 ) return BellsModifiers{};
+
+  double const sons_of_liberty_percent =
+      compute_sons_of_liberty_percent(
+          colony.sons_of_liberty.num_rebels_from_bells_only,
+          population,
+          player.fathers.has[e_founding_father::simon_bolivar] );
+
+  int const sons_of_liberty_integral_percent =
+      compute_sons_of_liberty_integral_percent(
+          sons_of_liberty_percent );
+
+  int const sons_of_liberty_number =
+      compute_sons_of_liberty_number(
+          sons_of_liberty_integral_percent, population );
+
+  int const tory_number =
+      compute_tory_number( sons_of_liberty_number, population );
+
+  int const tory_penalty =
+      compute_tory_penalty( difficulty, tory_number );
+
+  int const sons_of_liberty_bonus_non_expert =
+      compute_sons_of_liberty_bonus(
+          sons_of_liberty_integral_percent,
+          /*is_expert=*/false );
+  int const sons_of_liberty_bonus_expert =
+      compute_sons_of_liberty_bonus(
+          sons_of_liberty_integral_percent, /*is_expert=*/true );
+
+  return BellsModifiers{
+    .sons_of_liberty_bonus_non_expert =
+        sons_of_liberty_bonus_non_expert,
+    .sons_of_liberty_bonus_expert = sons_of_liberty_bonus_expert,
+    .tory_penalty                 = tory_penalty };
+}
+
+int outdoor_production_for_unit(
+    TerrainState const& terrain_state, Player const& player,
+    BellsModifiers const& bells_modifiers, e_outdoor_job job,
+    e_unit_type unit_type, Coord where ) {
+  int quantity = production_on_square(
+      job, terrain_state, player.fathers.has, unit_type, where );
+  bells_modifiers.apply( activity_for_outdoor_job( job ),
+                         unit_type, quantity );
+  return quantity;
+}
+
+int indoor_production_for_unit(
+    SSConst const& ss, Player const& player,
+    BellsModifiers const& bells_modifiers, e_indoor_job job,
+    e_colony_building building, e_unit_type unit_type ) {
+  switch( job ) {
+    case e_indoor_job::bells:
+      return bells_production_for_unit(
+          ss, player, bells_modifiers, unit_type );
+    case e_indoor_job::crosses:
+      return crosses_production_for_unit(
+          player, bells_modifiers, building, unit_type );
+    case e_indoor_job::hammers:
+    case e_indoor_job::rum:
+    case e_indoor_job::cigars:
+    case e_indoor_job::cloth:
+    case e_indoor_job::coats:
+    case e_indoor_job::tools:
+    case e_indoor_job::muskets:
+      return product_put_for_unit( bells_modifiers, job,
+                                   building, unit_type );
+    case e_indoor_job::teacher:
+      return 0;
+  }
+}
+
+int bells_production_from_units( SSConst const& ss,
+                                 Player const& player,
+                                 Colony const& colony,
+                                 int units_quantity ) {
+  maybe<e_colony_building> const building = building_for_slot(
+      colony, e_colony_building_slot::town_hall );
+  if( !building.has_value() ) {
+    CHECK_EQ( units_quantity, 0 );
+    return 0;
+  }
+
+  int const pre_newspaper_total =
+      bells_production_for_building( ss, player, *building ) +
+      units_quantity;
+
+  // Lastly, the original game will apply the printing press/new-
+  // paper bonuses after all others are added. This means:
+  //
+  //   - Multiply by 1.5 for printing press (rounding down) or 2
+  //     for newspaper.
+  //
+  // To emphasize, this multiplicative bonus applies to both the
+  // unit quantities and the town hall quantity.
+  maybe<e_colony_building> const bells_bonus_building =
+      building_for_slot( colony,
+                         e_colony_building_slot::newspapers );
+  int total = pre_newspaper_total;
+  apply_int_percent_bonus_rnd_down(
+      total, bells_bonus_building.has_value()
+                 ? config_production.building_production_bonus
+                       [*bells_bonus_building]
+                 : 0 );
+  return total;
+}
+
+int crosses_production_from_units( Colony const& colony,
+                                   int units_quantity ) {
+  int const base_quantity = config_production.base_crosses;
+  maybe<e_colony_building> const building = building_for_slot(
+      colony, e_colony_building_slot::crosses );
+  if( !building.has_value() ) {
+    CHECK_EQ( units_quantity, 0 );
+    return base_quantity;
+  }
+  int const buildings_quantity =
+      config_production.free_building_production[*building];
+  // In the original game, base crosses don't seem to have any
+  // bonuses applied, even together with colonists.
+  return base_quantity + buildings_quantity + units_quantity;
+}
+
+void product_from_units( e_colony_building building,
+                         int units_put, int available_raw,
+                         RawMaterialAndProduct& out ) {
+  out.product_produced_theoretical += units_put;
+
+  // The "put" quantity has already been inflated, so now we de-
+  // flate it to get the consumption quantity (this seems to be
+  // how the original game does it, and it matters because of the
+  // fact that it is being applied to the sum of all colonists'
+  // production and the rounding behavior).
+  int const consumed_theoretical = apply_factory_reduction(
+      units_put, config_production.factory_bonus[building] );
+
+  out.raw_consumed_theoretical = consumed_theoretical;
+  out.raw_delta_theoretical -= out.raw_consumed_theoretical;
+
+  // The quantities actually produced and consumed might have to
+  // be lowered from their theoretical values if there isn't
+  // enough total supply of the raw material. But because the
+  // building might be factory-level we need to then recompute
+  // what is actually produced using the factory bonus.
+  out.raw_consumed_actual =
+      std::min( out.raw_consumed_theoretical, available_raw );
+  // Theoretically there is an ambiguity here as to whether we
+  // should round up or down. In the above, when we apply the
+  // factory bonus to derive the "put" value, we round down (be-
+  // cause the original game seems to do that). That means that
+  // there are multiple values that could lead to a certain "con-
+  // sumed" value. The original game appears to round up here, so
+  // we will do that.
+  out.product_produced_actual = out.raw_consumed_actual;
+  apply_int_percent_bonus_rnd_up(
+      out.product_produced_actual,
+      config_production.factory_bonus[building] );
+}
+
 } // namespace rn
@@ -19,10 +19,19 @@
 #include "colony-enums.rds.hpp"
 #include "production.rds.hpp"
 
+// ss
+#include "ss/difficulty.rds.hpp"
+#include "ss/unit-type.rds.hpp"
+
+// gfx
+#include "gfx/coord.hpp"
+
 namespace rn {
 
 struct Colony;
+struct Player;
 struct SSConst;
+struct TerrainState;
 
 // Computes everything that is produced and consumed by the
 // colony in one turn, given the current state of the colony, all
@@ -32,6 +41,19 @@ struct SSConst;
 ColonyProduction production_for_colony( SSConst const& ss,
                                         Colony const& colony );
 
+// Same as above but with the land yields already computed, which
+// must have been computed from the current state of the colony's
+// outdoor units and surroundings (see production-cache.hpp).
+ColonyProduction production_for_colony(
+    SSConst const& ss, Colony const& colony,
+    ColonyLandYields const& yields );
+
+// Computes what is yielded by the units working the land around
+// the colony and by the center square. This is the part of
+// production_for_colony that depends on the terrain.
+ColonyLandYields land_yields_for_colony( SSConst const& ss,
+                                         Colony const& colony );
+
 // Given a building slot, will extract the quantity of the thing
 // currently being produced there. Note that this yields the
 // quantity for display in the colony view, which does not ex-
@@ -53,4 +75,73 @@ int const& final_production_delta_for_commodity(
 ColonyViewFoodStats compute_colony_view_food_stats(
     ColonyProduction const& production );
 
+/****************************************************************
+** Building Blocks
+*****************************************************************/
+// The functions in this section are the pieces out of which
+// production_for_colony is assembled. They are exposed so that
+// code that needs to evaluate many hypothetical job assignments
+// (see production-eval.hpp) can arrive at the same numbers
+// without recomputing everything for each one.
+
+// The bonuses/penalties that are applied to each unit's produc-
+// tion as a result of the colony's sons of liberty membership.
+// These depend only on the population of the colony and not on
+// what the units are doing.
+struct BellsModifiers {
+  void apply( e_unit_activity activity, e_unit_type type,
+              int& to ) const;
+
+  // Shouldn't really access these directly except to construct
+  // this object; to apply the bonuses use the above apply
+  // methods so that we ensure that the correct logic gets ap-
+  // plied.
+  int sons_of_liberty_bonus_non_expert = 0;
+  int sons_of_liberty_bonus_expert     = 0;
+  int tory_penalty                     = 0;
+
+  bool operator==( BellsModifiers const& ) const = default;
+};
+
+BellsModifiers compute_bells_modifiers(
+    Player const& player, Colony const& colony,
+    e_difficulty difficulty );
+
+// What a single unit of the given type produces when working the
+// given job on the given (non-center) square.
+int outdoor_production_for_unit(
+    TerrainState const& terrain_state, Player const& player,
+    BellsModifiers const& bells_modifiers, e_outdoor_job job,
+    e_unit_type unit_type, Coord where );
+
+// What a single unit of the given type produces when working the
+// given job in the given building, with all of the bonuses that
+// apply per-unit. For manufactured goods this is the "put" quan-
+// tity, i.e. before the amount of raw material is considered.
+// Teachers don't produce anything.
+int indoor_production_for_unit(
+    SSConst const& ss, Player const& player,
+    BellsModifiers const& bells_modifiers, e_indoor_job job,
+    e_colony_building building, e_unit_type unit_type );
+
+// Total bells produced by the colony given the sum of what is
+// produced by the units working in its town hall.
+int bells_production_from_units( SSConst const& ss,
+                                 Player const& player,
+                                 Colony const& colony,
+                                 int units_quantity );
+
+// Total crosses produced by the colony given the sum of what is
+// produced by the units working in its church.
+int crosses_production_from_units( Colony const& colony,
+                                   int units_quantity );
+
+// Given the sum of the "put" quantities of the units working in
+// the building, fills in what is consumed and produced, limited
+// by the amount of raw material available. Expects that the raw
+// fields of `out` have already been filled in.
+void product_from_units( e_colony_building building,
+                         int units_put, int available_raw,
+                         RawMaterialAndProduct& out );
+
 } // namespace rn
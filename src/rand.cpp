@@ -21,6 +21,10 @@ void Rand::reseed( rng::entropy const& seed ) {
   rd_.reseed( seed );
 }
 
+void Rand::set_engine( rng::e_rng_engine const engine ) {
+  rd_.set_engine( engine );
+}
+
 bool Rand::bernoulli( double p ) { return rd_.bernoulli( p ); }
 
 int Rand::uniform_int( int lower, int upper ) {
@@ -46,6 +46,8 @@ struct Rand : IRand {
 
   void reseed( rng::entropy const& seed ) override;
 
+  void set_engine( rng::e_rng_engine engine ) override;
+
  public: // IRand.
   [[nodiscard]] bool bernoulli( double p ) override;
 
@@ -105,6 +105,19 @@ entropy entropy::mixed() const {
   return copy;
 }
 
+entropy entropy::derived( uint32_t const id ) const {
+  // NOTE: This should not be changed since it determines the
+  // meaning of derived seeds. Since the mixing is a bijection,
+  // distinct ids always give distinct seeds. Two rounds so that
+  // the id affects every bit of the result.
+  entropy res = *this;
+  res.e1 ^= id;
+  res.e3 ^= ~id;
+  res.mix();
+  res.mix();
+  return res;
+}
+
 void entropy::rotate_right_n_bytes( uint8_t const n_bytes ) {
   for( int i = 0; i < n_bytes % 16; ++i ) {
     uint32_t const lsb1 = e1 & 0xff;
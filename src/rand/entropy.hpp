@@ -59,6 +59,21 @@ struct entropy {
 
   [[nodiscard]] entropy mixed() const;
 
+  // ------------------------------------------------------------
+  // Substreams.
+  // ------------------------------------------------------------
+  // Derives a new seed that is keyed by this one and the given
+  // id, e.g. a turn number, subsystem, or entity id. Different
+  // ids give seeds that are unrelated to each other and to this
+  // one. Can be chained to key on several ids:
+  //
+  //   seed.derived( turn ).derived( subsystem ).derived( id )
+  //
+  // which together with a counter-based engine (see philox.hpp)
+  // gives an independent reproducible stream for each combina-
+  // tion in O(1) without drawing anything from a parent stream.
+  [[nodiscard]] entropy derived( uint32_t id ) const;
+
   // ------------------------------------------------------------
   // Consuming.
   // ------------------------------------------------------------
@@ -0,0 +1,95 @@
+/****************************************************************
+**philox.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Counter-based pseudo-random engine.
+*
+*****************************************************************/
+#include "philox.hpp"
+
+// rand
+#include "entropy.hpp"
+
+// C++ standard library
+#include <random>
+
+namespace rng {
+
+namespace {
+
+using namespace std;
+
+static_assert( uniform_random_bit_generator<philox4x32> );
+
+// NOTE: these come from the reference implementation and must
+// not be changed.
+uint32_t constexpr kMultiplier0 = 0xD2511F53;
+uint32_t constexpr kMultiplier1 = 0xCD9E8D57;
+uint32_t constexpr kWeyl0       = 0x9E3779B9;
+uint32_t constexpr kWeyl1       = 0xBB67AE85;
+int constexpr kNumRounds        = 10;
+
+void mulhilo( uint32_t const a, uint32_t const b, uint32_t& hi,
+              uint32_t& lo ) {
+  uint64_t const product = uint64_t{ a } * uint64_t{ b };
+  hi                     = uint32_t( product >> 32 );
+  lo                     = uint32_t( product );
+}
+
+} // namespace
+
+/****************************************************************
+** philox4x32
+*****************************************************************/
+philox4x32::philox4x32( entropy const& seed ) { reseed( seed ); }
+
+void philox4x32::reseed( entropy const& seed ) {
+  *this      = {};
+  key_       = { seed.e1, seed.e2 };
+  stream_lo_ = seed.e3;
+  stream_hi_ = seed.e4;
+}
+
+philox4x32::block_t philox4x32::block( block_t const& counter,
+                                       key_t const& key ) {
+  block_t ctr = counter;
+  key_t k     = key;
+  for( int round = 0; round < kNumRounds; ++round ) {
+    if( round > 0 ) {
+      k[0] += kWeyl0;
+      k[1] += kWeyl1;
+    }
+    uint32_t hi0 = 0, lo0 = 0, hi1 = 0, lo1 = 0;
+    mulhilo( kMultiplier0, ctr[0], hi0, lo0 );
+    mulhilo( kMultiplier1, ctr[2], hi1, lo1 );
+    ctr = { hi1 ^ ctr[1] ^ k[0], lo1, hi0 ^ ctr[3] ^ k[1], lo0 };
+  }
+  return ctr;
+}
+
+philox4x32::result_type philox4x32::operator()() {
+  uint64_t const blk = position_ >> 2;
+  if( !buffer_valid_ || buffered_block_ != blk ) {
+    buffer_ = block( { uint32_t( blk ), uint32_t( blk >> 32 ),
+                       stream_lo_, stream_hi_ },
+                     key_ );
+    buffered_block_ = blk;
+    buffer_valid_   = true;
+  }
+  return buffer_[position_++ & 3];
+}
+
+void philox4x32::discard( uint64_t const n ) { position_ += n; }
+
+uint64_t philox4x32::position() const { return position_; }
+
+bool philox4x32::operator==( philox4x32 const& rhs ) const {
+  return key_ == rhs.key_ && stream_lo_ == rhs.stream_lo_ &&
+         stream_hi_ == rhs.stream_hi_ &&
+         position_ == rhs.position_;
+}
+
+} // namespace rng
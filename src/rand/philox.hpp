@@ -0,0 +1,93 @@
+/****************************************************************
+**philox.hpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Counter-based pseudo-random engine.
+*
+*****************************************************************/
+#pragma once
+
+// C++ standard library
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace rng {
+
+/****************************************************************
+** Fwd. Decls.
+*****************************************************************/
+struct entropy;
+
+/****************************************************************
+** philox4x32
+*****************************************************************/
+// The Philox4x32-10 generator from Salmon et al., "Parallel Ran-
+// dom Numbers: As Easy as 1, 2, 3" (SC11). Each output block is
+// a keyed bijection of a 128 bit counter, so the entire state is
+// a key and a counter (24 bytes, vs. ~2.5KB for mt19937), seed-
+// ing is free, and jumping to any position in a stream is O(1).
+// Combined with entropy::derived this gives cheap independent
+// substreams, e.g. one per (turn, subsystem, entity).
+//
+// A seed is interpreted as follows: e1/e2 form the key and e3/e4
+// select a stream within that key (they occupy the upper half of
+// the counter). The lower half of the counter is the block index
+// within the stream, each block yielding four outputs.
+//
+// Satisfies std::uniform_random_bit_generator.
+//
+// NOTE: the output for a given seed must never change, since
+// that will change the meaning of seeds stored in saves.
+struct philox4x32 {
+  using result_type = uint32_t;
+  using block_t     = std::array<uint32_t, 4>;
+  using key_t       = std::array<uint32_t, 2>;
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  // Equivalent to seeding with a zero entropy.
+  philox4x32() = default;
+
+  explicit philox4x32( entropy const& seed );
+
+  void reseed( entropy const& seed );
+
+  result_type operator()();
+
+  // Advances the stream by n outputs in O(1).
+  void discard( uint64_t n );
+
+  // Number of outputs drawn so far in the current stream.
+  [[nodiscard]] uint64_t position() const;
+
+  // The raw bijection; exposed for testing against the known
+  // answer vectors of the reference implementation.
+  [[nodiscard]] static block_t block( block_t const& counter,
+                                      key_t const& key );
+
+  // Two generators are equal when they will produce the same
+  // outputs from here on.
+  bool operator==( philox4x32 const& rhs ) const;
+
+ private:
+  key_t key_ = {};
+  // Upper half of the counter.
+  uint32_t stream_lo_ = 0;
+  uint32_t stream_hi_ = 0;
+  // Number of outputs drawn so far; the block index is this di-
+  // vided by four.
+  uint64_t position_ = 0;
+  // Cache of the most recently generated block.
+  block_t buffer_          = {};
+  uint64_t buffered_block_ = 0;
+  bool buffer_valid_       = false;
+};
+
+} // namespace rng
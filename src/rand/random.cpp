@@ -20,6 +20,10 @@ namespace {
 
 using namespace std;
 
+// The engine() method relies on this.
+static_assert( size_t( e_rng_engine::mersenne ) == 0 );
+static_assert( size_t( e_rng_engine::philox ) == 1 );
+
 // Lemire's algorithm for fast unbiased uniform ints in [0, s).
 // The rng() must produce uniform uint32_t values.
 // https://arxiv.org/pdf/1805.10941
@@ -66,14 +70,48 @@ template<class Rng>
 /****************************************************************
 ** random
 *****************************************************************/
-random::result_type random::raw() { return engine_(); }
+random::result_type random::raw() {
+  return visit_engine(
+      []( auto& engine ) -> result_type { return engine(); } );
+}
 
 random::random( entropy const& seed ) { reseed( seed ); }
 
+random::random( e_rng_engine const engine,
+                entropy const& seed ) {
+  set_engine( engine );
+  reseed( seed );
+}
+
 void random::reseed( entropy const& seed_unmixed ) {
   // NOTE: this should not be changed otherwise it will change
   // the meaning of a given seed.
-  engine_ = engine_t( seed_unmixed.mixed().consume<uint64_t>() );
+  switch( engine() ) {
+    case e_rng_engine::mersenne:
+      engine_ =
+          engine_t( seed_unmixed.mixed().consume<uint64_t>() );
+      break;
+    case e_rng_engine::philox:
+      // The philox key and stream already take the full 128
+      // bits and don't need mixing.
+      engine_ = philox4x32( seed_unmixed );
+      break;
+  }
+}
+
+void random::set_engine( e_rng_engine const engine ) {
+  switch( engine ) {
+    case e_rng_engine::mersenne:
+      engine_ = engine_t{};
+      break;
+    case e_rng_engine::philox:
+      engine_ = philox4x32{};
+      break;
+  }
+}
+
+e_rng_engine random::engine() const {
+  return static_cast<e_rng_engine>( engine_.index() );
 }
 
 entropy random::new_deterministic_seed() {
@@ -89,7 +127,7 @@ bool random::bernoulli( double const p ) {
   CHECK( isfinite( p ) );
   CHECK_GE( p, 0 );
   CHECK_LE( p, 1.0 );
-  return portable_uniform_real_distribution{}( engine_ ) < p;
+  return unit() < p;
 }
 
 int random::uniform_int( int const lower, int const upper ) {
@@ -100,7 +138,9 @@ int random::uniform_int( int const lower, int const upper ) {
         uint32_t( int64_t( upper ) - int64_t( lower ) );
     static constexpr auto kMax = numeric_limits<uint32_t>::max();
     if( delta == kMax ) return uniform<uint32_t>();
-    return uniform_u32_below( engine_, delta + 1 );
+    return visit_engine( [&]( auto& engine ) {
+      return uniform_u32_below( engine, delta + 1 );
+    } );
   }();
   return int( int64_t( lower ) + int64_t( rand ) );
 }
@@ -108,19 +148,25 @@ int random::uniform_int( int const lower, int const upper ) {
 double random::uniform_double( double const lower,
                                double const upper ) {
   CHECK_LT( lower, upper );
-  return portable_uniform_real_distribution{}( engine_, lower,
-                                               upper );
+  return visit_engine( [&]( auto& engine ) {
+    return portable_uniform_real_distribution{}( engine, lower,
+                                                 upper );
+  } );
 }
 
 double random::unit() {
-  return portable_uniform_real_distribution{}( engine_ );
+  return visit_engine( []( auto& engine ) {
+    return portable_uniform_real_distribution{}( engine );
+  } );
 }
 
 double random::NONPORTABLE__normal( double const mean,
                                     double const stddev ) {
   // NOTE: this is not guaranteed to yield consistent values
   // across implementations.
-  return normal_distribution<double>( mean, stddev )( engine_ );
+  return visit_engine( [&]( auto& engine ) {
+    return normal_distribution<double>( mean, stddev )( engine );
+  } );
 }
 
 double random::NONPORTABLE__piecewise( piecewise3 const& p ) {
@@ -128,8 +174,10 @@ double random::NONPORTABLE__piecewise( piecewise3 const& p ) {
   // across implementations.
   array<double, 3> const i{ p.l.value, p.m.value, p.r.value };
   array<double, 3> const w{ p.l.weight, p.m.weight, p.r.weight };
-  return piecewise_linear_distribution<double>{
-    i.begin(), i.end(), w.begin() }( engine_ );
+  return visit_engine( [&]( auto& engine ) {
+    return piecewise_linear_distribution<double>{
+      i.begin(), i.end(), w.begin() }( engine );
+  } );
 }
 
 } // namespace rng
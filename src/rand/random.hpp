@@ -10,6 +10,12 @@
 *****************************************************************/
 #pragma once
 
+// rds
+#include "random.rds.hpp"
+
+// rand
+#include "philox.hpp"
+
 // base
 #include "base/attributes.hpp"
 #include "base/error.hpp"
@@ -17,6 +23,7 @@
 
 // C++ standard library
 #include <random>
+#include <variant>
 #include <vector>
 
 namespace rng {
@@ -29,6 +36,11 @@ struct entropy;
 /****************************************************************
 ** random
 *****************************************************************/
+// Provides portable distributions over one of the engines in
+// e_rng_engine. A default constructed object uses the mersenne
+// engine, which is what everything used before the counter-based
+// engine was added, so results obtained from a given seed with
+// the default engine must remain the same.
 struct random {
  public:
   // It seems the default engine (linear congruential) does not
@@ -48,8 +60,17 @@ struct random {
 
   random( entropy const& seed );
 
+  random( e_rng_engine engine, entropy const& seed );
+
+  // Reseeds the current engine.
   void reseed( entropy const& new_seed );
 
+  // Switches to the given engine in its unseeded state. This
+  // would normally be followed by a call to reseed.
+  void set_engine( e_rng_engine engine );
+
+  [[nodiscard]] e_rng_engine engine() const;
+
   [[nodiscard]] entropy new_deterministic_seed();
 
   // Just get a raw random value from the engine of the type it
@@ -116,7 +137,13 @@ struct random {
   }
 
  private:
-  engine_t engine_;
+  template<typename Fn>
+  decltype( auto ) visit_engine( Fn&& fn ) {
+    return std::visit( std::forward<Fn>( fn ), engine_ );
+  }
+
+  // Alternatives must be in the same order as in e_rng_engine.
+  std::variant<engine_t, philox4x32> engine_;
 };
 
 } // namespace rng
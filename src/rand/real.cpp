@@ -50,6 +50,61 @@ void check_subnormal_modes() {
 #endif
 }
 
+// Both engines must produce exactly 32 uniformly distributed
+// bits per call; see the static_asserts below.
+template<typename Engine>
+double unit_from( Engine& gen ) {
+  // Separate statements guarantee the order in which the
+  // engine is advanced.
+  uint32_t const hi = gen();
+  uint32_t const lo = gen();
+
+  uint64_t const bits =
+      ( uint64_t{ hi } << 32 ) | uint64_t{ lo };
+
+  // Keep the upper 53 bits and divide exactly by 2^53.
+  return static_cast<double>( bits >> 11 ) * 0x1p-53;
+}
+
+template<typename Engine>
+double ranged_from( Engine& gen, double const min,
+                    double const max ) {
+  // This one is needed to ensure we have the correct rounding
+  // mode set which is necessary for reproducible floating point
+  // math which we need to ensure consistent rng and rounding be-
+  // havior. This can change at runtime theoretically so the
+  // safest thing to do is to check it regularly. The engine will
+  // also check this independently when initializing the rng
+  // system in order to support a fast fail if it is violated.
+  check_portable_rounding_mode();
+
+  CHECK( isfinite( min ) );
+  CHECK( isfinite( max ) );
+  CHECK( min < max );
+
+  double const unit = unit_from( gen );
+
+  double const complement = 1.0 - unit;
+  double const left       = min * complement;
+  double const right      = max * unit;
+
+  double res = left + right;
+
+  // Floating-point rounding can occasionally produce max even
+  // though unit is strictly less than 1.
+  if( !( res < max ) ) res = nextafter( max, min );
+
+  // Guard against unexpected rounding outside the lower end-
+  // point.
+  if( res < min ) res = min;
+
+  CHECK( isfinite( res ) );
+  CHECK( res >= min );
+  CHECK( res < max );
+
+  return res;
+}
+
 } // namespace
 
 /****************************************************************
@@ -162,6 +217,11 @@ static_assert( std::mt19937::max() ==
                "std::mt19937 must produce the full 32-bit "
                "unsigned range." );
 
+// Same for the counter-based engine.
+static_assert( philox4x32::min() == 0 );
+static_assert( philox4x32::max() ==
+               std::numeric_limits<std::uint32_t>::max() );
+
 // There are additional conditions that must be enforced through
 // compiler flags or runtime configuration:
 //
@@ -201,58 +261,26 @@ static_assert( std::mt19937::max() ==
 //     floating-point settings.
 
 /****************************************************************
-** portable_uniform_real_distribution<std::mt19937>
+** portable_uniform_real_distribution
 *****************************************************************/
 double portable_uniform_real_distribution::operator()(
     mt19937& gen ) const {
-  // Separate statements guarantee the order in which the
-  // engine is advanced.
-  uint32_t const hi = gen();
-  uint32_t const lo = gen();
-
-  uint64_t const bits =
-      ( uint64_t{ hi } << 32 ) | uint64_t{ lo };
-
-  // Keep the upper 53 bits and divide exactly by 2^53.
-  return static_cast<double>( bits >> 11 ) * 0x1p-53;
+  return unit_from( gen );
 }
 
 double portable_uniform_real_distribution::operator()(
     mt19937& gen, double const min, double const max ) const {
-  // This one is needed to ensure we have the correct rounding
-  // mode set which is necessary for reproducible floating point
-  // math which we need to ensure consistent rng and rounding be-
-  // havior. This can change at runtime theoretically so the
-  // safest thing to do is to check it regularly. The engine will
-  // also check this independently when initializing the rng
-  // system in order to support a fast fail if it is violated.
-  check_portable_rounding_mode();
-
-  CHECK( isfinite( min ) );
-  CHECK( isfinite( max ) );
-  CHECK( min < max );
-
-  double const unit = ( *this )( gen );
-
-  double const complement = 1.0 - unit;
-  double const left       = min * complement;
-  double const right      = max * unit;
-
-  double res = left + right;
-
-  // Floating-point rounding can occasionally produce max even
-  // though unit is strictly less than 1.
-  if( !( res < max ) ) res = nextafter( max, min );
-
-  // Guard against unexpected rounding outside the lower end-
-  // point.
-  if( res < min ) res = min;
+  return ranged_from( gen, min, max );
+}
 
-  CHECK( isfinite( res ) );
-  CHECK( res >= min );
-  CHECK( res < max );
+double portable_uniform_real_distribution::operator()(
+    philox4x32& gen ) const {
+  return unit_from( gen );
+}
 
-  return res;
+double portable_uniform_real_distribution::operator()(
+    philox4x32& gen, double const min, double const max ) const {
+  return ranged_from( gen, min, max );
 }
 
 /****************************************************************
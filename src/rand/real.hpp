@@ -10,13 +10,16 @@
 *****************************************************************/
 #pragma once
 
+// rand
+#include "philox.hpp"
+
 // C++ standard library
 #include <random>
 
 namespace rng {
 
 /****************************************************************
-** portable_uniform_real_distribution<std::mt19937>
+** portable_uniform_real_distribution
 *****************************************************************/
 // Getting random floating point numbers (especially within a
 // specified range) in a way that is portable across environ-
@@ -33,6 +36,13 @@ struct portable_uniform_real_distribution {
   [[nodiscard]] double operator()( std::mt19937& gen,
                                    double const min,
                                    double const max ) const;
+
+  // Same as above but for the counter-based engine.
+  [[nodiscard]] double operator()( philox4x32& gen ) const;
+
+  [[nodiscard]] double operator()( philox4x32& gen,
+                                   double const min,
+                                   double const max ) const;
 };
 
 /****************************************************************
@@ -39,6 +39,7 @@
 #include "refl/cdr.hpp"
 
 // base
+#include "base/fs.hpp"
 #include "base/io.hpp"
 #include "base/logger.hpp"
 #include "base/string.hpp"
@@ -133,7 +134,7 @@ string save_game_to_rcl(
 // The filename is only used for error reporting.
 valid_or<string> load_game_from_rcl( RootState& out_root,
                                      string_view filename,
-                                     string const& in ) {
+                                     string in ) {
   cdr::converter::options const cdr_opts{
     .allow_unrecognized_fields        = false,
     .default_construct_missing_fields = true,
@@ -141,8 +142,8 @@ valid_or<string> load_game_from_rcl( RootState& out_root,
   base::ScopedTimer timer( "load-game" );
   timer.checkpoint( "rcl parse" );
   rcl::ProcessingOptions proc_opts{ .run_key_parse = true };
-  UNWRAP_RETURN( rcl_doc,
-                 rcl::parse( filename, in, proc_opts ) );
+  UNWRAP_RETURN( rcl_doc, rcl::parse( filename, std::move( in ),
+                                      proc_opts ) );
   timer.checkpoint( "from_canonical" );
   UNWRAP_RETURN( root, run_conversion_from_canonical<RootState>(
                            rcl_doc.top_val(), cdr_opts ) );
@@ -192,11 +193,25 @@ valid_or<string> RclGameStorageSave::store(
   string const rcl_output = base::timer(
       "saving game to rcl",
       [&] { return save_game_to_rcl( ss_.root, opts_ ); } );
-  ofstream out( p );
-  if( !out.good() )
-    return fmt::format( "failed to open {} for writing.", p );
-  out << "# " << construct_rcl_title( ss_ ) << "\n";
-  out << rcl_output;
+  // Write to a temporary file and then move it into place so
+  // that a failure part way through (or a reader of the slot,
+  // since autosaves are written in the background) never sees a
+  // truncated save file.
+  fs::path tmp = p;
+  tmp += ".tmp";
+  {
+    ofstream out( tmp );
+    if( !out.good() )
+      return fmt::format( "failed to open {} for writing.",
+                          tmp );
+    out << "# " << construct_rcl_title( ss_ ) << "\n";
+    out << rcl_output;
+    out.close();
+    if( !out.good() )
+      return fmt::format( "failed to write {}.", tmp );
+  }
+  GOOD_OR_RETURN(
+      base::rename_file_overwriting_destination( tmp, p ) );
   return valid;
 }
 
@@ -211,7 +226,8 @@ valid_or<string> RclGameStorageLoad::load(
   {
     base::ScopedTimer timer( "loading game from rcl" );
     GOOD_OR_RETURN(
-        load_game_from_rcl( ss_.root, p.string(), *maybe_rcl ) );
+        load_game_from_rcl( ss_.root, p.string(),
+                            std::move( *maybe_rcl ) ) );
   }
   return valid;
 }
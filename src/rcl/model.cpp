@@ -195,6 +195,14 @@ struct key_parser_visitor {
 };
 
 void key_parser_impl( table& in, string&& raw_key, value&& v ) {
+  // Most keys are plain identifiers, in which case there is
+  // nothing to parse.
+  if( raw_key.find_first_of( "\" ." ) == string::npos ) {
+    in.emplace(
+        std::move( raw_key ),
+        fast_visit( key_parser_visitor{}, std::move( v ) ) );
+    return;
+  }
   string res;
   if( raw_key.size() > res.capacity() )
     res.reserve( raw_key.size() * 2 );
@@ -277,8 +285,10 @@ void key_parser_impl( table& in, string&& raw_key, value&& v ) {
 
 table key_parser_table( table&& in ) {
   table t;
+  t.reserve( in.size() );
+  // The keys can be moved from since `in` is going away.
   for( auto& [k, v] : in )
-    key_parser_impl( t, string( k ), std::move( v ) );
+    key_parser_impl( t, std::move( k ), std::move( v ) );
   return t;
 }
 
@@ -343,8 +353,9 @@ void unflatten_impl( table& in, string&& dotted, value&& v ) {
 
 table unflatten_table( table&& in ) {
   table t;
+  t.reserve( in.size() );
   for( auto& [k, v] : in )
-    unflatten_impl( t, string( k ), std::move( v ) );
+    unflatten_impl( t, std::move( k ), std::move( v ) );
   return t;
 }
 
@@ -17,6 +17,8 @@
 
 // C++ standard library
 #include <cassert>
+#include <cstdint>
+#include <cstring>
 
 using namespace std;
 
@@ -28,14 +30,7 @@ namespace rcl {
 
 namespace {
 
-#define FAIL_RESTORE ( ( g_cur = sav ), false )
-
-/****************************************************************
-** Global State
-*****************************************************************/
-thread_local char const* g_start = nullptr;
-thread_local char const* g_cur   = nullptr;
-thread_local char const* g_end   = nullptr;
+#define FAIL_RESTORE ( ( cur_ = sav ), false )
 
 /****************************************************************
 ** Helpers
@@ -74,22 +69,96 @@ bool is_alpha( char c ) {
   return ( c >= 'a' && c <= 'z' ) || ( c >= 'A' && c <= 'Z' );
 }
 
+/****************************************************************
+** Word-at-a-time Scanning
+*****************************************************************/
+// Large documents (e.g. saved games) consist mostly of indenta-
+// tion and of runs of characters that the parser is not inter-
+// ested in, so these allow skipping over them eight bytes at a
+// time using plain 64 bit arithmetic.
+constexpr uint64_t kLowBits  = 0x0101010101010101ULL;
+constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+constexpr uint64_t kSpaces   = kLowBits * uint8_t( ' ' );
+
+uint64_t load_word( char const* p ) {
+  uint64_t w;
+  memcpy( &w, p, sizeof( w ) );
+  return w;
+}
+
+// Nonzero if and only if one of the bytes in the word is c.
+uint64_t has_byte( uint64_t w, char c ) {
+  uint64_t const x = w ^ ( kLowBits * uint8_t( c ) );
+  return ( x - kLowBits ) & ~x & kHighBits;
+}
+
+// Returns a pointer to the first char in [p, end) that is one of
+// Cs, or end if there isn't one.
+template<char... Cs>
+char const* find_first_of( char const* p, char const* end ) {
+  while( end - p >= 8 ) {
+    uint64_t const w = load_word( p );
+    if( ( has_byte( w, Cs ) | ... ) ) break;
+    p += 8;
+  }
+  while( p != end && ( ( *p != Cs ) && ... ) ) ++p;
+  return p;
+}
+
+/****************************************************************
+** Parser
+*****************************************************************/
+// Keys and strings are parsed as views into the input text and
+// are only copied once they are put into the cdr model.
+struct Parser {
+  explicit Parser( string_view in )
+    : start_( in.data() ),
+      cur_( start_ ),
+      end_( start_ + in.size() ) {}
+
+  bool parse_document( table* out, string& err );
+
+  int offset() const { return int( cur_ - start_ ); }
+
+ private:
+  void trim_and_back_up( string_view* out );
+  void eat_blanks();
+  bool parse_key( string_view* out, string& err );
+  bool parse_assignment();
+  bool parse_value( value* out, string& err );
+  bool parse_key_val( table* out, string& err );
+  bool parse_table( table* out, string& err );
+  bool parse_list( list* out, string& err );
+  bool parse_number( value* out );
+  bool parse_unquoted_string( string_view* out );
+  bool parse_string( string_view* out, bool* unquoted );
+
+  char const* start_ = nullptr;
+  char const* cur_   = nullptr;
+  char const* end_   = nullptr;
+};
+
 // This will remove trailing spaces from the end and will also
-// move the global cursor back as well.
-void trim_and_back_up( string_view* out ) {
+// move the cursor back as well.
+void Parser::trim_and_back_up( string_view* out ) {
   // Remove trailing spaces.
   while( !out->empty() &&
          is_blank( ( *out )[out->size() - 1] ) ) {
     out->remove_suffix( 1 );
-    --g_cur;
+    --cur_;
   }
 }
 
-/****************************************************************
-** Parsers
-*****************************************************************/
-void eat_blanks() {
-  while( g_cur != g_end && is_blank( *g_cur ) ) ++g_cur;
+void Parser::eat_blanks() {
+  while( cur_ != end_ ) {
+    // Indentation.
+    if( end_ - cur_ >= 8 && load_word( cur_ ) == kSpaces ) {
+      cur_ += 8;
+      continue;
+    }
+    if( !is_blank( *cur_ ) ) break;
+    ++cur_;
+  }
 }
 
 // A table key can be a space and/or dot-separated list of compo-
@@ -102,10 +171,10 @@ void eat_blanks() {
 // This function will parse a key and make sure that it is valid,
 // but will not transform it in any way (that is done by the
 // model post-processor).
-bool parse_key( string_view* out, string& /*err*/ ) {
+bool Parser::parse_key( string_view* out, string& /*err*/ ) {
   eat_blanks();
-  if( g_cur == g_end ) return false;
-  char const* start = g_cur;
+  if( cur_ == end_ ) return false;
+  char const* start = cur_;
   if( !is_leading_identifier_char( *start ) && *start != '"' )
     return false;
 
@@ -114,39 +183,39 @@ bool parse_key( string_view* out, string& /*err*/ ) {
   // This allows a series of identifiers separated by dots and/or
   // spaces (which are equivalent), potentially with quotes to
   // allow spaces and weird characters inside a key.
-  while( g_cur != g_end ) {
+  while( cur_ != end_ ) {
     if( in_quote ) {
       // We are in a quote.
       CHECK( !got_dot );
-      if( *g_cur == '\\' ) {
+      if( *cur_ == '\\' ) {
         // We're escaping something, so we must have a next char-
         // acter in the stream, since a single backslash inside a
         // quote is not valid.
-        ++g_cur;
-        if( g_cur == g_end ) return false;
+        ++cur_;
+        if( cur_ == end_ ) return false;
         // Accept whatever the next character is.
-        ++g_cur;
+        ++cur_;
         continue;
       }
       // We're not escaping anything.
-      if( *g_cur == '"' ) {
+      if( *cur_ == '"' ) {
         // This quote is being closed.
         in_quote = false;
-      } else if( is_newline( *g_cur ) ) {
+      } else if( is_newline( *cur_ ) ) {
         // Unclosed quote... fail.
         return false;
       }
       // Any other char: accept it.
-      ++g_cur;
+      ++cur_;
       continue;
     }
 
     // We're not in a quote, so now check if we're opening one.
-    if( *g_cur == '"' ) {
+    if( *cur_ == '"' ) {
       // We are opening a quote.
       CHECK( !in_quote );
       in_quote = true;
-      ++g_cur;
+      ++cur_;
       got_dot = false;
       continue;
     }
@@ -155,55 +224,52 @@ bool parse_key( string_view* out, string& /*err*/ ) {
     // some restrictions on allowed chars; actually, if we get an
     // unallowed char, we assume that is the end of the key (not
     // an error).
-    if( !is_identifier_char( *g_cur ) && *g_cur != '.' &&
-        *g_cur != ' ' )
+    if( !is_identifier_char( *cur_ ) && *cur_ != '.' &&
+        *cur_ != ' ' )
       break;
 
     // Ensure we don't get two dots in a row, even if they have
     // spaces between them.
-    if( *g_cur == '.' ) {
+    if( *cur_ == '.' ) {
       if( got_dot ) return false;
       got_dot = true;
-    } else if( !is_blank( *g_cur ) ) {
+    } else if( !is_blank( *cur_ ) ) {
       got_dot = false;
     }
-    ++g_cur;
+    ++cur_;
   }
-  *out = string_view( start, g_cur - start );
+  *out = string_view( start, cur_ - start );
   trim_and_back_up( out );
   return true;
 }
 
-bool parse_assignment() {
-  if( g_cur != g_end && *g_cur == '{' ) return true;
+bool Parser::parse_assignment() {
+  if( cur_ != end_ && *cur_ == '{' ) return true;
   bool has_space = false;
-  while( g_cur != g_end && is_nonnewline_blank( *g_cur ) ) {
-    ++g_cur;
+  while( cur_ != end_ && is_nonnewline_blank( *cur_ ) ) {
+    ++cur_;
     has_space = true;
   }
-  if( g_cur == g_end ) return false;
-  if( *g_cur == '=' || *g_cur == ':' ) {
-    ++g_cur;
+  if( cur_ == end_ ) return false;
+  if( *cur_ == '=' || *cur_ == ':' ) {
+    ++cur_;
     return true;
   }
   return has_space;
 }
 
-bool parse_value( value* out, string& err );
-bool parse_key_val( table* out, string& err );
-
-bool parse_table( table* out, string& err ) {
-  DCHECK( g_cur != g_end );
-  DCHECK( *g_cur == '{' );
-  ++g_cur;
+bool Parser::parse_table( table* out, string& err ) {
+  DCHECK( cur_ != end_ );
+  DCHECK( *cur_ == '{' );
+  ++cur_;
 
   table tbl;
   while( true ) {
     eat_blanks();
-    char const* sav = g_cur;
+    char const* sav = cur_;
     bool success    = parse_key_val( &tbl, err );
     if( !success ) {
-      if( g_cur != sav )
+      if( cur_ != sav )
         // We failed but parsed some non-blank characters,
         // meaning that there was a syntax error.
         return false;
@@ -212,17 +278,17 @@ bool parse_table( table* out, string& err ) {
   }
 
   eat_blanks();
-  if( g_cur == g_end || *g_cur != '}' ) return false;
-  ++g_cur;
+  if( cur_ == end_ || *cur_ != '}' ) return false;
+  ++cur_;
 
   *out = std::move( tbl );
   return true;
 }
 
-bool parse_list( list* out, string& err ) {
-  DCHECK( g_cur != g_end );
-  DCHECK( *g_cur == '[' );
-  ++g_cur;
+bool Parser::parse_list( list* out, string& err ) {
+  DCHECK( cur_ != end_ );
+  DCHECK( *cur_ == '[' );
+  ++cur_;
 
   vector<value> vs;
   while( true ) {
@@ -230,116 +296,112 @@ bool parse_list( list* out, string& err ) {
     if( !parse_value( &v, err ) ) break;
     eat_blanks();
     // optional comma.
-    if( g_cur != g_end && *g_cur == ',' ) ++g_cur;
+    if( cur_ != end_ && *cur_ == ',' ) ++cur_;
     vs.push_back( std::move( v ) );
   }
 
   eat_blanks();
-  if( g_cur == g_end || *g_cur != ']' ) return false;
-  ++g_cur;
+  if( cur_ == end_ || *cur_ != ']' ) return false;
+  ++cur_;
 
   *out = list( std::move( vs ) );
   return true;
 }
 
-bool parse_number( value* out ) {
-  char const* sav = g_cur;
-  DCHECK( g_cur != g_end );
-  char const* start = g_cur;
-  while( g_cur != g_end && ( is_digit( *g_cur ) ||
-                             *g_cur == '-' || *g_cur == '.' ) )
-    ++g_cur;
-  if( g_cur == start ) return FAIL_RESTORE;
-  if( g_cur != g_end ) {
+bool Parser::parse_number( value* out ) {
+  char const* sav = cur_;
+  DCHECK( cur_ != end_ );
+  char const* start = cur_;
+  while( cur_ != end_ &&
+         ( is_digit( *cur_ ) || *cur_ == '-' || *cur_ == '.' ) )
+    ++cur_;
+  if( cur_ == start ) return FAIL_RESTORE;
+  if( cur_ != end_ ) {
     // make sure we have a word boundary. This basically means
     // that we have something that a) is not a digit (which we
     // already know it isn't), and b) is not the start of an
     // identifier.
-    if( is_leading_identifier_char( *g_cur ) )
-      return FAIL_RESTORE;
+    if( is_leading_identifier_char( *cur_ ) ) return FAIL_RESTORE;
   }
-  string_view sv( start, g_cur - start );
+  string_view sv( start, cur_ - start );
 
   if( sv.find_first_of( '.' ) != string_view::npos ) {
     // double.
-    base::maybe<double> d = base::stod( string( sv ) );
+    base::maybe<double> d = base::from_chars<double>( sv );
     if( !d ) return FAIL_RESTORE;
     *out = *d;
     return true;
   } else {
     // int.
-    auto const i = base::stoll( string( sv ) );
+    auto const i = base::from_chars<cdr::integer_type>( sv );
     if( !i ) { return FAIL_RESTORE; }
     *out = *i;
     return true;
   }
 }
 
-bool parse_unquoted_string( string_view* out ) {
-  char const* start = g_cur;
-  while( g_cur != g_end ) {
-    if( is_forbidden_unquoted_str_char( *g_cur ) ) break;
-    ++g_cur;
+bool Parser::parse_unquoted_string( string_view* out ) {
+  char const* start = cur_;
+  while( cur_ != end_ ) {
+    if( is_forbidden_unquoted_str_char( *cur_ ) ) break;
+    ++cur_;
   }
-  if( start == g_cur ) return false;
+  if( start == cur_ ) return false;
   // Eat trailing spaces. This is so that an unquoted string
   // won't e.g. include the space between the end of a word and a
   // closing brace of a table that is on the same line. +1 be-
   // cause We know that the first character is not a blank.
-  while( g_cur > start + 1 ) {
-    if( is_blank( *( g_cur - 1 ) ) )
-      --g_cur;
+  while( cur_ > start + 1 ) {
+    if( is_blank( *( cur_ - 1 ) ) )
+      --cur_;
     else
       break;
   }
-  *out = string_view( start, g_cur - start );
+  *out = string_view( start, cur_ - start );
   return true;
 }
 
-bool parse_string( string* out, bool* unquoted ) {
+bool Parser::parse_string( string_view* out, bool* unquoted ) {
   *unquoted = false;
-  if( g_cur == g_end ) return false;
+  if( cur_ == end_ ) return false;
 
   // double-quoted string.
-  if( *g_cur == '"' ) {
-    ++g_cur;
-    char const* start = g_cur;
-    while( g_cur != g_end && *g_cur != '"' ) ++g_cur;
-    if( g_cur == g_end ) return false;
-    *out = string( start, g_cur );
-    DCHECK( *g_cur == '"' );
-    ++g_cur;
+  if( *cur_ == '"' ) {
+    ++cur_;
+    char const* start = cur_;
+    cur_              = find_first_of<'"'>( cur_, end_ );
+    if( cur_ == end_ ) return false;
+    *out = string_view( start, cur_ - start );
+    DCHECK( *cur_ == '"' );
+    ++cur_;
     return true;
   }
 
   // single-quoted string.
-  if( *g_cur == '\'' ) {
-    ++g_cur;
-    char const* start = g_cur;
-    while( g_cur != g_end && *g_cur != '\'' ) ++g_cur;
-    if( g_cur == g_end ) return false;
-    *out = string( start, g_cur );
-    DCHECK( *g_cur == '\'' );
-    ++g_cur;
+  if( *cur_ == '\'' ) {
+    ++cur_;
+    char const* start = cur_;
+    cur_              = find_first_of<'\''>( cur_, end_ );
+    if( cur_ == end_ ) return false;
+    *out = string_view( start, cur_ - start );
+    DCHECK( *cur_ == '\'' );
+    ++cur_;
     return true;
   }
 
   // unquoted string. End at end of line.
-  if( is_forbidden_leading_unquoted_str_char( *g_cur ) )
+  if( is_forbidden_leading_unquoted_str_char( *cur_ ) )
     return false;
   *unquoted = true;
-  string_view s;
-  if( !parse_unquoted_string( &s ) ) return false;
-  *out = string( s );
-  return true;
+  return parse_unquoted_string( out );
 }
 
-bool parse_value( value* out, string& err ) {
+bool Parser::parse_value( value* out, string& err ) {
   eat_blanks();
-  if( g_cur == g_end ) return false;
+  if( cur_ == end_ ) return false;
 
   // table
-  if( *g_cur == '{' ) {
+  if( *cur_ == '{' ) {
     table tbl;
     if( !parse_table( &tbl, err ) ) return false;
     *out = value( std::move( tbl ) );
@@ -347,17 +409,17 @@ bool parse_value( value* out, string& err ) {
   }
 
   // implicit table.
-  if( g_cur + 1 < g_end && *g_cur == '.' &&
-      is_alpha( *( g_cur + 1 ) ) ) {
+  if( cur_ + 1 < end_ && *cur_ == '.' &&
+      is_alpha( *( cur_ + 1 ) ) ) {
     table tbl;
-    ++g_cur;
+    ++cur_;
     if( !parse_key_val( &tbl, err ) ) return false;
     *out = value( std::move( tbl ) );
     return true;
   }
 
   // list
-  if( *g_cur == '[' ) {
+  if( *cur_ == '[' ) {
     list lst;
     if( !parse_list( &lst, err ) ) return false;
     *out = value( std::move( lst ) );
@@ -365,7 +427,7 @@ bool parse_value( value* out, string& err ) {
   }
 
   // number
-  if( *g_cur == '-' || *g_cur == '.' || is_digit( *g_cur ) ) {
+  if( *cur_ == '-' || *cur_ == '.' || is_digit( *cur_ ) ) {
     value v;
     if( !parse_number( &v ) ) return false;
     *out = std::move( v );
@@ -373,7 +435,7 @@ bool parse_value( value* out, string& err ) {
   }
 
   // Assume string.
-  string s;
+  string_view s;
   bool unquoted;
   if( !parse_string( &s, &unquoted ) ) return false;
 
@@ -397,15 +459,15 @@ bool parse_value( value* out, string& err ) {
     }
   }
 
-  *out = value{ std::move( s ) };
+  *out = value{ string( s ) };
   return true;
 }
 
-bool parse_key_val( table* out, string& err ) {
+bool Parser::parse_key_val( table* out, string& err ) {
   eat_blanks();
   string_view key;
   if( !parse_key( &key, err ) ) return false;
-  if( out->contains( string( key ) ) ) {
+  if( out->contains( key ) ) {
     err = fmt::format( "duplicate key \"{}\" in table", key );
     return false;
   }
@@ -414,60 +476,60 @@ bool parse_key_val( table* out, string& err ) {
   if( !parse_value( &v, err ) ) return false;
   eat_blanks();
   // optional comma.
-  if( g_cur != g_end && *g_cur == ',' ) ++g_cur;
+  if( cur_ != end_ && *cur_ == ',' ) ++cur_;
   out->emplace( string( key ), std::move( v ) );
   return true;
 }
 
+bool Parser::parse_document( table* out, string& err ) {
+  // At the top level, the document must be a table. However,
+  // top-level braces are optional (unlike with JSON). So first
+  // check if we are parsing a JSON-like document and, if not,
+  // fall back to just parsing the key/value pairs directly.
+  eat_blanks();
+  if( cur_ != end_ && *cur_ == '{' )
+    parse_table( out, err );
+  else
+    while( parse_key_val( out, err ) ) {}
+  eat_blanks();
+  return cur_ == end_;
+}
+
 /****************************************************************
 ** Comments Blankifier
 *****************************************************************/
 // This will keep the string the same length but will ovewrite
 // all comments (comment delimiters and comment contents) with
-// spaces).
+// spaces). Quotes and comments never extend past the end of a
+// line.
 void blankify_comments( string& text ) {
-  bool in_comment     = false;
-  bool in_dquoted_str = false;
-  bool in_squoted_str = false;
-  int i               = 0;
-  for( ; i < int( text.size() ); ++i ) {
-    char c = text[i];
-    if( c == '\n' || c == '\r' ) {
-      in_comment     = false;
-      in_dquoted_str = false;
-      in_squoted_str = false;
-      continue;
-    }
-    if( in_dquoted_str ) {
-      if( c != '"' ) continue;
-      in_dquoted_str = false;
-      continue;
-    }
-    if( in_squoted_str ) {
-      if( c != '\'' ) continue;
-      in_squoted_str = false;
-      continue;
-    }
-    if( in_comment ) {
-      text[i] = ' ';
-      continue;
-    }
+  char* const data = text.data();
+  char const* cur  = data;
+  char const* end  = data + text.size();
+  while( true ) {
     // We're not in a comment or string.
-    if( c == '#' ) {
-      // start comment.
-      in_comment = true;
-      text[i]    = ' ';
-      continue;
-    }
-    if( c == '"' ) {
-      // start double quoted string[
-      in_dquoted_str = true;
-      continue;
-    }
-    if( c == '\'' ) {
-      // start single quoted string[
-      in_squoted_str = true;
-      continue;
+    cur = find_first_of<'#', '"', '\'', '\n', '\r'>( cur, end );
+    if( cur == end ) break;
+    switch( *cur++ ) {
+      case '#': {
+        // Blank out the rest of the line, including the '#'.
+        char* const start = data + ( cur - 1 - data );
+        char const* const eol =
+            find_first_of<'\n', '\r'>( cur, end );
+        memset( start, ' ', eol - start );
+        cur = eol;
+        break;
+      }
+      case '"':
+        cur = find_first_of<'"', '\n', '\r'>( cur, end );
+        if( cur != end && *cur == '"' ) ++cur;
+        break;
+      case '\'':
+        cur = find_first_of<'\'', '\n', '\r'>( cur, end );
+        if( cur != end && *cur == '\'' ) ++cur;
+        break;
+      default:
+        break;
     }
   }
 }
@@ -477,15 +539,13 @@ void blankify_comments( string& text ) {
 /****************************************************************
 ** Public API
 *****************************************************************/
-base::expect<doc, string> parse(
-    string_view filename, string const& in_with_comments,
-    ProcessingOptions const& opts ) {
-  string in_blankified = in_with_comments;
-  blankify_comments( in_blankified );
-  string_view in = in_blankified;
-  g_start        = in.begin();
-  g_cur          = g_start;
-  g_end          = in.end();
+base::expect<doc, string> parse( string_view filename,
+                                 string in,
+                                 ProcessingOptions const& opts ) {
+  // This is done in place; it does not change any positions in
+  // the text, so error locations are not affected.
+  blankify_comments( in );
+  Parser parser( in );
 
   table tbl;
   // NOTE: Although this will be threaded through the various
@@ -497,26 +557,13 @@ base::expect<doc, string> parse(
   // we don't want to display the default error message that says
   // "unexpected character" since that is not helpful.
   string err;
-  // At the top level, the document must be a table. However,
-  // top-level braces are optional (unlike with JSON). So first
-  // check if we are parsing a JSON-like document and, if not,
-  // fall back to just parsing the key/value pairs directly.
-  eat_blanks();
-  if( g_cur != g_end && *g_cur == '{' )
-    parse_table( &tbl, err );
-  else
-    while( parse_key_val( &tbl, err ) ) {}
-  eat_blanks();
-
-  auto [line, col] = error_pos( in, g_cur - g_start );
   // Only check the err string if we didn't fully parse the docu-
   // ment, in order to allow for cases where a parser function
   // might encounter and error and populate it but which its
   // caller can handle.
-  if( g_cur != g_end ) {
-    string const loc = ( g_cur != g_end )
-                           ? fmt::format( "{}:{}:", line, col )
-                           : "";
+  if( !parser.parse_document( &tbl, err ) ) {
+    auto [line, col] = error_pos( in, parser.offset() );
+    string const loc = fmt::format( "{}:{}:", line, col );
     string const msg =
         !err.empty() ? err : "unexpected character";
     return fmt::format( "{}:error:{} {}", filename, loc, msg );
@@ -531,7 +578,7 @@ base::expect<doc> parse_file( string_view filename,
   if( !buffer )
     return base::error_read_text_file_msg( filename,
                                            buffer.error() );
-  return parse( filename, *buffer, opts );
+  return parse( filename, std::move( *buffer ), opts );
 }
 
 } // namespace rcl
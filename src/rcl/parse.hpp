@@ -22,9 +22,10 @@
 
 namespace rcl {
 
-// Rcl parser.
+// Rcl parser. The input is taken by value since it is modified
+// in place while parsing; move it in to avoid a copy.
 base::expect<doc> parse( std::string_view filename,
-                         std::string const& in,
+                         std::string in,
                          ProcessingOptions const& opts = {} );
 
 // For convenience.
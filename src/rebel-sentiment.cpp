@@ -52,15 +52,7 @@ int constexpr kMinColonistsForSentimentMsgs = 4;
 *****************************************************************/
 int unit_count_for_rebel_sentiment( SSConst const& ss,
                                     e_player const player ) {
-  auto const& units = ss.units.euro_all();
-  int n             = 0;
-  for( auto const& [_, p_state] : units ) {
-    Unit const& unit = p_state->unit;
-    if( unit.player_type() != player ) continue;
-    if( !is_unit_a_colonist( unit.type() ) ) continue;
-    ++n;
-  }
-  return n;
+  return ss.units.unit_stats_for_player( player ).colonists;
 }
 
 int updated_rebel_sentiment( SSConst const& ss,
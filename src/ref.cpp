@@ -622,12 +622,9 @@ e_ref_manowar_availability ensure_manowar_availability(
     // When one is available in stock it can/will always be used,
     // even if there are ships already on the map.
     return e_ref_manowar_availability::available_in_stock;
-  for( auto const& [unit_id, p_state] : ss.units.euro_all() ) {
-    Unit const& unit = p_state->unit;
-    if( unit.player_type() != ref_player_type ) continue;
-    if( unit.type() == e_unit_type::man_o_war )
-      return e_ref_manowar_availability::available_on_map;
-  }
+  if( ss.units.unit_stats_for_player( ref_player_type )
+          .by_type[e_unit_type::man_o_war] > 0 )
+    return e_ref_manowar_availability::available_on_map;
   if( ss.settings.game_setup_options.customized_rules
           .ref_can_spawn_ships )
     return e_ref_manowar_availability::none_but_can_add;
@@ -91,6 +91,7 @@ value to_canonical( converter& conv, S const& o, tag_t<S> ) {
   static constexpr size_t kNumFields =
       std::tuple_size_v<decltype( Tr::fields )>;
   table tbl;
+  tbl.reserve( kNumFields );
   FOR_CONSTEXPR_IDX( Idx, kNumFields ) {
     auto& field_desc = std::get<Idx>( Tr::fields );
     auto& field_val  = o.*field_desc.accessor;
@@ -42,14 +42,31 @@ struct Validator : public trv::RecursiveTraverserWithTracking {
 /****************************************************************
 ** Recursive Validator
 *****************************************************************/
+// Like validate_recursive below but does not produce an error
+// message, which allows it to skip tracking the path of each
+// node that it visits and so is much faster.
+bool is_valid_recursive( trv::Traversable auto const& o ) {
+  bool ok = true;
+  trv::traverse_recursive( o, [&]<typename T>( T const& e ) {
+    if constexpr( ValidatableStruct<T> )
+      if( ok ) ok = e.validate().valid();
+  } );
+  return ok;
+}
+
 // The value passed in here actually does not need to be validat-
 // able, since in general not all children will be (i.e., not
 // every type will have a .validate() method). However, it must
 // be traversable.
+//
+// Since validation almost always passes, this first does a pass
+// that does not track paths and then only if that fails will it
+// go back and find the path of the first failure.
 base::valid_or<std::string> validate_recursive(
     trv::Traversable auto const& o,
     std::string_view const top ) {
   using namespace detail;
+  if( is_valid_recursive( o ) ) return base::valid;
   Validator v;
   try {
     v( o, top );
@@ -60,6 +77,7 @@ base::valid_or<std::string> validate_recursive(
 base::valid_or<std::string> validate_recursive(
     trv::Traversable auto const& o ) {
   using namespace detail;
+  if( is_valid_recursive( o ) ) return base::valid;
   Validator v;
   try {
     v( o, trv::none );
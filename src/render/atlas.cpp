@@ -20,6 +20,9 @@
 // base
 #include "base/error.hpp"
 
+// C++ standard library
+#include <algorithm>
+
 using namespace std;
 
 namespace rr {
@@ -29,6 +32,48 @@ using ::gfx::image;
 using ::gfx::rect;
 using ::gfx::size;
 
+namespace {
+
+// Candidate bin sizes for the atlas in the order that they should
+// be tried, which is by increasing area, then preferring square
+// ones. Each dimension is either a power of two or the maximum
+// allowed in that dimension. Sizes that can't possibly hold the
+// rects are omitted.
+vector<size> candidate_atlas_sizes( vector<rect> const& rects,
+                                    size const max_size ) {
+  int64_t total_area = 0;
+  size largest;
+  for( rect const& r : rects ) {
+    total_area += r.size.area();
+    largest = largest.max_with( r.size );
+  }
+  auto dimensions = []( int const max ) {
+    vector<int> res;
+    for( int d = 1; d < max; d *= 2 ) res.push_back( d );
+    res.push_back( max );
+    return res;
+  };
+  vector<size> res;
+  for( int const w : dimensions( max_size.w ) ) {
+    if( w < largest.w ) continue;
+    for( int const h : dimensions( max_size.h ) ) {
+      if( h < largest.h ) continue;
+      if( int64_t( w ) * h < total_area ) continue;
+      res.push_back( size{ .w = w, .h = h } );
+    }
+  }
+  std::stable_sort(
+      res.begin(), res.end(), []( size const l, size const r ) {
+        int64_t const l_area = int64_t( l.w ) * l.h;
+        int64_t const r_area = int64_t( r.w ) * r.h;
+        if( l_area != r_area ) return l_area < r_area;
+        return std::abs( l.w - l.h ) < std::abs( r.w - r.h );
+      } );
+  return res;
+}
+
+} // namespace
+
 /****************************************************************
 ** AtlasMap
 *****************************************************************/
@@ -79,11 +124,29 @@ AtlasBuilder::ImageBuilder AtlasBuilder::add_image(
 
 maybe<Atlas> AtlasBuilder::build( size const max_size ) const {
   CHECK( rects_.size() == trimmed_rects_.size() );
-  // First pack the rects.
+  // First pack the rects into the smallest bin that will hold
+  // them.
   vector<rect> packed_rects = rects_;
-  UNWRAP_RETURN( packed_size,
-                 pack_rects( packed_rects, max_size ) );
+  maybe<RectPackStats> stats;
+  for( size const bin :
+       candidate_atlas_sizes( packed_rects, max_size ) ) {
+    stats = pack_rects_best( packed_rects, bin );
+    if( stats.has_value() ) break;
+  }
+  if( !stats.has_value() ) {
+    // As a last resort fall back to the shelf packer. In practice
+    // this should not succeed where the above has failed, but it
+    // doesn't hurt to try.
+    UNWRAP_RETURN( shelf_size,
+                   pack_rects( packed_rects, max_size ) );
+    stats = RectPackStats{ .size_used = shelf_size };
+    for( rect const& r : packed_rects )
+      stats->area_occupied += r.size.area();
+  }
   CHECK( rects_.size() == packed_rects.size() );
+  // The image only needs to cover the area that was used, which
+  // can be smaller than the bin that the rects were packed into.
+  size const packed_size = stats->size_used;
 
   // Now copy them to a large image.
   image atlas_img = gfx::new_empty_image( packed_size );
@@ -105,8 +168,9 @@ maybe<Atlas> AtlasBuilder::build( size const max_size ) const {
 
   return Atlas{
     .img  = std::move( atlas_img ),
-    .dict = AtlasMap( std::move( packed_rects ),
-                      std::move( trimmed_rects_ ) ) };
+    .dict  = AtlasMap( std::move( packed_rects ),
+                       std::move( trimmed_rects_ ) ),
+    .stats = *stats };
 }
 
 } // namespace rr
@@ -10,6 +10,9 @@
 *****************************************************************/
 #pragma once
 
+// render
+#include "rect-pack.hpp"
+
 // gfx
 #include "gfx/cartesian.hpp"
 #include "gfx/image.hpp"
@@ -61,6 +64,8 @@ struct Atlas {
   // mechanism.
   gfx::image img;
   AtlasMap dict;
+  // How densely the sprites were packed.
+  RectPackStats stats;
 };
 
 /****************************************************************
@@ -87,10 +92,15 @@ struct AtlasBuilder {
   // Call this once for each new image containing sprites.
   ImageBuilder add_image( gfx::image img ) &;
 
-  // This is expensive... only do this once at the end! It can
-  // fail if the rects can't be packed into the max_size dimen-
-  // sions using the packing algorithm that we're using (which is
-  // not optimal...).
+  // This is expensive... only do this once at the end! It will
+  // pack the rects into the smallest bin (by area, then prefer-
+  // ring square ones) whose dimensions are powers of two or the
+  // max_size dimensions. The resulting image is then trimmed to
+  // the area actually used by the packed rects, which can be
+  // smaller than the bin. It can fail if the rects can't be
+  // packed into the max_size dimensions using the packing algo-
+  // rithm that we're using (which is still not optimal, but
+  // pretty good).
   base::maybe<Atlas> build( gfx::size max_size ) const;
 
  private:
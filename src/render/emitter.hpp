@@ -57,6 +57,10 @@ struct Emitter {
         vert.size() ) );
   }
 
+  // Same as above but for vertices that have already been ex-
+  // tracted from a buffer, e.g. to replay them.
+  void emit( std::span<GenericVertex const> vertices );
+
   void log_capacity_changes( bool enable ) {
     log_capacity_changes_ = enable;
   }
@@ -64,8 +68,6 @@ struct Emitter {
  private:
   void emit( GenericVertex const& vert );
 
-  void emit( std::span<GenericVertex const> vertices );
-
   std::vector<GenericVertex>* buffer_;
   long pos_;
   bool log_capacity_changes_;
@@ -15,13 +15,13 @@ layout (location = 1)  in uint  in_flags;
 layout (location = 2)  in uint  in_aux_bits_1;
 layout (location = 3)  in vec4  in_depixelate;
 layout (location = 4)  in vec4  in_depixelate_stages;
-layout (location = 5)  in vec2  in_position;
-layout (location = 6)  in vec2  in_atlas_position;
+layout (location = 5)  in uint  in_position;
+layout (location = 6)  in uint  in_atlas_position;
 layout (location = 7)  in vec4  in_atlas_rect;
-layout (location = 8)  in vec2  in_reference_position_1;
-layout (location = 9)  in vec2  in_reference_position_2;
-layout (location = 10) in vec4  in_stencil_key_color;
-layout (location = 11) in vec4  in_fixed_color;
+layout (location = 8)  in uint  in_reference_position_1;
+layout (location = 9)  in uint  in_reference_position_2;
+layout (location = 10) in uint  in_stencil_key_color;
+layout (location = 11) in uint  in_fixed_color;
 layout (location = 12) in float in_alpha_multiplier;
 layout (location = 13) in float in_scaling;
 layout (location = 14) in vec2  in_translation1;
@@ -94,6 +94,31 @@ uint get_downsample() {
   return (in_aux_bits_1 & VERTEX_AUX_BITS_1_DOWNSAMPLE) >> 4;
 }
 
+/****************************************************************
+** Unpacking.
+*****************************************************************/
+// These need to be kept in sync with the corresponding packing
+// functions in the C++ code. The 16 bit pairs have x in the low
+// bits.
+vec2 unpack_i16x2( in uint packed ) {
+  // Shifting a signed int right is arithmetic, so this sign-ex-
+  // tends each half.
+  return vec2( float( int( packed << 16 ) >> 16 ),
+               float( int( packed ) >> 16 ) );
+}
+
+vec2 unpack_u16x2( in uint packed ) {
+  return vec2( float( packed & uint(0xffff) ),
+               float( packed >> 16 ) );
+}
+
+vec4 unpack_rgba8( in uint packed ) {
+  return vec4( float( ( packed >> 0  ) & uint(0xff) ),
+               float( ( packed >> 8  ) & uint(0xff) ),
+               float( ( packed >> 16 ) & uint(0xff) ),
+               float( ( packed >> 24 ) & uint(0xff) ) ) / 255.0;
+}
+
 /****************************************************************
 ** Helpers.
 *****************************************************************/
@@ -145,13 +170,13 @@ void forwarding() {
   // just pass the original through since it avoids rounding er-
   // rors and associated visual artifacts when zoomed in.
   frag_depixelate_stages_unscaled = in_depixelate_stages;
-  frag_position             = shift_and_scale( in_position );
-  frag_atlas_position       = in_atlas_position;
+  frag_position             = shift_and_scale( unpack_i16x2( in_position ) );
+  frag_atlas_position       = unpack_u16x2( in_atlas_position );
   frag_atlas_rect           = in_atlas_rect;
-  frag_reference_position_1 = in_reference_position_1;
-  frag_reference_position_2 = in_reference_position_2;
-  frag_stencil_key_color    = in_stencil_key_color;
-  frag_fixed_color          = in_fixed_color;
+  frag_reference_position_1 = unpack_i16x2( in_reference_position_1 );
+  frag_reference_position_2 = unpack_i16x2( in_reference_position_2 );
+  frag_stencil_key_color    = unpack_rgba8( in_stencil_key_color );
+  frag_fixed_color          = unpack_rgba8( in_fixed_color );
   frag_alpha_multiplier     = in_alpha_multiplier;
   frag_scaling              = in_scaling;
   frag_default_hash_anchor  = shift_and_scale( vec2( 0.0 ) );
@@ -176,7 +201,8 @@ vec2 to_ndc( in vec2 game_pos ) {
 void main() {
   forwarding();
 
-  vec2 adjusted_position = shift_and_scale( in_position );
+  vec2 adjusted_position =
+      shift_and_scale( unpack_i16x2( in_position ) );
 
   gl_Position = vec4( to_ndc( adjusted_position ), 0.0, 1.0 );
 }
@@ -101,6 +101,8 @@ struct DepixelateInfo {
   // move with the sprite. So using the upper left corner of the
   // sprite seems to be a good idea.
   base::maybe<gfx::point> hash_anchor = {};
+
+  bool operator==( DepixelateInfo const& ) const = default;
 };
 
 // These options allow specifying a global rescaling and transla-
@@ -117,14 +119,20 @@ struct RepositionInfo {
   base::maybe<double> scale            = {};
   base::maybe<gfx::dsize> translation2 = {};
   bool use_camera                      = false;
+
+  bool operator==( RepositionInfo const& ) const = default;
 };
 
 struct ColorCyclingInfo {
   base::maybe<int> plan = {};
+
+  bool operator==( ColorCyclingInfo const& ) const = default;
 };
 
 struct SamplingInfo {
   base::maybe<int> downsample = {};
+
+  bool operator==( SamplingInfo const& ) const = default;
 };
 
 struct PainterMods {
@@ -136,6 +144,8 @@ struct PainterMods {
   base::maybe<gfx::pixel> fixed_color = {};
   base::maybe<StencilPlan> stencil    = {};
   SamplingInfo sampling               = {};
+
+  bool operator==( PainterMods const& ) const = default;
 };
 
 /****************************************************************
@@ -15,13 +15,13 @@ layout (location = 1)  in uint  in_flags;
 layout (location = 2)  in uint  in_aux_bits_1;
 layout (location = 3)  in vec4  in_depixelate;
 layout (location = 4)  in vec4  in_depixelate_stages;
-layout (location = 5)  in vec2  in_position;
-layout (location = 6)  in vec2  in_atlas_position;
+layout (location = 5)  in uint  in_position;
+layout (location = 6)  in uint  in_atlas_position;
 layout (location = 7)  in vec4  in_atlas_rect;
-layout (location = 8)  in vec2  in_reference_position_1;
-layout (location = 9)  in vec2  in_reference_position_2;
-layout (location = 10) in vec4  in_stencil_key_color;
-layout (location = 11) in vec4  in_fixed_color;
+layout (location = 8)  in uint  in_reference_position_1;
+layout (location = 9)  in uint  in_reference_position_2;
+layout (location = 10) in uint  in_stencil_key_color;
+layout (location = 11) in uint  in_fixed_color;
 layout (location = 12) in float in_alpha_multiplier;
 layout (location = 13) in float in_scaling;
 layout (location = 14) in vec2  in_translation1;
@@ -34,8 +34,18 @@ uniform vec2 u_screen_size;
 /****************************************************************
 ** Helpers.
 *****************************************************************/
+// Must be kept in sync with the one in generic.vert.
+vec2 unpack_i16x2( in uint packed ) {
+  return vec2( float( int( packed << 16 ) >> 16 ),
+               float( int( packed ) >> 16 ) );
+}
+
+vec2 position() {
+  return unpack_i16x2( in_position );
+}
+
 void forward() {
-  frag_position = in_position;
+  frag_position = position();
 }
 
 // Convert a coordinate in game coordinates (meaning that 0,0 is
@@ -57,11 +67,11 @@ vec4 use_me() {
     + vec4( in_aux_bits_1 )
     + vec4( in_depixelate )
     + vec4( in_depixelate_stages )
-    + vec4( in_position, 0, 0 )
-    + vec4( in_atlas_position, 0, 0 )
+    + vec4( in_position )
+    + vec4( in_atlas_position )
     + vec4( in_atlas_rect )
-    + vec4( in_reference_position_1, 0, 0 )
-    + vec4( in_reference_position_2, 0, 0 )
+    + vec4( in_reference_position_1 )
+    + vec4( in_reference_position_2 )
     + vec4( in_stencil_key_color )
     + vec4( in_fixed_color )
     + vec4( in_alpha_multiplier )
@@ -78,5 +88,5 @@ vec4 use_me() {
 void main() {
   forward();
 
-  gl_Position = vec4( to_ndc( in_position ), 0.0, 1.0 ) + use_me();
+  gl_Position = vec4( to_ndc( position() ), 0.0, 1.0 ) + use_me();
 }
@@ -10,6 +10,13 @@
 *****************************************************************/
 #include "rect-pack.hpp"
 
+// refl
+#include "refl/query-enum.hpp"
+
+// C++ standard library
+#include <algorithm>
+#include <limits>
+
 using namespace std;
 
 namespace rr {
@@ -21,6 +28,7 @@ using ::base::nothing;
 using ::gfx::point;
 using ::gfx::rect;
 using ::gfx::size;
+using ::refl::enum_values;
 
 struct packer {
   enum class [[nodiscard]] e_status {
@@ -124,8 +132,246 @@ struct packer {
   size size_used_                    = {};
 };
 
+/****************************************************************
+** MaxRects
+*****************************************************************/
+// Maintains the list of all maximal free rectangles in the bin.
+// A free rectangle is maximal if it is not contained in any
+// other free rectangle; they will generally overlap each other.
+struct MaxRectsBin {
+  explicit MaxRectsBin( size const bin ) {
+    if( bin.w > 0 && bin.h > 0 )
+      free_.push_back( rect{ .origin = {}, .size = bin } );
+  }
+
+  // Finds the best spot for a rect of the given size according
+  // to the heuristic, or nothing if it can't fit anywhere. Ties
+  // are broken by the order of the free list, which is determin-
+  // istic.
+  maybe<point> find_position(
+      size const s, e_rect_pack_heuristic const heuristic ) const {
+    maybe<point> res;
+    int best_primary   = numeric_limits<int>::max();
+    int best_secondary = numeric_limits<int>::max();
+    for( rect const& free : free_ ) {
+      if( free.size.w < s.w || free.size.h < s.h ) continue;
+      int const leftover_w = free.size.w - s.w;
+      int const leftover_h = free.size.h - s.h;
+      int const short_side = std::min( leftover_w, leftover_h );
+      int const long_side  = std::max( leftover_w, leftover_h );
+      int primary = 0, secondary = 0;
+      switch( heuristic ) {
+        case e_rect_pack_heuristic::best_short_side_fit:
+          primary   = short_side;
+          secondary = long_side;
+          break;
+        case e_rect_pack_heuristic::best_long_side_fit:
+          primary   = long_side;
+          secondary = short_side;
+          break;
+        case e_rect_pack_heuristic::best_area_fit:
+          primary   = free.size.area() - s.area();
+          secondary = short_side;
+          break;
+        case e_rect_pack_heuristic::bottom_left:
+          primary   = free.origin.y + s.h;
+          secondary = free.origin.x;
+          break;
+      }
+      if( primary < best_primary ||
+          ( primary == best_primary &&
+            secondary < best_secondary ) ) {
+        best_primary   = primary;
+        best_secondary = secondary;
+        res            = free.origin;
+      }
+    }
+    return res;
+  }
+
+  void place( rect const used ) {
+    vector<rect> kept;
+    vector<rect> added;
+    kept.reserve( free_.size() );
+    for( rect const& free : free_ ) {
+      if( !overlaps( free, used ) ) {
+        kept.push_back( free );
+        continue;
+      }
+      split( free, used, added );
+    }
+    // Only the newly created rects need to be pruned. They can't
+    // contain any of the untouched ones, since those would then
+    // have been contained in the free rect that they were split
+    // from, which would have violated maximality.
+    vector<char> dead( added.size(), false );
+    for( int i = 0; i < ssize( added ); ++i ) {
+      for( rect const& free : kept ) {
+        if( contains( free, added[i] ) ) {
+          dead[i] = true;
+          break;
+        }
+      }
+      if( dead[i] ) continue;
+      for( int j = 0; j < ssize( added ); ++j ) {
+        if( i == j || dead[j] ) continue;
+        if( !contains( added[j], added[i] ) ) continue;
+        // If the two are equal then only the first survives.
+        if( added[i] == added[j] && i < j ) continue;
+        dead[i] = true;
+        break;
+      }
+    }
+    for( int i = 0; i < ssize( added ); ++i )
+      if( !dead[i] ) kept.push_back( added[i] );
+    free_ = std::move( kept );
+  }
+
+ private:
+  static bool overlaps( rect const& l, rect const& r ) {
+    return l.origin.x < r.origin.x + r.size.w &&
+           r.origin.x < l.origin.x + l.size.w &&
+           l.origin.y < r.origin.y + r.size.h &&
+           r.origin.y < l.origin.y + l.size.h;
+  }
+
+  // Whether `inner` is contained in `outer`.
+  static bool contains( rect const& outer, rect const& inner ) {
+    return inner.origin.x >= outer.origin.x &&
+           inner.origin.y >= outer.origin.y &&
+           inner.origin.x + inner.size.w <=
+               outer.origin.x + outer.size.w &&
+           inner.origin.y + inner.size.h <=
+               outer.origin.y + outer.size.h;
+  }
+
+  // Produces the (up to four) maximal rects that remain of
+  // `free` after removing `used` from it.
+  static void split( rect const& free, rect const& used,
+                     vector<rect>& out ) {
+    int const free_right  = free.origin.x + free.size.w;
+    int const free_bottom = free.origin.y + free.size.h;
+    int const used_right  = used.origin.x + used.size.w;
+    int const used_bottom = used.origin.y + used.size.h;
+    if( used.origin.x > free.origin.x )
+      out.push_back( rect{
+        .origin = free.origin,
+        .size   = { .w = used.origin.x - free.origin.x,
+                    .h = free.size.h } } );
+    if( used_right < free_right )
+      out.push_back( rect{
+        .origin = { .x = used_right, .y = free.origin.y },
+        .size   = { .w = free_right - used_right,
+                    .h = free.size.h } } );
+    if( used.origin.y > free.origin.y )
+      out.push_back( rect{
+        .origin = free.origin,
+        .size   = { .w = free.size.w,
+                    .h = used.origin.y - free.origin.y } } );
+    if( used_bottom < free_bottom )
+      out.push_back( rect{
+        .origin = { .x = free.origin.x, .y = used_bottom },
+        .size   = { .w = free.size.w,
+                    .h = free_bottom - used_bottom } } );
+  }
+
+  vector<rect> free_;
+};
+
+// Returns the key by which to sort in descending order.
+int64_t sort_key( e_rect_pack_sort const sort, size const s ) {
+  switch( sort ) {
+    case e_rect_pack_sort::area:
+      return s.area();
+    case e_rect_pack_sort::max_side:
+      return std::max( s.w, s.h );
+    case e_rect_pack_sort::perimeter:
+      return s.w + s.h;
+    case e_rect_pack_sort::height:
+      return s.h;
+  }
+}
+
 } // namespace
 
+double RectPackStats::efficiency() const {
+  int64_t const total = int64_t( size_used.w ) * size_used.h;
+  if( total == 0 ) return 1.0;
+  return double( area_occupied ) / total;
+}
+
+maybe<RectPackStats> pack_rects_max_rects(
+    span<rect> rects, size const max_size,
+    RectPackOptions const& options ) {
+  vector<rect*> ptrs;
+  ptrs.reserve( rects.size() );
+  for( rect& r : rects ) ptrs.push_back( &r );
+  // The secondary keys make the sort more optimal for the rects
+  // that compare equal under the primary key; the stability is
+  // for unit tests.
+  std::stable_sort(
+      ptrs.begin(), ptrs.end(),
+      [&]( rect const* l, rect const* r ) {
+        int64_t const l_key = sort_key( options.sort, l->size );
+        int64_t const r_key = sort_key( options.sort, r->size );
+        if( l_key != r_key ) return l_key > r_key;
+        if( l->size.h != r->size.h ) return l->size.h > r->size.h;
+        return l->size.w > r->size.w;
+      } );
+  MaxRectsBin bin( max_size );
+  RectPackStats stats;
+  for( rect* const r : ptrs ) {
+    if( r->size.negative() ) return nothing;
+    if( r->size.area() == 0 ) {
+      // These don't take up any space, but they still need a
+      // valid origin within the bounds.
+      r->origin = point::origin();
+      continue;
+    }
+    maybe<point> const where =
+        bin.find_position( r->size, options.heuristic );
+    if( !where.has_value() ) return nothing;
+    r->origin = *where;
+    bin.place( *r );
+    stats.size_used = stats.size_used.max_with(
+        ( *where + r->size ).distance_from_origin() );
+    stats.area_occupied += r->size.area();
+  }
+  return stats;
+}
+
+maybe<RectPackStats> pack_rects_best( span<rect> rects,
+                                      size const max_size ) {
+  maybe<RectPackStats> best;
+  vector<rect> best_rects;
+  vector<rect> scratch;
+  for( e_rect_pack_sort const sort :
+       enum_values<e_rect_pack_sort> ) {
+    for( e_rect_pack_heuristic const heuristic :
+         enum_values<e_rect_pack_heuristic> ) {
+      scratch.assign( rects.begin(), rects.end() );
+      maybe<RectPackStats> const stats = pack_rects_max_rects(
+          scratch, max_size,
+          RectPackOptions{ .heuristic = heuristic,
+                           .sort      = sort } );
+      if( !stats.has_value() ) continue;
+      if( best.has_value() ) {
+        int64_t const area =
+            int64_t( stats->size_used.w ) * stats->size_used.h;
+        int64_t const best_area =
+            int64_t( best->size_used.w ) * best->size_used.h;
+        if( area >= best_area ) continue;
+      }
+      best       = stats;
+      best_rects = scratch;
+    }
+  }
+  if( !best.has_value() ) return nothing;
+  std::copy( best_rects.begin(), best_rects.end(),
+             rects.begin() );
+  return best;
+}
+
 maybe<size> pack_rects( span<rect> rects, size const max_size ) {
   vector<rect*> ptrs;
   ptrs.reserve( rects.size() );
@@ -10,6 +10,9 @@
 *****************************************************************/
 #pragma once
 
+// Rds
+#include "rect-pack.rds.hpp"
+
 // gfx
 #include "gfx/cartesian.hpp"
 
@@ -17,6 +20,7 @@
 #include "base/maybe.hpp"
 
 // C++ standard library
+#include <cstdint>
 #include <span>
 
 namespace rr {
@@ -32,4 +36,45 @@ namespace rr {
 base::maybe<gfx::size> pack_rects( std::span<gfx::rect> rp,
                                    gfx::size const max_size );
 
+/****************************************************************
+** MaxRects Packing.
+*****************************************************************/
+struct RectPackOptions {
+  e_rect_pack_heuristic heuristic =
+      e_rect_pack_heuristic::best_short_side_fit;
+  e_rect_pack_sort sort = e_rect_pack_sort::max_side;
+};
+
+struct RectPackStats {
+  // The bounding size of all of the packed rects, anchored at
+  // the origin.
+  gfx::size size_used = {};
+
+  // Sum of the areas of the packed rects themselves.
+  int64_t area_occupied = 0;
+
+  // Fraction of size_used that is covered by rects, in [0, 1].
+  // An empty packing is considered to be fully efficient.
+  double efficiency() const;
+
+  bool operator==( RectPackStats const& ) const = default;
+};
+
+// Same contract as pack_rects above, but uses the MaxRects algo-
+// rithm, which keeps track of all maximal free rectangles and is
+// therefore able to fill in holes that the shelf-based algorithm
+// above leaves behind. Note that rects are never rotated, since
+// our sprites are pixel art that is sampled directly from the
+// atlas. Deterministic for a given input and options.
+base::maybe<RectPackStats> pack_rects_max_rects(
+    std::span<gfx::rect> rp, gfx::size max_size,
+    RectPackOptions const& options = {} );
+
+// Runs pack_rects_max_rects with each combination of heuristic
+// and sort order and keeps the one that gives the smallest
+// bounding area. This is a bit more expensive, but it is only
+// done once when building the atlas.
+base::maybe<RectPackStats> pack_rects_best(
+    std::span<gfx::rect> rp, gfx::size max_size );
+
 } // namespace rr
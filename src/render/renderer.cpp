@@ -31,6 +31,7 @@
 #include "gl/uniform.hpp"
 #include "gl/vertex-array.hpp"
 #include "gl/vertex-buffer.hpp"
+#include "gl/vertex-ring.hpp"
 
 // stb
 #include "stb/image.hpp"
@@ -157,6 +158,11 @@ struct RenderBuffer {
   // false.
   bool track_dirty = false;
   bool dirty       = true;
+  // Buffers that don't track dirty status get re-uploaded every
+  // frame, which is done by streaming them through this ring so
+  // that we don't have to wait on the GPU or re-specify the
+  // buffer each time.
+  gl::VertexRing<GenericVertex> ring = {};
 };
 
 /****************************************************************
@@ -288,7 +294,8 @@ struct Renderer::Impl {
                         .vertices     = std::move( vertices ),
                         .emitter      = Emitter( *p_vertices ),
                         .track_dirty  = track_dirty,
-                        .dirty        = true };
+                        .dirty        = true,
+                        .ring         = {} };
     }
 
     auto pgrm = [&] {
@@ -381,6 +388,9 @@ struct Renderer::Impl {
     if( config.dump_atlas_png.has_value() ) {
       lg.info( "writing atlas png to {}.",
                *config.dump_atlas_png );
+      lg.info( "atlas size: {}, occupancy: {:.1f}%.",
+               atlas.stats.size_used,
+               atlas.stats.efficiency() * 100.0 );
       CHECK_HAS_VALUE(
           stb::save_image( *config.dump_atlas_png, atlas.img ) );
     }
@@ -588,6 +598,37 @@ struct Renderer::Impl {
     return rng;
   }
 
+  VertexRange capture( function_ref<void()> const f,
+                       vector<GenericVertex>& out ) {
+    VertexRange const rng = range_for( f );
+    vector<GenericVertex> const& vertices =
+        get_buffer( rng.buffer );
+    CHECK_LE( rng.finish, long( vertices.size() ) );
+    out.assign( vertices.begin() + rng.start,
+                vertices.begin() + rng.finish );
+    return rng;
+  }
+
+  void replay( span<GenericVertex const> const vertices,
+               size const translation ) {
+    if( vertices.empty() ) return;
+    e_render_buffer const buffer = mods().buffer_mods.buffer;
+    Emitter& emitter             = get_emitter( buffer );
+    long const start             = emitter.position();
+    emitter.emit( vertices );
+    if( translation != size{} ) {
+      // Translation 1 is applied before scaling, so adding to it
+      // is equivalent to shifting the positions themselves.
+      vector<GenericVertex>& dst = get_buffer( buffer );
+      for( long i = start; i < emitter.position(); ++i ) {
+        dst[i].translation1.x += float( translation.w );
+        dst[i].translation1.y += float( translation.h );
+      }
+    }
+    if( buffers[buffer]->track_dirty )
+      buffers[buffer]->dirty = true;
+  }
+
   vector<GenericVertex>& get_buffer( e_render_buffer buffer ) {
     return *buffers[buffer]->vertices;
   }
@@ -658,7 +699,18 @@ struct Renderer::Impl {
     auto const& vertex_array = buffers[buffer]->vertex_array;
     auto& vertices           = *buffers[buffer]->vertices;
     bool& dirty              = buffers[buffer]->dirty;
-    if( !buffers[buffer]->track_dirty || dirty )
+    if( !buffers[buffer]->track_dirty ) {
+      // Note that the dirty flag is left set here since the
+      // buffer on the GPU is not laid out like the vertex array,
+      // which means that zapping must not upload into it.
+      auto& ring      = buffers[buffer]->ring;
+      int const first = ring.upload( vertex_array.buffer<0>(),
+                                     vertices );
+      pgrm.run( vertex_array, first, vertices.size() );
+      ring.fence();
+      return;
+    }
+    if( dirty )
       vertex_array.buffer<0>().upload_data_replace(
           vertices, gl::e_draw_mode::stat1c );
     dirty = false;
@@ -952,4 +1004,14 @@ VertexRange Renderer::range_for( function_ref<void()> f ) const {
   return impl_->range_for( f );
 }
 
+VertexRange Renderer::capture( function_ref<void()> f,
+                               vector<GenericVertex>& out ) {
+  return impl_->capture( f, out );
+}
+
+void Renderer::replay( span<GenericVertex const> vertices,
+                       size translation ) {
+  impl_->replay( vertices, translation );
+}
+
 } // namespace rr
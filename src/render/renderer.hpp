@@ -19,6 +19,7 @@
 #include "painter.hpp"
 #include "sprite-sheet.rds.hpp"
 #include "typer.hpp"
+#include "vertex.hpp"
 
 // base
 #include "base/function-ref.hpp"
@@ -27,8 +28,10 @@
 // C++ standard library
 #include <functional>
 #include <memory>
+#include <span>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace gfx {
 enum class e_resolution;
@@ -129,11 +132,15 @@ struct RendererConfig {
 *****************************************************************/
 struct BufferInfo {
   e_render_buffer buffer = e_render_buffer::normal;
+
+  bool operator==( BufferInfo const& ) const = default;
 };
 
 struct RendererMods {
   PainterMods painter_mods = {};
   BufferInfo buffer_mods   = {};
+
+  bool operator==( RendererMods const& ) const = default;
 };
 
 template<typename Func>
@@ -221,6 +228,21 @@ struct Renderer : IRenderer, IRendererSettings {
   // only.
   VertexRange range_for( base::function_ref<void()> f ) const;
 
+  // Same as range_for but also copies the vertices that were
+  // added into `out` (replacing its contents) so that they can
+  // later be replayed without running the function again. The
+  // vertices are still drawn for this frame as usual.
+  VertexRange capture( base::function_ref<void()> f,
+                       std::vector<GenericVertex>& out );
+
+  // Appends vertices captured via `capture` to the current
+  // buffer, shifting them by `translation` (which is in the same
+  // coordinates as the positions of the vertices). Note that the
+  // vertices already have all renderer mods baked in from when
+  // they were captured; the current mods are ignored.
+  void replay( std::span<GenericVertex const> vertices,
+               gfx::size translation );
+
   // This will edit the vertex buffer to zero-out all vertices
   // from [start, end). The GenericVertex is set up so that when
   // it is zero'd its `visible` field will be false (0) which
@@ -10,8 +10,12 @@
 *****************************************************************/
 #include "vertex.hpp"
 
+// base
+#include "base/error.hpp"
+
 // C++ standard library
 #include <cmath>
+#include <limits>
 
 using namespace std;
 
@@ -40,11 +44,13 @@ GenericVertex proto_vertex( vertex_type type,
     .aux_bits_1           = 0,
     .depixelate           = gl::vec4{},
     .depixelate_stages    = gl::vec4{},
-    .position             = gl::vec2::from_point( position ),
-    .atlas_position       = {},
+    .position             = pack_i16x2( position ),
+    .atlas_position       = 0,
     .atlas_rect           = {},
-    .reference_position_1 = {},
-    .fixed_color          = {},
+    .reference_position_1 = 0,
+    .reference_position_2 = 0,
+    .stencil_key_color    = 0,
+    .fixed_color          = 0,
     .alpha_multiplier     = 1.0f,
     .scaling              = 1.0,
     .translation1         = {},
@@ -54,6 +60,67 @@ GenericVertex proto_vertex( vertex_type type,
 
 } // namespace
 
+/****************************************************************
+** Packing.
+*****************************************************************/
+uint32_t pack_i16x2( int const x, int const y ) {
+  using limits = numeric_limits<int16_t>;
+  CHECK( x >= limits::min() && x <= limits::max(),
+         "x={} does not fit in a 16 bit vertex attribute.", x );
+  CHECK( y >= limits::min() && y <= limits::max(),
+         "y={} does not fit in a 16 bit vertex attribute.", y );
+  return uint32_t( uint16_t( int16_t( x ) ) ) |
+         ( uint32_t( uint16_t( int16_t( y ) ) ) << 16 );
+}
+
+uint32_t pack_u16x2( int const x, int const y ) {
+  using limits = numeric_limits<uint16_t>;
+  CHECK( x >= 0 && x <= limits::max(),
+         "x={} does not fit in a 16 bit vertex attribute.", x );
+  CHECK( y >= 0 && y <= limits::max(),
+         "y={} does not fit in a 16 bit vertex attribute.", y );
+  return uint32_t( uint16_t( x ) ) |
+         ( uint32_t( uint16_t( y ) ) << 16 );
+}
+
+uint32_t pack_rgba8( pixel const p ) {
+  return uint32_t( p.r ) | ( uint32_t( p.g ) << 8 ) |
+         ( uint32_t( p.b ) << 16 ) | ( uint32_t( p.a ) << 24 );
+}
+
+point unpack_i16x2( uint32_t const packed ) {
+  return point{ .x = int16_t( packed & 0xffff ),
+                .y = int16_t( packed >> 16 ) };
+}
+
+point unpack_u16x2( uint32_t const packed ) {
+  return point{ .x = int( packed & 0xffff ),
+                .y = int( packed >> 16 ) };
+}
+
+pixel unpack_rgba8( uint32_t const packed ) {
+  return pixel{ .r = uint8_t( packed >> 0 ),
+                .g = uint8_t( packed >> 8 ),
+                .b = uint8_t( packed >> 16 ),
+                .a = uint8_t( packed >> 24 ) };
+}
+
+uint32_t pack_i16x2( point const p ) {
+  return pack_i16x2( p.x, p.y );
+}
+
+uint32_t pack_i16x2( gfx::size const s ) {
+  return pack_i16x2( s.w, s.h );
+}
+
+uint32_t pack_u16x2( point const p ) {
+  return pack_u16x2( p.x, p.y );
+}
+
+uint32_t pack_u16x2( gfx::size const s ) {
+  return pack_u16x2( s.w, s.h );
+}
+
 /****************************************************************
 ** VertexBase
 *****************************************************************/
@@ -196,22 +263,12 @@ void VertexBase::set_fixed_color(
     return;
   }
   flags |= mask;
-  fixed_color.r = color->r / 255.0;
-  fixed_color.g = color->g / 255.0;
-  fixed_color.b = color->b / 255.0;
-  fixed_color.a = color->a / 255.0;
+  fixed_color = pack_rgba8( *color );
 }
 
 base::maybe<gfx::pixel> VertexBase::get_fixed_color() const {
   if( !( flags & VERTEX_FLAG_FIXED_COLOR ) ) return nothing;
-  auto to_8_bit = []( float f ) {
-    return static_cast<uint8_t>(
-        clamp( static_cast<int>( floor( f * 255 ) ), 0, 255 ) );
-  };
-  return gfx::pixel{ .r = to_8_bit( fixed_color.r ),
-                     .g = to_8_bit( fixed_color.g ),
-                     .b = to_8_bit( fixed_color.b ),
-                     .a = to_8_bit( fixed_color.a ) };
+  return unpack_rgba8( fixed_color );
 }
 
 void VertexBase::set_uniform_depixelation( bool enabled ) {
@@ -232,8 +289,8 @@ void VertexBase::set_textured_depixelation(
   auto constexpr mask = VERTEX_FLAG_TEXTURED_DEPIXELATION;
   if( txdpxl ) {
     flags |= mask;
-    reference_position_2.x = txdpxl->reference_sprite_offset.w;
-    reference_position_2.y = txdpxl->reference_sprite_offset.h;
+    reference_position_2 =
+        pack_i16x2( txdpxl->reference_sprite_offset );
   } else {
     flags &= ~mask;
   }
@@ -243,11 +300,9 @@ maybe<TxDpxl> VertexBase::get_textured_depixelation() const {
   auto constexpr mask = VERTEX_FLAG_TEXTURED_DEPIXELATION;
   bool const enabled  = ( ( flags & mask ) != 0 ) ? true : false;
   if( !enabled ) return nothing;
-  return TxDpxl{
-    .reference_sprite_offset = {
-      .w = static_cast<int>( reference_position_2.x ),
-      .h = static_cast<int>( reference_position_2.y ),
-    } };
+  point const offset = unpack_i16x2( reference_position_2 );
+  return TxDpxl{ .reference_sprite_offset = {
+                   .w = offset.x, .h = offset.y } };
 }
 
 /****************************************************************
@@ -258,7 +313,7 @@ SpriteVertex::SpriteVertex( gfx::point position,
                             gfx::rect atlas_rect,
                             maybe<TxDpxl> const txdpxl )
   : VertexBase( proto_vertex( vertex_type::sprite, position ) ) {
-  this->atlas_position = gl::vec2::from_point( atlas_position );
+  this->atlas_position = pack_u16x2( atlas_position );
   this->atlas_rect     = gl::vec4::from_rect( atlas_rect );
   set_textured_depixelation( txdpxl );
 }
@@ -268,7 +323,7 @@ SpriteVertex::SpriteVertex( gfx::point position,
 *****************************************************************/
 SolidVertex::SolidVertex( gfx::point position, gfx::pixel color )
   : VertexBase( proto_vertex( vertex_type::solid, position ) ) {
-  this->fixed_color = gl::color::from_pixel( color );
+  this->fixed_color = pack_rgba8( color );
 }
 
 /****************************************************************
@@ -280,11 +335,10 @@ SpriteStencilVertex::SpriteStencilVertex(
     gfx::pixel key_color, maybe<TxDpxl> const txdpxl )
   : VertexBase(
         proto_vertex( vertex_type::stencil_sprite, position ) ) {
-  this->atlas_position = gl::vec2::from_point( atlas_position );
-  this->atlas_rect     = gl::vec4::from_rect( atlas_rect );
-  this->reference_position_1 =
-      gl::vec2::from_size( atlas_target_offset );
-  this->stencil_key_color = gl::color::from_pixel( key_color );
+  this->atlas_position       = pack_u16x2( atlas_position );
+  this->atlas_rect           = gl::vec4::from_rect( atlas_rect );
+  this->reference_position_1 = pack_i16x2( atlas_target_offset );
+  this->stencil_key_color    = pack_rgba8( key_color );
   set_textured_depixelation( txdpxl );
 }
 
@@ -297,10 +351,10 @@ FixedStencilVertex::FixedStencilVertex(
     gfx::pixel key_color, maybe<TxDpxl> const txdpxl )
   : VertexBase(
         proto_vertex( vertex_type::stencil_fixed, position ) ) {
-  this->atlas_position = gl::vec2::from_point( atlas_position );
-  this->atlas_rect     = gl::vec4::from_rect( atlas_rect );
-  this->fixed_color = gl::color::from_pixel( replacement_color );
-  this->stencil_key_color = gl::color::from_pixel( key_color );
+  this->atlas_position    = pack_u16x2( atlas_position );
+  this->atlas_rect        = gl::vec4::from_rect( atlas_rect );
+  this->fixed_color       = pack_rgba8( replacement_color );
+  this->stencil_key_color = pack_rgba8( key_color );
   set_textured_depixelation( txdpxl );
 }
 
@@ -311,10 +365,9 @@ LineVertex::LineVertex( point const position,
                         point const line_start,
                         point const line_end, pixel const color )
   : VertexBase( proto_vertex( vertex_type::line, position ) ) {
-  this->fixed_color = gl::color::from_pixel( color );
-  this->reference_position_1 =
-      gl::vec2::from_point( line_start );
-  this->reference_position_2 = gl::vec2::from_point( line_end );
+  this->fixed_color          = pack_rgba8( color );
+  this->reference_position_1 = pack_i16x2( line_start );
+  this->reference_position_2 = pack_i16x2( line_end );
 }
 
 } // namespace rr
@@ -18,6 +18,9 @@
 #include "gfx/pixel.hpp"
 
 // C++ standard library
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
 namespace rr {
@@ -29,6 +32,13 @@ namespace rr {
   static_assert( std::alignment_of_v<type> ==                 \
                  std::alignment_of_v<GenericVertex> );
 
+// Each field of GenericVertex becomes one vertex attribute. 16
+// is the minimum value of GL_MAX_VERTEX_ATTRIBS that OpenGL
+// guarantees, and many drivers report exactly that.
+static_assert( std::tuple_size_v<std::remove_cvref_t<decltype(
+                   refl::traits<GenericVertex>::fields )>> <=
+               16 );
+
 /****************************************************************
 ** Flag bit masks.
 *****************************************************************/
@@ -49,6 +59,27 @@ namespace rr {
 #define VERTEX_AUX_BITS_1_COLOR_CYCLE ( uint32_t{ 0xf } << 0 )
 #define VERTEX_AUX_BITS_1_DOWNSAMPLE  ( uint32_t{ 0x7 } << 4 )
 
+/****************************************************************
+** Packing.
+*****************************************************************/
+// These need to be kept in sync with the corresponding unpacking
+// functions in the shader. The 16 bit pairs have x (or w) in the
+// low bits. Values that don't fit in 16 bits are a CHECK-fail
+// (even in release builds) since they would otherwise wrap and
+// silently be drawn in the wrong place.
+uint32_t pack_i16x2( int x, int y );
+uint32_t pack_u16x2( int x, int y );
+uint32_t pack_rgba8( gfx::pixel p );
+
+gfx::point unpack_i16x2( uint32_t packed );
+gfx::point unpack_u16x2( uint32_t packed );
+gfx::pixel unpack_rgba8( uint32_t packed );
+
+uint32_t pack_i16x2( gfx::point p );
+uint32_t pack_i16x2( gfx::size s );
+uint32_t pack_u16x2( gfx::point p );
+uint32_t pack_u16x2( gfx::size s );
+
 /****************************************************************
 ** Helper Structs.
 *****************************************************************/
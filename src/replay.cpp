@@ -0,0 +1,684 @@
+/****************************************************************
+**replay.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Recording and replaying of turns.
+*
+*****************************************************************/
+#include "replay.hpp"
+
+// Revolution Now
+#include "agents.hpp"
+#include "capture-cargo.rds.hpp"
+#include "co-wait.hpp"
+
+// ss
+#include "ss/nation.rds.hpp"
+#include "ss/players.rds.hpp"
+#include "ss/ref.hpp"
+#include "ss/root.rds.hpp"
+
+// rcl
+#include "rcl/emit.hpp"
+#include "rcl/parse.hpp"
+#include "rcl/to.hpp"
+
+// gfx
+#include "gfx/cdr-matrix.hpp"
+
+// refl
+#include "refl/to-str.hpp"
+
+// base
+#include "base/hash.hpp"
+#include "base/logger.hpp"
+#include "base/to-str-ext-std.hpp"
+
+// C++ standard library
+#include <fstream>
+
+using namespace std;
+
+namespace rn {
+
+namespace {
+
+using ::base::lg;
+using ::base::valid;
+using ::base::valid_or;
+using ::gfx::point;
+
+string hash_string( RootState const& root ) {
+  return fmt::format( "{:016x}", root_state_hash( root ) );
+}
+
+} // namespace
+
+/****************************************************************
+** DecisionLog
+*****************************************************************/
+DecisionLog::DecisionLog() : mode_( e_replay_mode::record ) {}
+
+DecisionLog::DecisionLog( vector<ReplayDecision> decisions )
+  : mode_( e_replay_mode::replay ),
+    decisions_( std::move( decisions ) ) {}
+
+maybe<cdr::value const&> DecisionLog::peek(
+    string_view const key ) {
+  if( mode_ != e_replay_mode::replay ) return nothing;
+  if( divergence_.has_value() ) return nothing;
+  if( next_ >= ssize( decisions_ ) ) {
+    diverged( key, "the log has no more decisions" );
+    return nothing;
+  }
+  ReplayDecision const& decision = decisions_[next_];
+  if( decision.key != key ) {
+    diverged( key, fmt::format( "the log has `{}' instead",
+                                decision.key ) );
+    return nothing;
+  }
+  return decision.result;
+}
+
+maybe<cdr::value const&> DecisionLog::next(
+    string_view const key ) {
+  maybe<cdr::value const&> const res = peek( key );
+  if( res.has_value() ) ++next_;
+  return res;
+}
+
+void DecisionLog::diverged( string_view const key,
+                            string const& why ) {
+  if( divergence_.has_value() ) return;
+  divergence_ = fmt::format(
+      "replay diverged at decision #{} (`{}'): {}.", next_, key,
+      why );
+  lg.error( "{}", *divergence_ );
+}
+
+void DecisionLog::record( string key, cdr::value result ) {
+  decisions_.push_back( ReplayDecision{
+    .key = std::move( key ), .result = std::move( result ) } );
+}
+
+void DecisionLog::remade( string key, cdr::value result ) {
+  switch( mode_ ) {
+    case e_replay_mode::record:
+      record( std::move( key ), std::move( result ) );
+      return;
+    case e_replay_mode::replay: {
+      maybe<cdr::value const&> const logged = peek( key );
+      if( !logged.has_value() ) return;
+      if( *logged != result ) {
+        diverged( key,
+                  "the result differs from the one in the log" );
+        return;
+      }
+      ++next_;
+      return;
+    }
+  }
+}
+
+/****************************************************************
+** ReplayAgent
+*****************************************************************/
+ReplayAgent::ReplayAgent( unique_ptr<IAgent> inner,
+                          DecisionLog& log )
+  : IAgent( inner->player_type() ),
+    inner_( std::move( inner ) ),
+    log_( log ) {
+  CHECK( inner_ != nullptr );
+}
+
+string ReplayAgent::key( string_view const what ) const {
+  return fmt::format( "{}.{}", player_type(), what );
+}
+
+wait<> ReplayAgent::message_box( string const& msg ) {
+  return inner_->message_box( msg );
+}
+
+Player const& ReplayAgent::player() { return inner_->player(); }
+
+bool ReplayAgent::human() const { return inner_->human(); }
+
+void ReplayAgent::dump_last_message() const {
+  inner_->dump_last_message();
+}
+
+wait<e_declare_war_on_natives>
+ReplayAgent::meet_tribe_ui_sequence( MeetTribe const& meet_tribe,
+                                     point const tile ) {
+  return log_.remake<e_declare_war_on_natives>(
+      key( fmt::format( "meet_tribe_ui_sequence.{}", tile ) ),
+      [this, &meet_tribe, tile] {
+        return inner_->meet_tribe_ui_sequence( meet_tribe,
+                                               tile );
+      } );
+}
+
+wait<> ReplayAgent::show_woodcut( e_woodcut const woodcut ) {
+  return inner_->show_woodcut( woodcut );
+}
+
+wait<base::heap_value<CapturableCargoItems>>
+ReplayAgent::select_commodities_to_capture(
+    UnitId const src, UnitId const dst,
+    CapturableCargo const& items ) {
+  return log_.remake<base::heap_value<CapturableCargoItems>>(
+      key( fmt::format( "select_commodities_to_capture.{}.{}",
+                        src, dst ) ),
+      [this, src, dst, &items] {
+        return inner_->select_commodities_to_capture( src, dst,
+                                                      items );
+      } );
+}
+
+wait<> ReplayAgent::notify_captured_cargo(
+    Player const& src_player, Player const& dst_player,
+    Unit const& dst_unit, Commodity const& stolen ) {
+  return inner_->notify_captured_cargo( src_player, dst_player,
+                                        dst_unit, stolen );
+}
+
+wait<string> ReplayAgent::name_new_world() {
+  return log_.remake<string>( key( "name_new_world" ), [this] {
+    return inner_->name_new_world();
+  } );
+}
+
+wait<ui::e_confirm> ReplayAgent::should_king_transport_treasure(
+    string const& msg ) {
+  return log_.remake<ui::e_confirm>(
+      key( "should_king_transport_treasure" ), [this, &msg] {
+        return inner_->should_king_transport_treasure( msg );
+      } );
+}
+
+wait<ui::e_confirm>
+ReplayAgent::should_explore_ancient_burial_mounds() {
+  return log_.remake<ui::e_confirm>(
+      key( "should_explore_ancient_burial_mounds" ), [this] {
+        return inner_->should_explore_ancient_burial_mounds();
+      } );
+}
+
+wait<chrono::microseconds> ReplayAgent::wait_for(
+    chrono::milliseconds const us ) {
+  return inner_->wait_for( us );
+}
+
+wait<> ReplayAgent::pan_tile( point const tile ) {
+  return inner_->pan_tile( tile );
+}
+
+wait<> ReplayAgent::pan_unit( UnitId const unit_id ) {
+  return inner_->pan_unit( unit_id );
+}
+
+command ReplayAgent::ask_orders( UnitId const unit_id ) {
+  return log_.remake_sync<command>(
+      key( fmt::format( "ask_orders.{}", unit_id ) ),
+      [&] { return inner_->ask_orders( unit_id ); } );
+}
+
+wait<ui::e_confirm> ReplayAgent::kiss_pinky_ring(
+    string const& msg, ColonyId const colony_id,
+    e_commodity const type, int const tax_increase ) {
+  return log_.remake<ui::e_confirm>(
+      key( fmt::format( "kiss_pinky_ring.{}", colony_id ) ),
+      [this, &msg, colony_id, type, tax_increase] {
+        return inner_->kiss_pinky_ring( msg, colony_id, type,
+                                        tax_increase );
+      } );
+}
+
+wait<ui::e_confirm>
+ReplayAgent::attack_with_partial_movement_points(
+    UnitId const unit_id ) {
+  return log_.remake<ui::e_confirm>(
+      key( fmt::format( "attack_with_partial_movement_points.{}",
+                        unit_id ) ),
+      [this, unit_id] {
+        return inner_->attack_with_partial_movement_points(
+            unit_id );
+      } );
+}
+
+wait<ui::e_confirm> ReplayAgent::should_attack_natives(
+    e_tribe const tribe ) {
+  return log_.remake<ui::e_confirm>(
+      key( fmt::format( "should_attack_natives.{}", tribe ) ),
+      [this, tribe] {
+        return inner_->should_attack_natives( tribe );
+      } );
+}
+
+wait<maybe<int>> ReplayAgent::pick_dump_cargo(
+    map<int /*slot*/, Commodity> const& options ) {
+  return log_.remake<maybe<int>>(
+      key( "pick_dump_cargo" ), [this, &options] {
+        return inner_->pick_dump_cargo( options );
+      } );
+}
+
+wait<e_native_land_grab_result>
+ReplayAgent::should_take_native_land(
+    string const& msg,
+    refl::enum_map<e_native_land_grab_result, string> const&
+        names,
+    refl::enum_map<e_native_land_grab_result, bool> const&
+        disabled ) {
+  return log_.remake<e_native_land_grab_result>(
+      key( "should_take_native_land" ),
+      [this, &msg, &names, &disabled] {
+        return inner_->should_take_native_land( msg, names,
+                                                disabled );
+      } );
+}
+
+wait<ui::e_confirm> ReplayAgent::confirm_disband_unit(
+    UnitId const unit_id ) {
+  return log_.remake<ui::e_confirm>(
+      key( fmt::format( "confirm_disband_unit.{}", unit_id ) ),
+      [this, unit_id] {
+        return inner_->confirm_disband_unit( unit_id );
+      } );
+}
+
+wait<ui::e_confirm> ReplayAgent::confirm_build_inland_colony() {
+  return log_.remake<ui::e_confirm>(
+      key( "confirm_build_inland_colony" ), [this] {
+        return inner_->confirm_build_inland_colony();
+      } );
+}
+
+wait<ui::e_confirm> ReplayAgent::confirm_build_island_colony() {
+  return log_.remake<ui::e_confirm>(
+      key( "confirm_build_island_colony" ), [this] {
+        return inner_->confirm_build_island_colony();
+      } );
+}
+
+wait<maybe<string>> ReplayAgent::name_colony() {
+  return log_.remake<maybe<string>>(
+      key( "name_colony" ),
+      [this] { return inner_->name_colony(); } );
+}
+
+wait<ui::e_confirm> ReplayAgent::should_make_landfall(
+    bool const some_units_already_moved ) {
+  return log_.remake<ui::e_confirm>(
+      key( "should_make_landfall" ),
+      [this, some_units_already_moved] {
+        return inner_->should_make_landfall(
+            some_units_already_moved );
+      } );
+}
+
+wait<ui::e_confirm> ReplayAgent::should_sail_high_seas(
+    UnitId const unit_id ) {
+  return log_.remake<ui::e_confirm>(
+      key( fmt::format( "should_sail_high_seas.{}", unit_id ) ),
+      [this, unit_id] {
+        return inner_->should_sail_high_seas( unit_id );
+      } );
+}
+
+EvolveGoto ReplayAgent::evolve_goto( UnitId const unit_id ) {
+  return log_.remake_sync<EvolveGoto>(
+      key( fmt::format( "evolve_goto.{}", unit_id ) ),
+      [&] { return inner_->evolve_goto( unit_id ); } );
+}
+
+EvolveTradeRoute ReplayAgent::evolve_trade_route(
+    UnitId const unit_id ) {
+  return log_.remake_sync<EvolveTradeRoute>(
+      key( fmt::format( "evolve_trade_route.{}", unit_id ) ),
+      [&] { return inner_->evolve_trade_route( unit_id ); } );
+}
+
+/****************************************************************
+** ReplayAgent Signals.
+*****************************************************************/
+#define FORWARD_SIGNAL( sig )                   \
+  SIGNAL_RESULT( sig )                          \
+  ReplayAgent::handle( signal::sig const& o ) { \
+    return inner_->handle( o );                 \
+  }
+
+wait<maybe<int>> ReplayAgent::handle(
+    signal::ChooseImmigrant const& o ) {
+  return log_.remake<maybe<int>>(
+      key( "ChooseImmigrant" ),
+      [this, &o] { return inner_->handle( o ); } );
+}
+
+FORWARD_SIGNAL( ColonyDestroyedByNatives );
+FORWARD_SIGNAL( ColonyDestroyedByStarvation );
+FORWARD_SIGNAL( ColonySignal );
+FORWARD_SIGNAL( ColonySignalTransient );
+FORWARD_SIGNAL( ForestClearedNearColony );
+FORWARD_SIGNAL( ImmigrantArrived );
+FORWARD_SIGNAL( NoSpotForShip );
+FORWARD_SIGNAL( PioneerExhaustedTools );
+FORWARD_SIGNAL( PriceChange );
+FORWARD_SIGNAL( RebelSentimentChanged );
+FORWARD_SIGNAL( RefUnitAdded );
+FORWARD_SIGNAL( ShipFinishedRepairs );
+FORWARD_SIGNAL( TaxRateWillChange );
+FORWARD_SIGNAL( TeaParty );
+FORWARD_SIGNAL( TreasureArrived );
+FORWARD_SIGNAL( TribeWipedOut );
+
+#undef FORWARD_SIGNAL
+
+/****************************************************************
+** ReplayNativeAgent
+*****************************************************************/
+ReplayNativeAgent::ReplayNativeAgent(
+    unique_ptr<INativeAgent> inner, DecisionLog& log )
+  : INativeAgent( inner->tribe_type() ),
+    inner_( std::move( inner ) ),
+    log_( log ) {
+  CHECK( inner_ != nullptr );
+}
+
+string ReplayNativeAgent::key( string_view const what ) const {
+  return fmt::format( "{}.{}", tribe_type(), what );
+}
+
+wait<> ReplayNativeAgent::message_box( string const& msg ) {
+  return inner_->message_box( msg );
+}
+
+NativeUnitId ReplayNativeAgent::select_unit(
+    set<NativeUnitId> const& units ) {
+  return log_.remake_sync<NativeUnitId>(
+      key( "select_unit" ),
+      [&] { return inner_->select_unit( units ); } );
+}
+
+NativeUnitCommand ReplayNativeAgent::command_for(
+    NativeUnitId const native_unit_id ) {
+  return log_.remake_sync<NativeUnitCommand>(
+      key( fmt::format( "command_for.{}", native_unit_id ) ),
+      [&] { return inner_->command_for( native_unit_id ); } );
+}
+
+void ReplayNativeAgent::on_attack_colony_finished(
+    CombatBraveAttackColony const& combat,
+    BraveAttackColonyEffect const& side_effect ) {
+  inner_->on_attack_colony_finished( combat, side_effect );
+}
+
+void ReplayNativeAgent::on_attack_unit_finished(
+    CombatBraveAttackEuro const& combat ) {
+  inner_->on_attack_unit_finished( combat );
+}
+
+/****************************************************************
+** ReplayGui
+*****************************************************************/
+ReplayGui::ReplayGui( IGui& inner, DecisionLog& log )
+  : inner_( inner ), log_( log ) {}
+
+wait<> ReplayGui::message_box( string const& msg ) {
+  lg.debug( "replay: skipping message box: {}", msg );
+  co_return;
+}
+
+wait<> ReplayGui::message_box( MessageBoxOptions const&,
+                               string const& msg ) {
+  lg.debug( "replay: skipping message box: {}", msg );
+  co_return;
+}
+
+void ReplayGui::transient_message_box( string const& ) {}
+
+wait<chrono::microseconds> ReplayGui::wait_for(
+    chrono::microseconds const time ) {
+  co_return time;
+}
+
+wait<> ReplayGui::ok_cancel_box_async(
+    string const title, ui::View& view,
+    co::stream<ui::e_ok_cancel>& out ) {
+  return inner_.ok_cancel_box_async( title, view, out );
+}
+
+wait<ui::e_ok_cancel> ReplayGui::ok_cancel_box(
+    string const& title, ui::View& view ) {
+  return log_.decide<ui::e_ok_cancel>(
+      "gui.ok_cancel_box", [this, &title, &view] {
+        return inner_.ok_cancel_box( title, view );
+      } );
+}
+
+wait<> ReplayGui::display_woodcut( e_woodcut const ) {
+  co_return;
+}
+
+int ReplayGui::total_windows_created() const {
+  return inner_.total_windows_created();
+}
+
+wait<maybe<string>> ReplayGui::choice(
+    ChoiceConfig const& config ) {
+  return log_.decide<maybe<string>>(
+      "gui.choice",
+      [this, &config] { return inner_.choice( config ); } );
+}
+
+wait<maybe<string>> ReplayGui::string_input(
+    StringInputConfig const& config ) {
+  return log_.decide<maybe<string>>(
+      "gui.string_input",
+      [this, &config] {
+        return inner_.string_input( config );
+      } );
+}
+
+wait<maybe<int>> ReplayGui::int_input(
+    IntInputConfig const& config ) {
+  return log_.decide<maybe<int>>(
+      "gui.int_input",
+      [this, &config] { return inner_.int_input( config ); } );
+}
+
+wait<unordered_map<int, bool>> ReplayGui::check_box_selector(
+    string const& title,
+    unordered_map<int, CheckBoxInfo> const& items ) {
+  return log_.decide<unordered_map<int, bool>>(
+      "gui.check_box_selector", [this, &title, &items] {
+        return inner_.check_box_selector( title, items );
+      } );
+}
+
+/****************************************************************
+** ReplaySession
+*****************************************************************/
+ReplaySession::ReplaySession( DecisionLog decisions,
+                              ReplayLog log, fs::path file )
+  : decisions_( std::move( decisions ) ),
+    log_( std::move( log ) ),
+    file_( std::move( file ) ) {}
+
+ReplaySession ReplaySession::recorder( fs::path file,
+                                       int const slot,
+                                       int const num_turns ) {
+  CHECK_GT( num_turns, 0 );
+  return ReplaySession(
+      DecisionLog{},
+      ReplayLog{ .slot = slot, .num_turns = num_turns },
+      std::move( file ) );
+}
+
+ReplaySession ReplaySession::replayer( ReplayLog log ) {
+  DecisionLog decisions( log.decisions );
+  return ReplaySession( std::move( decisions ), std::move( log ),
+                        /*file=*/{} );
+}
+
+rng::seed ReplaySession::start( RootState const& root,
+                                rng::seed const& seed ) {
+  switch( mode() ) {
+    case e_replay_mode::record: {
+      log_.seed             = seed;
+      log_.start_state_hash = hash_string( root );
+      lg.info( "recording {} turns with seed {}.",
+               log_.num_turns, seed );
+      return seed;
+    }
+    case e_replay_mode::replay: {
+      string const hash = hash_string( root );
+      if( hash != log_.start_state_hash )
+        lg.error(
+            "the loaded game (hash {}) is not the one that the "
+            "replay was recorded from (hash {}).",
+            hash, log_.start_state_hash );
+      lg.info( "replaying {} turns with seed {}.",
+               log_.num_turns, log_.seed );
+      return log_.seed;
+    }
+  }
+}
+
+void ReplaySession::add_phase_time(
+    string const& phase, chrono::microseconds const elapsed ) {
+  PhaseTime& time = phase_times_[phase];
+  ++time.count;
+  time.total += elapsed;
+}
+
+bool ReplaySession::turn_finished() {
+  ++turns_finished_;
+  return turns_finished_ >= log_.num_turns;
+}
+
+valid_or<string> ReplaySession::finish( RootState const& root ) {
+  string const hash = hash_string( root );
+  switch( mode() ) {
+    case e_replay_mode::record: {
+      // The game may have been exited early.
+      log_.num_turns        = turns_finished_;
+      log_.final_state_hash = hash;
+      log_.decisions        = decisions_.decisions();
+      lg.info( "writing replay with {} decisions to {}.",
+               log_.decisions.size(), file_ );
+      return save_replay_log( file_, log_ );
+    }
+    case e_replay_mode::replay: {
+      if( turns_finished_ < log_.num_turns )
+        return fmt::format(
+            "replay was stopped after {} of {} turns.",
+            turns_finished_, log_.num_turns );
+      if( decisions_.divergence().has_value() )
+        return *decisions_.divergence();
+      if( decisions_.num_replayed() <
+          ssize( log_.decisions ) )
+        return fmt::format(
+            "replay only used {} of {} decisions.",
+            decisions_.num_replayed(), log_.decisions.size() );
+      if( hash != log_.final_state_hash )
+        return fmt::format(
+            "replay ended with state hash {} but the recording "
+            "ended with {}.",
+            hash, log_.final_state_hash );
+      return valid;
+    }
+  }
+}
+
+string ReplaySession::phase_report() const {
+  string res;
+  chrono::microseconds total = {};
+  for( auto const& [phase, time] : phase_times_ ) {
+    total += time.total;
+    res += fmt::format(
+        "{:>20}: {:>6}ms over {} runs\n", phase,
+        chrono::duration_cast<chrono::milliseconds>( time.total )
+            .count(),
+        time.count );
+  }
+  res += fmt::format(
+      "{:>20}: {:>6}ms\n", "total",
+      chrono::duration_cast<chrono::milliseconds>( total )
+          .count() );
+  return res;
+}
+
+/****************************************************************
+** Public API.
+*****************************************************************/
+uint64_t root_state_hash( RootState const& root ) {
+  static cdr::converter::options const options{
+    .write_fields_with_default_value = true };
+  return base::hash_64_fnv1a( rcl::emit(
+      cdr::run_conversion_to_canonical( root, options ) ) );
+}
+
+valid_or<string> save_replay_log( fs::path const& file,
+                                  ReplayLog const& log ) {
+  ofstream out( file );
+  if( !out.good() )
+    return fmt::format( "failed to open {} for writing.", file );
+  out << rcl::to_rcl( log );
+  if( !out.good() )
+    return fmt::format( "failed to write replay to {}.", file );
+  return valid;
+}
+
+base::expect<ReplayLog> load_replay_log( fs::path const& file ) {
+  UNWRAP_RETURN( doc, rcl::parse_file( file.string() ) );
+  UNWRAP_RETURN( res,
+                 cdr::run_conversion_from_canonical<ReplayLog>(
+                     doc.top_val() ) );
+  return res;
+}
+
+void put_human_players_under_ai_control( SS& ss ) {
+  for( auto& [player_type, player] : ss.players.players ) {
+    if( !player.has_value() ) continue;
+    if( player->control != e_player_control::human ) continue;
+    lg.info( "replay: putting {} under AI control.",
+             player_type );
+    player->control = e_player_control::ai;
+  }
+}
+
+Agents create_replay_agents( ReplaySession& session,
+                             IEngine& engine, SS& ss,
+                             IMapUpdater& map_updater,
+                             Planes& planes, IGui& gui,
+                             IRand& rand ) {
+  unordered_map<e_player, unique_ptr<IAgent>> holder;
+  for( e_player const player : refl::enum_values<e_player> ) {
+    if( !ss.players.players[player].has_value() ) continue;
+    CHECK( ss.players.players[player]->control !=
+               e_player_control::human,
+           "human players must be put under AI control before "
+           "recording or replaying." );
+    holder[player] = make_unique<ReplayAgent>(
+        create_agent( engine, ss, map_updater, planes, gui, rand,
+                      player ),
+        session.decisions() );
+  }
+  return Agents( std::move( holder ) );
+}
+
+NativeAgents create_replay_native_agents( ReplaySession& session,
+                                          SS& ss, IRand& rand ) {
+  unordered_map<e_tribe, unique_ptr<INativeAgent>> holder;
+  for( e_tribe const tribe : refl::enum_values<e_tribe> )
+    holder[tribe] = make_unique<ReplayNativeAgent>(
+        create_native_agent( ss, rand, tribe ),
+        session.decisions() );
+  return NativeAgents( std::move( holder ) );
+}
+
+} // namespace rn
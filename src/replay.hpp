@@ -0,0 +1,509 @@
+/****************************************************************
+**replay.hpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Recording and replaying of turns.
+*
+*****************************************************************/
+#pragma once
+
+// rds
+#include "replay.rds.hpp"
+
+// Revolution Now
+#include "iagent.hpp"
+#include "igui.hpp"
+#include "inative-agent.hpp"
+#include "maybe.hpp"
+#include "wait.hpp"
+
+// cdr
+#include "cdr/converter.hpp"
+#include "cdr/ext-base.hpp"
+#include "cdr/ext-builtin.hpp"
+#include "cdr/ext-std.hpp"
+
+// refl
+#include "refl/cdr.hpp"
+
+// base
+#include "base/expect.hpp"
+#include "base/fs.hpp"
+#include "base/scope-exit.hpp"
+#include "base/valid.hpp"
+
+// C++ standard library
+#include <chrono>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace rn {
+
+struct Agents;
+struct IEngine;
+struct IMapUpdater;
+struct IRand;
+struct NativeAgents;
+struct Planes;
+struct RootState;
+struct SS;
+
+/****************************************************************
+** DecisionLog
+*****************************************************************/
+// Sits between the game and the things that make decisions for
+// it (agents and the gui). When recording, each decision is
+// made as usual and its result is appended to the log. There
+// are two kinds of decisions, which differ in what happens on
+// replay:
+//
+//   1. Those that come from user input (the gui), which cannot
+//      be reproduced. These go through `decide' and on replay
+//      the result is taken from the log and the gui is not con-
+//      sulted.
+//   2. Those that come from the agents. Since all players are
+//      put under AI control when recording and replaying, these
+//      can be reproduced, but the AI code draws random numbers
+//      from the same generator as the rest of the game, so if
+//      it were skipped then everything after it would see dif-
+//      ferent random numbers. These go through `remake' and on
+//      replay the agent is still asked and its result is veri-
+//      fied against the log.
+//
+// If a replay ever asks for a decision that does not match the
+// next one in the log then the replay has diverged from the re-
+// cording; that is noted and from then on all decisions are for-
+// warded as usual.
+struct DecisionLog {
+  // Starts an empty log for recording.
+  DecisionLog();
+
+  // Replays the given decisions.
+  explicit DecisionLog( std::vector<ReplayDecision> decisions );
+
+  e_replay_mode mode() const { return mode_; }
+
+  std::vector<ReplayDecision> const& decisions() const {
+    return decisions_;
+  }
+
+  // When replaying, the number of decisions taken from the log.
+  int num_replayed() const { return next_; }
+
+  // Describes the first decision at which a replay diverged.
+  maybe<std::string> const& divergence() const {
+    return divergence_;
+  }
+
+  template<typename T, typename Fn>
+  T decide_sync( std::string const& key, Fn&& fn );
+
+  template<typename T, typename Fn>
+  wait<T> decide( std::string key, Fn fn );
+
+  template<typename T, typename Fn>
+  T remake_sync( std::string const& key, Fn&& fn );
+
+  template<typename T, typename Fn>
+  wait<T> remake( std::string key, Fn fn );
+
+ private:
+  // Returns the result of the next decision if we are replaying
+  // and it matches the key.
+  maybe<cdr::value const&> peek( std::string_view key );
+
+  // Same as above but also moves on to the following decision.
+  maybe<cdr::value const&> next( std::string_view key );
+
+  void diverged( std::string_view key, std::string const& why );
+
+  // Called with the result of a decision that was remade. When
+  // recording it is recorded and when replaying it is checked
+  // against the next one in the log.
+  void remade( std::string key, cdr::value result );
+
+  // Decisions that are made while another decision is in
+  // progress (e.g. an agent that asks the gui) are not recorded
+  // since they will not be asked for on replay, or will be made
+  // again by the outer decision.
+  bool recording() const {
+    return mode_ == e_replay_mode::record && depth_ == 0;
+  }
+
+  void record( std::string key, cdr::value result );
+
+  template<typename T>
+  maybe<T> replayed( std::string_view key );
+
+  e_replay_mode mode_ = {};
+  std::vector<ReplayDecision> decisions_;
+  int next_  = 0;
+  int depth_ = 0;
+  maybe<std::string> divergence_;
+};
+
+template<typename T>
+maybe<T> DecisionLog::replayed( std::string_view const key ) {
+  // Nested in a decision that is being remade, and so these were
+  // not recorded.
+  if( depth_ > 0 ) return nothing;
+  maybe<cdr::value const&> const v = next( key );
+  if( !v.has_value() ) return nothing;
+  cdr::result<T> res =
+      cdr::run_conversion_from_canonical<T>( *v );
+  if( !res.has_value() ) {
+    diverged( key, res.error().what() );
+    return nothing;
+  }
+  return std::move( *res );
+}
+
+template<typename T, typename Fn>
+T DecisionLog::decide_sync( std::string const& key, Fn&& fn ) {
+  if( maybe<T> res = replayed<T>( key ); res.has_value() )
+    return std::move( *res );
+  if( !recording() ) return std::forward<Fn>( fn )();
+  ++depth_;
+  SCOPE_EXIT { --depth_; };
+  T res = std::forward<Fn>( fn )();
+  record( key, cdr::run_conversion_to_canonical( res ) );
+  return res;
+}
+
+template<typename T, typename Fn>
+wait<T> DecisionLog::decide( std::string const key,
+                             Fn const fn ) {
+  if( maybe<T> res = replayed<T>( key ); res.has_value() )
+    co_return std::move( *res );
+  if( !recording() ) co_return co_await fn();
+  ++depth_;
+  SCOPE_EXIT { --depth_; };
+  T res = co_await fn();
+  record( key, cdr::run_conversion_to_canonical( res ) );
+  co_return res;
+}
+
+template<typename T, typename Fn>
+T DecisionLog::remake_sync( std::string const& key, Fn&& fn ) {
+  if( depth_ > 0 ) return std::forward<Fn>( fn )();
+  ++depth_;
+  SCOPE_EXIT { --depth_; };
+  T res = std::forward<Fn>( fn )();
+  remade( key, cdr::run_conversion_to_canonical( res ) );
+  return res;
+}
+
+template<typename T, typename Fn>
+wait<T> DecisionLog::remake( std::string const key,
+                             Fn const fn ) {
+  if( depth_ > 0 ) co_return co_await fn();
+  ++depth_;
+  SCOPE_EXIT { --depth_; };
+  T res = co_await fn();
+  remade( key, cdr::run_conversion_to_canonical( res ) );
+  co_return res;
+}
+
+/****************************************************************
+** ReplayAgent
+*****************************************************************/
+// Wraps another agent and sends all of its decisions through a
+// decision log. The inner agent is asked even on replay (see De-
+// cisionLog). Things that don't return a decision are always
+// forwarded.
+struct ReplayAgent final : IAgent {
+  ReplayAgent( std::unique_ptr<IAgent> inner, DecisionLog& log );
+
+ public: // IAgent.
+  wait<> message_box( std::string const& msg ) override;
+
+  Player const& player() override;
+
+  bool human() const override;
+
+  void dump_last_message() const override;
+
+  wait<e_declare_war_on_natives> meet_tribe_ui_sequence(
+      MeetTribe const& meet_tribe, gfx::point tile ) override;
+
+  wait<> show_woodcut( e_woodcut woodcut ) override;
+
+  wait<base::heap_value<CapturableCargoItems>>
+  select_commodities_to_capture(
+      UnitId src, UnitId dst,
+      CapturableCargo const& items ) override;
+
+  wait<> notify_captured_cargo(
+      Player const& src_player, Player const& dst_player,
+      Unit const& dst_unit, Commodity const& stolen ) override;
+
+  wait<std::string> name_new_world() override;
+
+  wait<ui::e_confirm> should_king_transport_treasure(
+      std::string const& msg ) override;
+
+  wait<ui::e_confirm> should_explore_ancient_burial_mounds()
+      override;
+
+  wait<std::chrono::microseconds> wait_for(
+      std::chrono::milliseconds us ) override;
+
+  wait<> pan_tile( gfx::point tile ) override;
+
+  wait<> pan_unit( UnitId unit_id ) override;
+
+  command ask_orders( UnitId unit_id ) override;
+
+  wait<ui::e_confirm> kiss_pinky_ring(
+      std::string const& msg, ColonyId colony_id,
+      e_commodity type, int tax_increase ) override;
+
+  wait<ui::e_confirm> attack_with_partial_movement_points(
+      UnitId unit_id ) override;
+
+  wait<ui::e_confirm> should_attack_natives(
+      e_tribe tribe ) override;
+
+  wait<maybe<int>> pick_dump_cargo(
+      std::map<int /*slot*/, Commodity> const& options )
+      override;
+
+  wait<e_native_land_grab_result> should_take_native_land(
+      std::string const& msg,
+      refl::enum_map<e_native_land_grab_result,
+                     std::string> const& names,
+      refl::enum_map<e_native_land_grab_result, bool> const&
+          disabled ) override;
+
+  wait<ui::e_confirm> confirm_disband_unit(
+      UnitId unit_id ) override;
+
+  wait<ui::e_confirm> confirm_build_inland_colony() override;
+
+  wait<ui::e_confirm> confirm_build_island_colony() override;
+
+  wait<maybe<std::string>> name_colony() override;
+
+  wait<ui::e_confirm> should_make_landfall(
+      bool some_units_already_moved ) override;
+
+  wait<ui::e_confirm> should_sail_high_seas(
+      UnitId unit_id ) override;
+
+  EvolveGoto evolve_goto( UnitId unit_id ) override;
+
+  EvolveTradeRoute evolve_trade_route( UnitId unit_id ) override;
+
+ public: // ISignalHandler
+  OVERRIDE_SIGNAL( ChooseImmigrant );
+  OVERRIDE_SIGNAL( ColonyDestroyedByNatives );
+  OVERRIDE_SIGNAL( ColonyDestroyedByStarvation );
+  OVERRIDE_SIGNAL( ColonySignal );
+  OVERRIDE_SIGNAL( ColonySignalTransient );
+  OVERRIDE_SIGNAL( ForestClearedNearColony );
+  OVERRIDE_SIGNAL( ImmigrantArrived );
+  OVERRIDE_SIGNAL( NoSpotForShip );
+  OVERRIDE_SIGNAL( PioneerExhaustedTools );
+  OVERRIDE_SIGNAL( PriceChange );
+  OVERRIDE_SIGNAL( RebelSentimentChanged );
+  OVERRIDE_SIGNAL( RefUnitAdded );
+  OVERRIDE_SIGNAL( ShipFinishedRepairs );
+  OVERRIDE_SIGNAL( TaxRateWillChange );
+  OVERRIDE_SIGNAL( TeaParty );
+  OVERRIDE_SIGNAL( TreasureArrived );
+  OVERRIDE_SIGNAL( TribeWipedOut );
+
+ private:
+  std::string key( std::string_view what ) const;
+
+  std::unique_ptr<IAgent> inner_;
+  DecisionLog& log_;
+};
+
+/****************************************************************
+** ReplayNativeAgent
+*****************************************************************/
+struct ReplayNativeAgent final : INativeAgent {
+  ReplayNativeAgent( std::unique_ptr<INativeAgent> inner,
+                     DecisionLog& log );
+
+ public: // INativeAgent.
+  wait<> message_box( std::string const& msg ) override;
+
+  NativeUnitId select_unit(
+      std::set<NativeUnitId> const& units ) override;
+
+  NativeUnitCommand command_for(
+      NativeUnitId native_unit_id ) override;
+
+  void on_attack_colony_finished(
+      CombatBraveAttackColony const& combat,
+      BraveAttackColonyEffect const& side_effect ) override;
+
+  void on_attack_unit_finished(
+      CombatBraveAttackEuro const& combat ) override;
+
+ private:
+  std::string key( std::string_view what ) const;
+
+  std::unique_ptr<INativeAgent> inner_;
+  DecisionLog& log_;
+};
+
+/****************************************************************
+** ReplayGui
+*****************************************************************/
+// Sends the answers to all user input requests through a deci-
+// sion log. Things that only display something (message boxes,
+// woodcuts, waits) are dropped, both when recording and when re-
+// playing, so that neither one needs anyone to click through
+// them. They don't change the game state, so this does not af-
+// fect the replay.
+//
+// Note that in the ok/cancel boxes only the button that was
+// pressed is recorded and not any changes that the user made to
+// the view itself.
+struct ReplayGui final : IGui {
+  ReplayGui( IGui& inner, DecisionLog& log );
+
+ public: // IGui.
+  wait<> message_box( std::string const& msg ) override;
+
+  wait<> message_box( MessageBoxOptions const& options,
+                      std::string const& msg ) override;
+
+  void transient_message_box( std::string const& msg ) override;
+
+  wait<std::chrono::microseconds> wait_for(
+      std::chrono::microseconds time ) override;
+
+  wait<> ok_cancel_box_async(
+      std::string const title, ui::View& view,
+      co::stream<ui::e_ok_cancel>& out ) override;
+
+  wait<ui::e_ok_cancel> ok_cancel_box(
+      std::string const& title, ui::View& view ) override;
+
+  wait<> display_woodcut( e_woodcut cut ) override;
+
+  int total_windows_created() const override;
+
+ protected: // IGui.
+  wait<maybe<std::string>> choice(
+      ChoiceConfig const& config ) override;
+
+  wait<maybe<std::string>> string_input(
+      StringInputConfig const& config ) override;
+
+  wait<maybe<int>> int_input(
+      IntInputConfig const& config ) override;
+
+  wait<std::unordered_map<int, bool>> check_box_selector(
+      std::string const& title,
+      std::unordered_map<int, CheckBoxInfo> const& items )
+      override;
+
+ private:
+  IGui& inner_;
+  DecisionLog& log_;
+};
+
+/****************************************************************
+** ReplaySession
+*****************************************************************/
+// Holds everything needed to either record a number of turns
+// starting from a save or to replay such a recording. Replays
+// use the same seed and decisions as the recording, so they
+// re-execute the same turns without asking for any input, and
+// thus can be used to benchmark the turn processing.
+struct ReplaySession {
+  static ReplaySession recorder( fs::path file, int slot,
+                                 int num_turns );
+
+  static ReplaySession replayer( ReplayLog log );
+
+  e_replay_mode mode() const { return decisions_.mode(); }
+
+  ReplayLog const& log() const { return log_; }
+
+  DecisionLog& decisions() { return decisions_; }
+
+  // Called with the state just after the game has been loaded
+  // and with the seed that gameplay would otherwise use. Returns
+  // the seed that it should use.
+  rng::seed start( RootState const& root,
+                   rng::seed const& seed );
+
+  void add_phase_time( std::string const& phase,
+                       std::chrono::microseconds elapsed );
+
+  // Called after each full turn. Returns true when the requested
+  // number of turns have been run.
+  bool turn_finished();
+
+  // When recording this writes the log to its file. When re-
+  // playing this verifies that the replay ended up with the same
+  // state as the recording.
+  base::valid_or<std::string> finish( RootState const& root );
+
+  // Timings of the turn phases, one per line.
+  std::string phase_report() const;
+
+ private:
+  ReplaySession( DecisionLog decisions, ReplayLog log,
+                 fs::path file );
+
+  struct PhaseTime {
+    int count                       = 0;
+    std::chrono::microseconds total = {};
+  };
+
+  DecisionLog decisions_;
+  ReplayLog log_;
+  // Where the log is written when recording.
+  fs::path file_;
+  int turns_finished_ = 0;
+  std::map<std::string, PhaseTime> phase_times_;
+};
+
+/****************************************************************
+** Public API.
+*****************************************************************/
+// Hash of the canonical representation of the state. Two states
+// that compare equal have the same hash.
+uint64_t root_state_hash( RootState const& root );
+
+base::valid_or<std::string> save_replay_log(
+    fs::path const& file, ReplayLog const& log );
+
+base::expect<ReplayLog> load_replay_log( fs::path const& file );
+
+// Both recording and replaying are unattended, so any human
+// players are put under AI control before the agents are cre-
+// ated. This must be done in both cases so that the recording
+// and the replay start from the same state. Human input that
+// does not go through the agents or the gui (e.g. land view or-
+// ders or harbor view edits) is never recorded, so it could not
+// otherwise be reproduced.
+void put_human_players_under_ai_control( SS& ss );
+
+// The agents are created as usual (thus after the above has
+// been called they will all be AI agents) and are wrapped so
+// that their decisions go through the session's log.
+Agents create_replay_agents( ReplaySession& session,
+                             IEngine& engine, SS& ss,
+                             IMapUpdater& map_updater,
+                             Planes& planes, IGui& gui,
+                             IRand& rand );
+
+NativeAgents create_replay_native_agents( ReplaySession& session,
+                                          SS& ss, IRand& rand );
+
+} // namespace rn
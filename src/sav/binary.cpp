@@ -26,7 +26,7 @@ namespace sav {
 
 namespace {
 
-using ::base::FileBinaryIO;
+using ::base::BufferBinaryIO;
 using ::base::IBinaryIO;
 using ::base::ScopedTimer;
 using ::base::valid;
@@ -261,8 +261,7 @@ valid_or<string> write( IBinaryIO& b, ColonySAV const& out ) {
 valid_or<string> load_sav_file( string const& path,
                                 ColonySAV& out ) {
   ScopedTimer timer( "load SAV binary" );
-  UNWRAP_RETURN(
-      file, FileBinaryIO::open_for_rw_fail_on_nonexist( path ) );
+  UNWRAP_RETURN( file, BufferBinaryIO::read_file( path ) );
   if( auto res = read( file, out ); !res )
     return fmt::format(
         "failed while reading save file data at offset {}: {}",
@@ -279,20 +278,18 @@ valid_or<string> load_sav_file( string const& path,
 valid_or<string> save_sav_file( string const& path,
                                 ColonySAV const& in ) {
   ScopedTimer timer( "save SAV binary" );
-  UNWRAP_RETURN(
-      file, FileBinaryIO::open_for_rw_and_truncate( path ) );
+  BufferBinaryIO file;
   if( !write( file, in ) )
     return fmt::format(
         "failed to write save data to buffer at offset {}.",
         file.pos() );
-  return valid;
+  return file.write_file( path );
 }
 
 valid_or<string> load_map_file( string const& path,
                                 MapFile& out ) {
   ScopedTimer timer( "load MP file" );
-  UNWRAP_RETURN(
-      file, FileBinaryIO::open_for_rw_fail_on_nonexist( path ) );
+  UNWRAP_RETURN( file, BufferBinaryIO::read_file( path ) );
   if( auto res = read( file, out ); !res )
     return fmt::format(
         "failed while reading MP file data at offset {}: {}",
@@ -309,13 +306,12 @@ valid_or<string> load_map_file( string const& path,
 valid_or<string> save_map_file( string const& path,
                                 MapFile const& in ) {
   ScopedTimer timer( "save MP file" );
-  UNWRAP_RETURN(
-      file, FileBinaryIO::open_for_rw_and_truncate( path ) );
+  BufferBinaryIO file;
   if( !write( file, in ) )
     return fmt::format(
         "failed to write MP data to buffer at offset {}.",
         file.pos() );
-  return valid;
+  return file.write_file( path );
 }
 
 } // namespace sav
@@ -17,6 +17,10 @@
 // base
 #include "base/binary-data.hpp"
 
+// C++ standard library
+#include <array>
+#include <span>
+
 using namespace std;
 
 namespace sav {
@@ -36,28 +40,31 @@ void bits_base::to_string( std::string& out ) const {
   }
 }
 
+// These transfer all of the bytes in one call since there are
+// many of these in a save file.
 bool bits_base::read_binary( base::IBinaryIO& b ) {
   CHECK( n_bits % 8 == 0 );
-  int const nbytes = n_bits / 8;
-  n                = 0;
-  for( int i = 0; i < nbytes; ++i ) {
-    uint8_t byte = 0;
-    if( !b.read( byte ) ) return false;
-    n |= ( uint64_t{ byte } << ( i * 8 ) );
-  }
+  int const nbytes        = n_bits / 8;
+  array<uint8_t, 8> bytes = {};
+  if( !b.read_bytes( span( bytes ).first( nbytes ) ) )
+    return false;
+  n = 0;
+  for( int i = 0; i < nbytes; ++i )
+    n |= ( uint64_t{ bytes[i] } << ( i * 8 ) );
   return true;
 }
 
 bool bits_base::write_binary( base::IBinaryIO& b ) const {
   CHECK( n_bits % 8 == 0 );
-  int const nbytes = n_bits / 8;
-  uint64_t m       = n;
+  int const nbytes        = n_bits / 8;
+  array<uint8_t, 8> bytes = {};
+  uint64_t m              = n;
   for( int i = 0; i < nbytes; ++i ) {
-    uint8_t const byte = m & 0xff;
-    if( !b.write( byte ) ) return false;
+    bytes[i] = m & 0xff;
     m >>= 8;
   }
-  return true;
+  return b.write_bytes(
+      span<uint8_t const>( bytes ).first( nbytes ) );
 }
 
 cdr::value bits_base::to_canonical( cdr::converter&,
@@ -210,8 +210,14 @@ expect<SlotCopiedPaths> copy_slot_to_slot(
         "failed to locate save file {} for copying to {}.",
         src_path, dst_path );
 
+  // Copy to a temporary file first so that the destination slot
+  // is replaced atomically.
+  fs::path tmp_path = dst_path;
+  tmp_path += ".tmp";
   GOOD_OR_RETURN( base::copy_file_overwriting_destination(
-      src_path, dst_path ) );
+      src_path, tmp_path ) );
+  GOOD_OR_RETURN( base::rename_file_overwriting_destination(
+      tmp_path, dst_path ) );
 
   return SlotCopiedPaths{ .src = src_path, .dst = dst_path };
 }
@@ -42,6 +42,24 @@ namespace {
 
 using ::gfx::point;
 
+// Note this uses the per-tile summaries maintained by the state
+// classes, which is much faster than looking the units up.
+VisibleSociety society_from_units( SSConst const& ss,
+                                   point const tile ) {
+  UnitsOnTile const& on_tile = ss.units.on_tile( tile );
+  if( on_tile.count == 0 ) return VisibleSociety::empty{};
+  switch( on_tile.kind ) {
+    case e_unit_kind::euro:
+      return VisibleSociety::society{
+        .value = Society::european{ .player = on_tile.player } };
+    case e_unit_kind::native:
+      return VisibleSociety::society{
+        .value = Society::native{
+          .tribe = ss.natives.tribe_type_for(
+              on_tile.dwelling_id ) } };
+  }
+}
+
 VisibleSociety society_on_square_impl( SSConst const& ss,
                                        IVisibility const& viz,
                                        point const tile ) {
@@ -72,28 +90,7 @@ VisibleSociety society_on_square_impl( SSConst const& ss,
       break;
   }
 
-  // Check units.
-  auto& units = ss.units;
-  unordered_set<GenericUnitId> const& on_coord =
-      units.from_coord( tile );
-  if( on_coord.empty() ) return VisibleSociety::empty{};
-  GenericUnitId const id = *on_coord.begin();
-
-  switch( units.unit_kind( id ) ) {
-    case e_unit_kind::euro: {
-      e_player const player =
-          units.unit_for( units.check_euro_unit( id ) )
-              .player_type();
-      return VisibleSociety::society{
-        .value = Society::european{ .player = player } };
-    }
-    case e_unit_kind::native: {
-      e_tribe const tribe = tribe_type_for_unit(
-          ss, units.unit_for( units.check_native_unit( id ) ) );
-      return VisibleSociety::society{
-        .value = Society::native{ .tribe = tribe } };
-    }
-  }
+  return society_from_units( ss, tile );
 }
 
 } // namespace
@@ -103,8 +100,20 @@ VisibleSociety society_on_square_impl( SSConst const& ss,
 *****************************************************************/
 maybe<Society> society_on_real_square( SSConst const& ss,
                                        point const tile ) {
-  SWITCH( society_on_square_impl( ss, VisibilityEntire( ss ),
-                                  tile ) ) {
+  // This is called very frequently (e.g. by the AI for each
+  // square around each unit), so it avoids constructing a visi-
+  // bility object and goes straight to the per-tile indices.
+  if( auto const colony_id =
+          ss.colonies.maybe_from_coord( tile );
+      colony_id.has_value() )
+    return Society::european{
+      .player = ss.colonies.colony_for( *colony_id ).player };
+  if( auto const dwelling_id =
+          ss.natives.maybe_dwelling_from_coord( tile );
+      dwelling_id.has_value() )
+    return Society::native{
+      .tribe = ss.natives.tribe_type_for( *dwelling_id ) };
+  SWITCH( society_from_units( ss, tile ) ) {
     CASE( hidden ) { SHOULD_NOT_BE_HERE; }
     CASE( empty ) { return nothing; }
     CASE( society ) { return society.value; }
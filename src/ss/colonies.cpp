@@ -117,8 +117,8 @@ base::valid_or<std::string> ColoniesState::validate() const {
 
     // Colony location matches coord.
     Coord const& coord = colony.location;
-    base::maybe<ColonyId> actual_colony_id =
-        base::lookup( colony_from_coord_, coord );
+    ColonyId const actual_colony_id =
+        colony_from_coord_[coord.to_gfx()];
     REFL_VALIDATE(
         actual_colony_id == colony_id,
         "Inconsistent colony map coordinate ({}) for colony {}.",
@@ -140,9 +140,11 @@ void ColoniesState::validate_or_die() const {
 
 ColoniesState::ColoniesState( wrapped::ColoniesState&& o )
   : o_( std::move( o ) ) {
-  // Populate colony_from_coord_.
-  for( auto const& [id, colony] : o_.colonies )
-    colony_from_coord_[colony.location] = id;
+  // Populate colony_from_coord_ and colony_buckets_.
+  for( auto const& [id, colony] : o_.colonies ) {
+    colony_from_coord_.mut( colony.location.to_gfx() ) = id;
+    colony_buckets_.add( colony.location.to_gfx(), id );
+  }
 }
 
 ColoniesState::ColoniesState()
@@ -208,8 +210,11 @@ ColonyId ColoniesState::add_colony( Colony&& colony ) {
          "colony ID must be zero when creating colony." );
   ColonyId const id = next_colony_id();
   colony.id         = id;
-  CHECK( !colony_from_coord_.contains( colony.location ) );
-  colony_from_coord_[colony.location] = id;
+  ColonyId& on_tile =
+      colony_from_coord_.mut( colony.location.to_gfx() );
+  CHECK( on_tile == ColonyId{ 0 } );
+  on_tile = id;
+  colony_buckets_.add( colony.location.to_gfx(), id );
   // Must be last to avoid use-after-move.
   CHECK( !o_.colonies.contains( id ) );
   o_.colonies[id] = std::move( colony );
@@ -218,8 +223,9 @@ ColonyId ColoniesState::add_colony( Colony&& colony ) {
 
 void ColoniesState::destroy_colony( ColonyId id ) {
   Colony& colony = colony_for( id );
-  CHECK( colony_from_coord_.contains( colony.location ) );
-  colony_from_coord_.erase( colony.location );
+  CHECK( colony_from_coord_[colony.location.to_gfx()] == id );
+  colony_from_coord_.reset( colony.location.to_gfx() );
+  colony_buckets_.remove( colony.location.to_gfx(), id );
   // Should be last so above reference doesn't dangle.
   o_.colonies.erase( id );
 }
@@ -238,12 +244,24 @@ base::maybe<ColonyId> ColoniesState::last_colony_id() const {
 
 base::maybe<ColonyId> ColoniesState::maybe_from_coord(
     Coord const& coord ) const {
-  return base::lookup( colony_from_coord_, coord );
+  return maybe_from_coord( coord.to_gfx() );
 }
 
 base::maybe<ColonyId> ColoniesState::maybe_from_coord(
     gfx::point const tile ) const {
-  return maybe_from_coord( Coord::from_gfx( tile ) );
+  ColonyId const id = colony_from_coord_[tile];
+  if( id == ColonyId{ 0 } ) return base::nothing;
+  return id;
+}
+
+vector<ColonyId> ColoniesState::colonies_within(
+    gfx::point const tile, double const max_distance ) const {
+  return colony_buckets_.within( tile, max_distance );
+}
+
+vector<ColonyId> ColoniesState::closest_colonies(
+    gfx::point const tile, int const count ) const {
+  return colony_buckets_.nearest( tile, count );
 }
 
 ColonyId ColoniesState::from_coord( Coord const& coord ) const {
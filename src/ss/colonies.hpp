@@ -13,6 +13,10 @@
 // Rds
 #include "ss/colonies.rds.hpp"
 
+// ss
+#include "ss/tile-buckets.hpp"
+#include "ss/tile-grid.hpp"
+
 // luapp
 #include "luapp/ext-usertype.hpp"
 
@@ -68,6 +72,16 @@ struct ColoniesState {
   base::maybe<ColonyId> maybe_from_name(
       std::string_view name ) const;
 
+  // Colonies within the given pythagorean distance of the tile
+  // (inclusive), closest first, with ties broken by id.
+  [[nodiscard]] std::vector<ColonyId> colonies_within(
+      gfx::point tile, double max_distance ) const;
+
+  // The (up to) `count` colonies closest to the tile, closest
+  // first, with ties broken by id.
+  [[nodiscard]] std::vector<ColonyId> closest_colonies(
+      gfx::point tile, int count ) const;
+
   [[nodiscard]] bool exists( ColonyId id ) const;
 
   // The id of this colony must be zero (i.e., you can't select
@@ -94,7 +108,10 @@ struct ColoniesState {
   wrapped::ColoniesState o_;
 
   // ----- Non-serializable (transient) state.
-  std::unordered_map<Coord, ColonyId> colony_from_coord_;
+  // Holds zero for tiles without a colony. This only holds the
+  // id and not e.g. the player (see below).
+  TileGrid<ColonyId> colony_from_coord_;
+  TileBuckets<ColonyId> colony_buckets_;
   // NOTE: be careful when adding new caches here; we don't want
   // to cache something that can be changed directly on the
   // colony object, such as the name, otherwise it could become
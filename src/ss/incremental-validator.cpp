@@ -0,0 +1,240 @@
+/****************************************************************
+**incremental-validator.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-19.
+*
+* Description: Validates only the parts of the game state that
+*              have changed since the last validation.
+*
+*****************************************************************/
+#include "incremental-validator.hpp"
+
+// Revolution Now
+#include "core-config.hpp"
+
+// ss
+#include "ss/colonies.hpp"
+#include "ss/natives.hpp"
+#include "ss/root.hpp"
+#include "ss/units.hpp"
+
+// refl
+#include "refl/traverse.hpp"
+#include "refl/validate.hpp"
+
+// traverse
+#include "traverse/ext-base.hpp"
+#include "traverse/ext-std.hpp"
+#include "traverse/ext.hpp"
+
+// base
+#include "base/meta.hpp"
+#include "base/to-str-ext-std.hpp"
+
+// C++ standard library
+#include <unordered_map>
+
+using namespace std;
+
+namespace rn {
+
+namespace {
+
+using ::base::valid;
+using ::base::valid_or;
+
+template<typename T>
+struct is_unordered_map : false_type {};
+
+template<typename K, typename V>
+struct is_unordered_map<unordered_map<K, V>> : true_type {};
+
+// The paths are passed around as functions so that they only get
+// built when there is a failure to report.
+template<typename T>
+valid_or<string> validate_self( T const& o, auto const& path ) {
+  if constexpr( refl::ValidatableStruct<T> ) {
+    if( auto const res = o.validate(); !res.valid() )
+      return format( "{}: error: {}", path(), res.error() );
+  }
+  return valid;
+}
+
+// Validates the object (and everything under it) as a whole.
+template<typename T>
+valid_or<string> validate_leaf( T const& o, auto const& path ) {
+  return refl::validate_recursive( o, path() );
+}
+
+// Validates whatever parts of `curr` differ from `prev` and up-
+// dates `prev` to match as it goes. Only the leaves get com-
+// pared so that nothing is compared more than once; `changed` is
+// set if anything differed, which is how structs know whether
+// they need to validate themselves.
+template<typename T>
+valid_or<string> validate_changed( T const& curr, T& prev,
+                                   auto const& path,
+                                   bool& changed ) {
+  if constexpr( refl::ReflectedStruct<T> ) {
+    using Tr = refl::traits<T>;
+    static constexpr size_t kNumFields =
+        tuple_size_v<decltype( Tr::fields )>;
+    valid_or<string> res = valid;
+    bool fields_changed  = false;
+    // Children first, in the same order as validate_recursive.
+    FOR_CONSTEXPR_IDX( Idx, kNumFields ) {
+      if( !res.valid() ) return;
+      auto const& desc    = get<Idx>( Tr::fields );
+      auto const sub_path = [&] {
+        return format( "{}.{}", path(), desc.name );
+      };
+      res = validate_changed( curr.*desc.accessor,
+                              prev.*desc.accessor, sub_path,
+                              fields_changed );
+    };
+    GOOD_OR_RETURN( res );
+    if( !fields_changed ) return valid;
+    changed = true;
+    return validate_self( curr, path );
+  } else if constexpr( is_unordered_map<T>::value ) {
+    auto const erased = erase_if( prev, [&]( auto const& p ) {
+      return !curr.contains( p.first );
+    } );
+    if( erased > 0 ) changed = true;
+    for( auto const& [k, v] : curr ) {
+      auto const sub_path = [&] {
+        return format( "{}[{}]", path(), base::to_str( k ) );
+      };
+      if( auto const it = prev.find( k ); it != prev.end() ) {
+        GOOD_OR_RETURN( validate_changed( v, it->second,
+                                          sub_path, changed ) );
+        continue;
+      }
+      changed = true;
+      GOOD_OR_RETURN( validate_leaf( v, sub_path ) );
+      prev.emplace( k, v );
+    }
+    return valid;
+  } else {
+    if( curr == prev ) return valid;
+    changed = true;
+    GOOD_OR_RETURN( validate_leaf( curr, path ) );
+    prev = curr;
+    return valid;
+  }
+}
+
+// For the top-level fields of the root state. The ones that are
+// wrapper types are held in the snapshot as their wrapped types
+// since they cannot be modified piecemeal.
+template<typename T, typename S>
+valid_or<string> validate_group( T const& curr, S& prev,
+                                 string_view const name ) {
+  auto const path = [&] { return format( "root.{}", name ); };
+  bool changed    = false;
+  if constexpr( refl::WrapsReflected<T> ) {
+    GOOD_OR_RETURN(
+        validate_changed( curr.refl(), prev, path, changed ) );
+    if( !changed ) return valid;
+    return validate_self( curr, path );
+  } else {
+    return validate_changed( curr, prev, path, changed );
+  }
+}
+
+} // namespace
+
+/****************************************************************
+** IncrementalValidator::Snapshot
+*****************************************************************/
+struct IncrementalValidator::Snapshot {
+  FormatVersion version;
+  MetaState meta;
+  SettingsState settings;
+  EventsState events;
+  wrapped::UnitsState units;
+  PlayersState players;
+  TurnState turn;
+  wrapped::ColoniesState colonies;
+  wrapped::NativesState natives;
+  LandViewState land_view;
+  MapState map;
+  TradeRouteState trade_routes;
+};
+
+// If this fails then a field has been added to the root state
+// and it needs to be added to the snapshot and validated below.
+static_assert(
+    tuple_size_v<decltype( refl::traits<RootState>::fields )> ==
+    13 );
+
+/****************************************************************
+** IncrementalValidator
+*****************************************************************/
+IncrementalValidator::IncrementalValidator()  = default;
+IncrementalValidator::~IncrementalValidator() = default;
+
+void IncrementalValidator::reset() { snapshot_ = nullptr; }
+
+valid_or<string> IncrementalValidator::validate(
+    RootState const& root ) {
+  ++passes_;
+  if( DEBUG_RELEASE( true, false ) &&
+      passes_ % kDebugFullPassInterval == 0 )
+    reset();
+
+  if( snapshot_ == nullptr ) {
+    GOOD_OR_RETURN( validate_recursive_non_terrain( root ) );
+    snapshot_ = make_unique<Snapshot>( Snapshot{
+      .version      = root.version,
+      .meta         = root.meta,
+      .settings     = root.settings,
+      .events       = root.events,
+      .units        = root.units.refl(),
+      .players      = root.players,
+      .turn         = root.turn,
+      .colonies     = root.colonies.refl(),
+      .natives      = root.natives.refl(),
+      .land_view    = root.land_view,
+      .map          = root.map,
+      .trade_routes = root.trade_routes } );
+    return valid;
+  }
+
+  Snapshot& prev = *snapshot_;
+  valid_or<string> const res = [&]() -> valid_or<string> {
+    GOOD_OR_RETURN( validate_group( root.version, prev.version,
+                                    "version" ) );
+    GOOD_OR_RETURN(
+        validate_group( root.meta, prev.meta, "meta" ) );
+    GOOD_OR_RETURN( validate_group( root.settings, prev.settings,
+                                    "settings" ) );
+    GOOD_OR_RETURN(
+        validate_group( root.events, prev.events, "events" ) );
+    GOOD_OR_RETURN(
+        validate_group( root.units, prev.units, "units" ) );
+    GOOD_OR_RETURN( validate_group( root.players, prev.players,
+                                    "players" ) );
+    GOOD_OR_RETURN(
+        validate_group( root.turn, prev.turn, "turn" ) );
+    GOOD_OR_RETURN( validate_group( root.colonies, prev.colonies,
+                                    "colonies" ) );
+    GOOD_OR_RETURN( validate_group( root.natives, prev.natives,
+                                    "natives" ) );
+    GOOD_OR_RETURN( validate_group(
+        root.land_view, prev.land_view, "land_view" ) );
+    GOOD_OR_RETURN(
+        validate_group( root.map, prev.map, "map" ) );
+    GOOD_OR_RETURN( validate_group(
+        root.trade_routes, prev.trade_routes, "trade_routes" ) );
+    return valid;
+  }();
+  // The snapshot may have been partially updated, so it can no
+  // longer be trusted to reflect what has been validated.
+  if( !res.valid() ) reset();
+  return res;
+}
+
+} // namespace rn
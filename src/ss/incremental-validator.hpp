@@ -0,0 +1,68 @@
+/****************************************************************
+**incremental-validator.hpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-19.
+*
+* Description: Validates only the parts of the game state that
+*              have changed since the last validation.
+*
+*****************************************************************/
+#pragma once
+
+// base
+#include "base/valid.hpp"
+
+// C++ standard library
+#include <memory>
+#include <string>
+
+namespace rn {
+
+/****************************************************************
+** Fwd. Decls.
+*****************************************************************/
+struct RootState;
+
+/****************************************************************
+** IncrementalValidator
+*****************************************************************/
+// Does the same validation as validate_recursive_non_terrain but
+// keeps a copy of the (non-terrain) state that it last validated
+// so that on subsequent passes it can skip anything that has not
+// changed since then. Changes are found by comparing against the
+// copy, so the game state can be mutated in any way in between
+// passes. Within a top-level group, entities in maps (units,
+// colonies, dwellings, etc.) are compared and validated individ-
+// ually. The top-level group's own validation method is re-run
+// whenever anything in the group has changed, since those gener-
+// ally check relationships between the entities.
+//
+// Note that the order in which map entries are visited is not
+// specified, so if there are multiple failures then the one re-
+// ported may differ from that of the full validation.
+struct IncrementalValidator {
+  IncrementalValidator();
+  ~IncrementalValidator();
+
+  base::valid_or<std::string> validate( RootState const& root );
+
+  // The next pass will be a full one.
+  void reset();
+
+ private:
+  // In debug builds, every Nth pass will be a full pass as a
+  // safety net in case the change detection ever misses some-
+  // thing, e.g. a type whose equality operator does not compare
+  // all of its fields.
+  static int constexpr kDebugFullPassInterval = 10;
+
+  struct Snapshot;
+
+  // Will be null when the next pass needs to be a full one.
+  std::unique_ptr<Snapshot> snapshot_;
+  int passes_ = 0;
+};
+
+} // namespace rn
@@ -115,8 +115,8 @@ base::valid_or<std::string> NativesState::validate() const {
   // Dwelling location matches coord.
   for( auto const& [dwelling_id, state] : o_.dwellings ) {
     Coord const& coord = state.ownership.location;
-    base::maybe<DwellingId> actual_dwelling_id =
-        base::lookup( dwelling_from_coord_, coord );
+    DwellingId const actual_dwelling_id =
+        dwelling_from_coord_[coord.to_gfx()];
     REFL_VALIDATE( actual_dwelling_id == dwelling_id,
                    "Inconsistent dwelling map coordinate ({}) "
                    "for dwelling {}.",
@@ -139,9 +139,12 @@ void NativesState::validate_or_die() const {
 
 NativesState::NativesState( wrapped::NativesState&& o )
   : o_( std::move( o ) ) {
-  // Populate dwelling_from_coord_.
-  for( auto const& [id, state] : o_.dwellings )
-    dwelling_from_coord_[state.ownership.location] = id;
+  // Populate dwelling_from_coord_ and dwelling_buckets_.
+  for( auto const& [id, state] : o_.dwellings ) {
+    gfx::point const tile = state.ownership.location.to_gfx();
+    dwelling_from_coord_.mut( tile ) = id;
+    dwelling_buckets_.add( tile, id );
+  }
 
   // Populate dwellings_from_tribe_;
   for( auto const& [id, state] : o_.dwellings ) {
@@ -263,8 +266,11 @@ DwellingId NativesState::add_dwelling( e_tribe tribe,
          "dwelling ID must be zero when creating dwelling." );
   DwellingId const id = next_dwelling_id();
   dwelling.id         = id;
-  CHECK( !dwelling_from_coord_.contains( location ) );
-  dwelling_from_coord_[location] = id;
+  DwellingId& on_tile =
+      dwelling_from_coord_.mut( location.to_gfx() );
+  CHECK( on_tile == DwellingId{ 0 } );
+  on_tile = id;
+  dwelling_buckets_.add( location.to_gfx(), id );
   CHECK( dwellings_from_tribe_.contains( tribe ) );
   CHECK( !dwellings_from_tribe_[tribe].contains( id ) );
   dwellings_from_tribe_[tribe].insert( id );
@@ -280,8 +286,10 @@ DwellingId NativesState::add_dwelling( e_tribe tribe,
 void NativesState::destroy_dwelling( DwellingId id ) {
   DwellingState& state         = state_for( id );
   DwellingOwnership& ownership = state.ownership;
-  CHECK( dwelling_from_coord_.contains( ownership.location ) );
-  dwelling_from_coord_.erase( ownership.location );
+  CHECK( dwelling_from_coord_[ownership.location.to_gfx()] ==
+         id );
+  dwelling_from_coord_.reset( ownership.location.to_gfx() );
+  dwelling_buckets_.remove( ownership.location.to_gfx(), id );
   Dwelling& dwelling  = dwelling_for( id );
   e_tribe const tribe = tribe_for( dwelling.id ).type;
   CHECK( tribe_exists( tribe ), "the {} tribe does not exist.",
@@ -311,7 +319,9 @@ DwellingId NativesState::last_dwelling_id() const {
 
 base::maybe<DwellingId> NativesState::maybe_dwelling_from_coord(
     point const tile ) const {
-  return base::lookup( dwelling_from_coord_, tile );
+  DwellingId const id = dwelling_from_coord_[tile];
+  if( id == DwellingId{ 0 } ) return base::nothing;
+  return id;
 }
 
 DwellingId NativesState::dwelling_from_coord(
@@ -320,6 +330,16 @@ DwellingId NativesState::dwelling_from_coord(
   return id;
 }
 
+vector<DwellingId> NativesState::dwellings_within(
+    point const tile, double const max_distance ) const {
+  return dwelling_buckets_.within( tile, max_distance );
+}
+
+vector<DwellingId> NativesState::closest_dwellings(
+    point const tile, int const count ) const {
+  return dwelling_buckets_.nearest( tile, count );
+}
+
 bool NativesState::dwelling_exists( DwellingId id ) const {
   return o_.dwellings.contains( id );
 }
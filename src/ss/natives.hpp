@@ -14,6 +14,10 @@
 // Rds
 #include "ss/natives.rds.hpp"
 
+// ss
+#include "ss/tile-buckets.hpp"
+#include "ss/tile-grid.hpp"
+
 // luapp
 #include "luapp/ext-usertype.hpp"
 
@@ -86,6 +90,16 @@ struct NativesState {
       gfx::point tile ) const;
   DwellingId dwelling_from_coord( Coord const& c ) const;
 
+  // Dwellings within the given pythagorean distance of the tile
+  // (inclusive), closest first, with ties broken by id.
+  std::vector<DwellingId> dwellings_within(
+      gfx::point tile, double max_distance ) const;
+
+  // The (up to) `count` dwellings closest to the tile, closest
+  // first, with ties broken by id.
+  std::vector<DwellingId> closest_dwellings( gfx::point tile,
+                                             int count ) const;
+
   bool dwelling_exists( DwellingId id ) const;
 
   // The id of this dwelling must be zero (i.e., you can't select
@@ -165,7 +179,9 @@ struct NativesState {
   wrapped::NativesState o_;
 
   // ----- Non-serializable (transient) state.
-  std::unordered_map<Coord, DwellingId> dwelling_from_coord_;
+  // Holds zero for tiles without a dwelling.
+  TileGrid<DwellingId> dwelling_from_coord_;
+  TileBuckets<DwellingId> dwelling_buckets_;
 
   std::unordered_map<e_tribe, std::unordered_set<DwellingId>>
       dwellings_from_tribe_;
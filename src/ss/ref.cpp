@@ -11,6 +11,7 @@
 #include "ref.hpp"
 
 // ss
+#include "incremental-validator.hpp"
 #include "root.hpp"
 
 // refl
@@ -37,6 +38,7 @@ using ::base::valid_or;
 *****************************************************************/
 struct SS::Impl {
   RootState top;
+  IncrementalValidator validator;
 };
 
 /****************************************************************
@@ -70,6 +72,11 @@ SS::SS()
       config_options.default_values;
 }
 
+valid_or<string> SS::validate_changed_game_state() {
+  ScopedTimer const timer( "incremental game state validation" );
+  return impl_->validator.validate( root );
+}
+
 void to_str( SS const& o, string& out, base::tag<SS> ) {
   out += "SS@";
   out += fmt::format( "{}", static_cast<void const*>( &o ) );
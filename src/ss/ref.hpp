@@ -95,6 +95,11 @@ struct SS {
     return as_const;
   }
 
+  // Does the same validation as validate_non_terrain_game_state
+  // but only re-validates what has changed since the last time
+  // that this was called, so it is cheap enough to run often.
+  base::valid_or<std::string> validate_changed_game_state();
+
  private:
   struct Impl;
   std::unique_ptr<Impl> impl_;
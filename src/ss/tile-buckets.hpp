@@ -0,0 +1,186 @@
+/****************************************************************
+**tile-buckets.hpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Spatial index of things that sit on map tiles.
+*
+*****************************************************************/
+#pragma once
+
+// ss
+#include "ss/tile-grid.hpp"
+
+// gfx
+#include "gfx/cartesian.hpp"
+
+// base
+#include "base/error.hpp"
+
+// C++ standard library
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace rn {
+
+/****************************************************************
+** TileBuckets
+*****************************************************************/
+// Indexes ids of things on the map (such as colonies) by their
+// tiles, grouping them into square buckets of tiles, so that the
+// things near a tile can be found by looking only at the buckets
+// near that tile instead of at every thing on the map.
+//
+// Query results are ordered by pythagorean distance and then by
+// id, so that they are deterministic.
+template<typename Id>
+struct TileBuckets {
+  static int constexpr kBucketSize = 8;
+
+  void add( gfx::point const tile, Id const id ) {
+    Bucket& bucket = buckets_.mut( bucket_for( tile ) );
+    // Keep the buckets sorted by id so that the contents of the
+    // index don't depend on the order that things were added.
+    auto const it = std::ranges::lower_bound( bucket, id, {},
+                                              &Entry::id );
+    CHECK( it == bucket.end() || it->id != id );
+    bucket.insert( it, Entry{ .id = id, .tile = tile } );
+    ++size_;
+  }
+
+  void remove( gfx::point const tile, Id const id ) {
+    Bucket& bucket = buckets_.mut( bucket_for( tile ) );
+    auto const it  = std::ranges::find(
+        bucket, Entry{ .id = id, .tile = tile } );
+    CHECK( it != bucket.end(), "{} not found on tile {}.", id,
+           tile );
+    bucket.erase( it );
+    --size_;
+  }
+
+  int size() const { return size_; }
+
+  // All of the ids whose tiles are within the given distance of
+  // the center tile (inclusive).
+  std::vector<Id> within( gfx::point const center,
+                          double const max_distance ) const {
+    if( max_distance < 0 || size_ == 0 ) return {};
+    std::vector<Candidate> found;
+    int const reach = static_cast<int>(
+        std::min<double>( max_distance, kMaxReach ) );
+    Delta const grid = buckets_.size();
+    gfx::point const lo =
+        bucket_for( { .x = std::max( center.x - reach, 0 ),
+                      .y = std::max( center.y - reach, 0 ) } );
+    gfx::point const hi{
+      .x = std::min( ( center.x + reach ) / kBucketSize,
+                     grid.w - 1 ),
+      .y = std::min( ( center.y + reach ) / kBucketSize,
+                     grid.h - 1 ) };
+    gfx::point b;
+    for( b.y = lo.y; b.y <= hi.y; ++b.y ) {
+      for( b.x = lo.x; b.x <= hi.x; ++b.x ) {
+        for( Entry const& e : buckets_[b] ) {
+          Candidate const c = candidate( center, e );
+          double const distance = std::sqrt( c.distance2 );
+          if( distance <= max_distance ) found.push_back( c );
+        }
+      }
+    }
+    size_t const count = found.size();
+    return sorted_ids( std::move( found ), count );
+  }
+
+  // The (up to) `count` ids closest to the center tile.
+  std::vector<Id> nearest( gfx::point const center,
+                           int const count ) const {
+    if( count <= 0 || size_ == 0 ) return {};
+    std::vector<Candidate> found;
+    Delta const grid    = buckets_.size();
+    gfx::point const cb = bucket_for(
+        { .x = std::clamp( center.x, 0,
+                           grid.w * kBucketSize - 1 ),
+          .y = std::clamp( center.y, 0,
+                           grid.h * kBucketSize - 1 ) } );
+    int const max_ring = std::max(
+        { cb.x, cb.y, grid.w - 1 - cb.x, grid.h - 1 - cb.y } );
+    for( int ring = 0; ring <= max_ring; ++ring ) {
+      // Visit the buckets on the perimeter of the ring.
+      for( int y = cb.y - ring; y <= cb.y + ring; ++y ) {
+        bool const edge =
+            ( y == cb.y - ring || y == cb.y + ring );
+        int const step = edge ? 1 : 2 * ring;
+        for( int x = cb.x - ring; x <= cb.x + ring; x += step )
+          for( Entry const& e : buckets_[{ .x = x, .y = y }] )
+            found.push_back( candidate( center, e ) );
+      }
+      if( std::ssize( found ) < count ) continue;
+      // Anything in a bucket beyond this ring is at least this
+      // far away along one of the axes, so if we already have
+      // enough that are strictly closer than that then we are
+      // done.
+      std::ranges::nth_element( found,
+                                found.begin() + count - 1 );
+      int64_t const bound = int64_t{ ring } * kBucketSize + 1;
+      if( found[count - 1].distance2 < bound * bound ) break;
+    }
+    return sorted_ids( std::move( found ), count );
+  }
+
+  bool operator==( TileBuckets const& ) const = default;
+
+ private:
+  // Larger distances are clamped to this, which is plenty for
+  // any map, so that we don't overflow.
+  static int constexpr kMaxReach = 1 << 16;
+
+  struct Entry {
+    Id id           = {};
+    gfx::point tile = {};
+
+    bool operator==( Entry const& ) const = default;
+  };
+
+  using Bucket = std::vector<Entry>;
+
+  struct Candidate {
+    // Must go in this order for comparison purposes.
+    int64_t distance2 = {};
+    Id id             = {};
+
+    auto operator<=>( Candidate const& ) const = default;
+  };
+
+  static Candidate candidate( gfx::point const center,
+                              Entry const& e ) {
+    int64_t const dx = e.tile.x - center.x;
+    int64_t const dy = e.tile.y - center.y;
+    return { .distance2 = dx * dx + dy * dy, .id = e.id };
+  }
+
+  static std::vector<Id> sorted_ids(
+      std::vector<Candidate> found, size_t const count ) {
+    size_t const n = std::min( count, found.size() );
+    std::ranges::partial_sort( found, found.begin() + n );
+    std::vector<Id> res;
+    res.reserve( n );
+    for( size_t i = 0; i < n; ++i ) res.push_back( found[i].id );
+    return res;
+  }
+
+  // The tile grid will check-fail on negative tiles, so we don't
+  // have to worry about rounding toward zero here.
+  static gfx::point bucket_for( gfx::point const tile ) {
+    return { .x = tile.x / kBucketSize,
+             .y = tile.y / kBucketSize };
+  }
+
+  TileGrid<Bucket> buckets_;
+  int size_ = 0;
+};
+
+} // namespace rn
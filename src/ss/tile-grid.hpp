@@ -0,0 +1,105 @@
+/****************************************************************
+**tile-grid.hpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Dense per-tile index used by the ss caches.
+*
+*****************************************************************/
+#pragma once
+
+// gfx
+#include "gfx/cartesian.hpp"
+#include "gfx/matrix.hpp"
+
+// base
+#include "base/error.hpp"
+
+// C++ standard library
+#include <algorithm>
+
+namespace rn {
+
+/****************************************************************
+** TileGrid
+*****************************************************************/
+// A dense grid of small per-tile records that the state classes
+// use to index things by map tile so that lookups by tile don't
+// need to hash. Those classes are not told the size of the map,
+// so the grid grows as tiles are written, and reading a tile
+// outside of what has been written yields a default record.
+//
+// Two grids compare equal when they hold the same records, re-
+// gardless of how far each has grown.
+template<typename T>
+struct TileGrid {
+  T const& operator[]( gfx::point const tile ) const {
+    if( !grid_.exists( tile ) ) [[unlikely]]
+      return kEmpty;
+    return grid_[tile];
+  }
+
+  // Returns a mutable reference to the record, growing the grid
+  // if needed to cover it.
+  T& mut( gfx::point const tile ) {
+    if( !grid_.exists( tile ) ) [[unlikely]]
+      grow_to( tile );
+    return grid_[tile];
+  }
+
+  // Resets the record for the tile to its default value.
+  void reset( gfx::point const tile ) {
+    if( grid_.exists( tile ) ) grid_[tile] = T{};
+  }
+
+  // Calls fn( record, tile ) for each tile in the rect, in row
+  // major order, including tiles outside of the grid (which get
+  // default records).
+  void for_each_in( gfx::rect const r, auto&& fn ) const {
+    gfx::point p;
+    for( p.y = r.top(); p.y < r.bottom(); ++p.y )
+      for( p.x = r.left(); p.x < r.right(); ++p.x )
+        fn( ( *this )[p], std::as_const( p ) );
+  }
+
+  void clear() { grid_.clear(); }
+
+  Delta size() const { return grid_.size(); }
+
+  bool operator==( TileGrid const& rhs ) const {
+    Delta const sz{ .w = std::max( size().w, rhs.size().w ),
+                    .h = std::max( size().h, rhs.size().h ) };
+    gfx::point p;
+    for( p.y = 0; p.y < sz.h; ++p.y )
+      for( p.x = 0; p.x < sz.w; ++p.x )
+        if( !( ( *this )[p] == rhs[p] ) ) return false;
+    return true;
+  }
+
+ private:
+  void grow_to( gfx::point const tile ) {
+    CHECK( tile.x >= 0 && tile.y >= 0,
+           "tile {} cannot be indexed in a tile grid.", tile );
+    Delta const curr = grid_.size();
+    // Grow geometrically so that populating a map one tile at a
+    // time does not copy the grid on each new row or column.
+    auto const grow = []( int const have, int const need ) {
+      return need < have ? have : std::max( need, have * 2 );
+    };
+    Delta const new_size{ .w = grow( curr.w, tile.x + 1 ),
+                          .h = grow( curr.h, tile.y + 1 ) };
+    gfx::matrix<T> bigger( new_size );
+    grid_.apply( [&]( T& record, gfx::point const p ) {
+      bigger[p] = std::move( record );
+    } );
+    grid_ = std::move( bigger );
+  }
+
+  static inline T const kEmpty{};
+
+  gfx::matrix<T> grid_;
+};
+
+} // namespace rn
@@ -127,14 +127,22 @@ void Unit::change_player( UnitsState& units_state,
     units_state.unit_for( u.id ).change_player( units_state,
                                                 player_type );
 
+  // The per-player unit indices are keyed on the player, so we
+  // need to remove and re-add the unit around the change.
+  units_state.unindex_euro_unit( id() );
   o_.player_type = player_type;
+  units_state.index_euro_unit( id() );
+  if( auto const coord = units_state.maybe_coord_for( id() );
+      coord.has_value() )
+    units_state.update_units_on_tile( *coord );
 }
 
 // TODO: see if we need to block changing the type for a unit
 // that can be in cargo but is changing to a unit with a dif-
 // ferent occupation number (e.g. changing a colonist to a trea-
 // sure), if it is being held as cargo.
-void Unit::change_type( Player const& player,
+void Unit::change_type( UnitsState& units_state,
+                        Player const& player,
                         UnitComposition new_comp ) {
   UnitType const& new_type = new_comp.type_obj();
   CHECK( o_.cargo.slots_occupied() == 0,
@@ -165,8 +173,12 @@ void Unit::change_type( Player const& player,
       MovementPoints{ 0 },
       rn::movement_points( player, new_desc.type ) - used );
 
-  // This should be done last.
+  // This should be done last. The per-player unit stats count
+  // units by type, so we need to remove and re-add the unit
+  // around the change.
+  units_state.unindex_euro_unit( id() );
   o_.composition = std::move( new_comp );
+  units_state.index_euro_unit( id() );
 }
 
 string debug_string( Unit const& unit ) {
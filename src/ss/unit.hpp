@@ -125,7 +125,8 @@ struct ND Unit {
  private:
   // Should not call this directly, instead should use
   // change_unit_type.
-  void change_type( Player const& player,
+  void change_type( UnitsState& units_state,
+                    Player const& player,
                     UnitComposition new_comp );
 
   friend void change_unit_type(
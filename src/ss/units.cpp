@@ -10,6 +10,9 @@
 *****************************************************************/
 #include "units.hpp"
 
+// ss
+#include "ss/unit-type.hpp"
+
 // config
 #include "config/unit-type.rds.hpp"
 
@@ -48,6 +51,27 @@ valid_or<generic_err> check_harbor_state_invariants(
   return base::valid;
 }
 
+// Adds (or removes, when sign is -1) what the unit contributes
+// to its player's stats.
+void add_to_stats( PlayerUnitStats& stats,
+                   UnitState::euro const& st, int const sign ) {
+  Unit const& unit = st.unit;
+  stats.total += sign;
+  stats.by_type[unit.type()] += sign;
+  if( is_unit_a_colonist( unit.type() ) )
+    stats.colonists += sign;
+  auto const harbor =
+      st.ownership.get_if<UnitOwnership::harbor>();
+  if( !harbor.has_value() ) return;
+  if( !unit.desc().ship ) {
+    stats.on_dock += sign;
+    return;
+  }
+  if( harbor->port_status.holds<PortStatus::in_port>() )
+    stats.in_cargo_of_ships_in_port +=
+        sign * unit.cargo().count_items_of_type<Cargo::unit>();
+}
+
 } // namespace
 
 /****************************************************************
@@ -580,6 +604,15 @@ UnitsState::UnitsState( wrapped::UnitsState&& o )
       }
     }
   }
+
+  // Populate euro_units_for_player_. Must be done after the above
+  // since it looks up the units.
+  for( auto const& [unit_id, _] : euro_units_ )
+    index_euro_unit( unit_id );
+
+  // Populate units_on_tile_. Same as above.
+  for( auto const& [coord, _] : units_from_coords_ )
+    update_units_on_tile( coord );
 }
 
 UnitsState::UnitsState()
@@ -633,6 +666,39 @@ UnitsState::native_all() const {
   return native_units_;
 }
 
+set<UnitId> const& UnitsState::euro_units_for_player(
+    e_player const player ) const {
+  return euro_units_for_player_[player].all;
+}
+
+set<UnitId> const& UnitsState::euro_units_for_player(
+    e_player const player,
+    UnitOwnership::e const ownership ) const {
+  static set<UnitId> const kEmpty;
+  auto const& by_ownership =
+      euro_units_for_player_[player].by_ownership;
+  auto const it = by_ownership.find( ownership );
+  return ( it != by_ownership.end() ) ? it->second : kEmpty;
+}
+
+PlayerUnitStats const& UnitsState::unit_stats_for_player(
+    e_player const player ) const {
+  PlayerUnitStats const& stats =
+      euro_units_for_player_[player].stats;
+  DCHECK( stats == compute_unit_stats_for_player( player ),
+          "unit stats for player {} are out of sync.", player );
+  return stats;
+}
+
+PlayerUnitStats UnitsState::compute_unit_stats_for_player(
+    e_player const player ) const {
+  PlayerUnitStats stats;
+  for( auto const& [_, p_state] : euro_units_ )
+    if( p_state->unit.player_type() == player )
+      add_to_stats( stats, *p_state, /*sign=*/1 );
+  return stats;
+}
+
 UnitState const& UnitsState::state_of( GenericUnitId id ) const {
   CHECK( !deleted_.contains( id ),
          "unit with ID {} existed but was deleted.", id );
@@ -914,10 +980,41 @@ void UnitsState::move_unit_on_map( NativeUnitId id,
   auto& units_set = set_it->second;
   units_set.erase( GenericUnitId{ to_underlying( id ) } );
   if( units_set.empty() ) units_from_coords_.erase( set_it );
+  update_units_on_tile( curr_coord );
   // And add it to the new location.
   units_from_coords_[target].insert(
       GenericUnitId{ to_underlying( id ) } );
   curr_coord = target;
+  update_units_on_tile( target );
+}
+
+void UnitsState::index_euro_unit( UnitId const id ) {
+  UnitState::euro const& st = state_of( id );
+  EuroUnitIndex& index =
+      euro_units_for_player_[st.unit.player_type()];
+  index.all.insert( id );
+  index.by_ownership[st.ownership.to_enum()].insert( id );
+  add_to_stats( index.stats, st, /*sign=*/1 );
+}
+
+void UnitsState::unindex_euro_unit( UnitId const id ) {
+  UnitState::euro const& st = state_of( id );
+  EuroUnitIndex& index =
+      euro_units_for_player_[st.unit.player_type()];
+  CHECK( index.all.erase( id ) == 1 );
+  auto const it =
+      index.by_ownership.find( st.ownership.to_enum() );
+  CHECK( it != index.by_ownership.end() );
+  CHECK( it->second.erase( id ) == 1 );
+  if( it->second.empty() ) index.by_ownership.erase( it );
+  add_to_stats( index.stats, st, /*sign=*/-1 );
+}
+
+void UnitsState::set_ownership( UnitId const id,
+                                UnitOwnership ownership ) {
+  unindex_euro_unit( id );
+  ownership_of( id ) = std::move( ownership );
+  index_euro_unit( id );
 }
 
 void UnitsState::disown_unit( UnitId const id ) {
@@ -933,13 +1030,18 @@ void UnitsState::disown_unit( UnitId const id ) {
       auto& units_set = set_it->second;
       units_set.erase( GenericUnitId{ to_underlying( id ) } );
       if( units_set.empty() ) units_from_coords_.erase( set_it );
+      update_units_on_tile( coord );
       break;
     }
     case UnitOwnership::e::cargo: {
-      auto& holder_unit = unit_for( holder_of( id ) );
+      UnitId const holder_id = holder_of( id );
+      auto& holder_unit      = unit_for( holder_id );
       UNWRAP_CHECK( slot_idx,
                     holder_unit.cargo().find_unit( id ) );
+      // The holder's stats depend on the units in its cargo.
+      unindex_euro_unit( holder_id );
       holder_unit.cargo().remove( slot_idx );
+      index_euro_unit( holder_id );
       break;
     }
     case UnitOwnership::e::harbor: {
@@ -965,14 +1067,15 @@ void UnitsState::disown_unit( UnitId const id ) {
       break;
     }
   };
-  ownership = UnitOwnership::free{};
+  set_ownership( id, UnitOwnership::free{} );
 }
 
 void UnitsState::change_to_map( UnitId id, Coord target ) {
   disown_unit( id );
   units_from_coords_[target].insert(
       GenericUnitId{ to_underlying( id ) } );
-  ownership_of( id ) = UnitOwnership::world{ /*coord=*/target };
+  set_ownership( id, UnitOwnership::world{ /*coord=*/target } );
+  update_units_on_tile( target );
   add_or_bump_unit_ordering_index( id );
 }
 
@@ -999,12 +1102,15 @@ void UnitsState::change_to_cargo( UnitId const new_holder,
   // the same cargo where it will not fit unless it is first re-
   // moved from its current slot.
   CHECK( cargo_hold.fits( *this, Cargo::unit{ held }, slot ) );
+  // The holder's stats depend on the units in its cargo.
+  unindex_euro_unit( new_holder );
   CHECK(
       cargo_hold.try_add( *this, Cargo::unit{ held }, slot ) );
+  index_euro_unit( new_holder );
   unit_for( held ).sentry();
   // Set new ownership
-  ownership_of( held ) =
-      UnitOwnership::cargo{ /*holder=*/new_holder };
+  set_ownership( held,
+                 UnitOwnership::cargo{ /*holder=*/new_holder } );
 }
 
 void UnitsState::change_to_harbor_view(
@@ -1012,11 +1118,11 @@ void UnitsState::change_to_harbor_view(
     maybe<Coord> sailed_from ) {
   CHECK_HAS_VALUE(
       check_harbor_state_invariants( port_status ) );
-  UnitOwnership& ownership = ownership_of( id );
-  if( !ownership.holds<UnitOwnership::harbor>() )
+  if( !ownership_of( id ).holds<UnitOwnership::harbor>() )
     disown_unit( id );
-  ownership = UnitOwnership::harbor{
-    .port_status = port_status, .sailed_from = sailed_from };
+  set_ownership( id, UnitOwnership::harbor{
+                       .port_status = port_status,
+                       .sailed_from = sailed_from } );
   add_or_bump_unit_ordering_index( id );
 }
 
@@ -1025,8 +1131,8 @@ void UnitsState::change_to_dwelling( UnitId unit_id,
   disown_unit( unit_id );
   CHECK( !missionary_in_dwelling_.contains( dwelling_id ) );
   missionary_in_dwelling_[dwelling_id] = unit_id;
-  ownership_of( unit_id ) =
-      UnitOwnership::dwelling{ .id = dwelling_id };
+  set_ownership( unit_id,
+                 UnitOwnership::dwelling{ .id = dwelling_id } );
 }
 
 valid_or<string> PortStatus::outbound::validate() const {
@@ -1052,7 +1158,7 @@ valid_or<string> PortStatus::in_port::validate() const {
 void UnitsState::change_to_colony( UnitId id, ColonyId col_id ) {
   disown_unit( id );
   worker_units_from_colony_[col_id].insert( id );
-  ownership_of( id ) = UnitOwnership::colony{ col_id };
+  set_ownership( id, UnitOwnership::colony{ col_id } );
 }
 
 UnitId UnitsState::add_unit( Unit&& unit ) {
@@ -1068,6 +1174,7 @@ UnitId UnitsState::add_unit( Unit&& unit ) {
       UnitState::euro{ .unit      = std::move( unit ),
                        .ownership = UnitOwnership::free{} };
   euro_units_[unit_id] = &o_.units[id].get<UnitState::euro>();
+  index_euro_unit( unit_id );
   return unit_id;
 }
 
@@ -1089,6 +1196,7 @@ NativeUnitId UnitsState::add_unit_on_map(
   native_units_[native_id] =
       &o_.units[id].get<UnitState::native>();
   units_from_coords_[target].insert( id );
+  update_units_on_tile( target );
   // Note: this dwelling may already have a brave associated with
   // it, even though the game only allows one active brave per
   // dwelling. This is because sometimes temporary braves are
@@ -1104,6 +1212,7 @@ void UnitsState::destroy_unit( UnitId unit_id ) {
   CHECK( euro_units_.contains( unit_id ) );
   CHECK( !deleted_.contains( id ) );
   disown_unit( unit_id );
+  unindex_euro_unit( unit_id );
   o_.units.erase( id );
   euro_units_.erase( unit_id );
   deleted_.insert( id );
@@ -1128,6 +1237,7 @@ void UnitsState::destroy_unit( NativeUnitId native_id ) {
   auto& units_set = set_it->second;
   units_set.erase( GenericUnitId{ to_underlying( id ) } );
   if( units_set.empty() ) units_from_coords_.erase( set_it );
+  update_units_on_tile( coord );
 
   o_.units.erase( id );
   native_units_.erase( native_id );
@@ -1178,6 +1288,33 @@ UnitsState::from_coords() const {
   return units_from_coords_;
 }
 
+UnitsOnTile const& UnitsState::on_tile(
+    gfx::point const tile ) const {
+  return units_on_tile_[tile];
+}
+
+void UnitsState::update_units_on_tile( Coord const coord ) {
+  point const tile = coord.to_gfx();
+  auto const units = base::lookup( units_from_coords_, coord );
+  if( !units.has_value() || units->empty() ) {
+    units_on_tile_.reset( tile );
+    return;
+  }
+  GenericUnitId const first = *units->begin();
+  UnitsOnTile& record       = units_on_tile_.mut( tile );
+  record = UnitsOnTile{ .count = int( units->size() ),
+                        .kind  = unit_kind( first ) };
+  switch( record.kind ) {
+    case e_unit_kind::euro:
+      record.player = euro_unit_for( first ).player_type();
+      break;
+    case e_unit_kind::native:
+      record.dwelling_id =
+          ownership_of( check_native_unit( first ) ).dwelling_id;
+      break;
+  }
+}
+
 unordered_set<UnitId> const& UnitsState::from_colony(
     Colony const& colony ) const {
   // The empty case can happen during testing when there haven't
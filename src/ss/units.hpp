@@ -17,12 +17,18 @@
 #include "ss/colony-id.hpp"
 #include "ss/colony.hpp"
 #include "ss/dwelling-id.hpp"
+#include "ss/tile-grid.hpp"
 #include "ss/unit-id.hpp"
+#include "ss/unit-type.rds.hpp"
 
 // gfx
 #include "gfx/coord.hpp"
 
+// refl
+#include "refl/enum-map.hpp"
+
 // C++ standard library
+#include <set>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -31,6 +37,49 @@ namespace rn {
 struct Colony;
 struct UnitOwnershipChanger;
 
+// A summary of the units that are on the map at a tile. Normally
+// they all belong to the same society, but when they don't, the
+// owner fields describe the first unit in the from_coord set for
+// the tile, which is the one that callers have always looked at.
+struct UnitsOnTile {
+  int count = 0;
+
+  // The remaining fields are only meaningful when count > 0.
+  e_unit_kind kind = {};
+
+  // When kind is euro.
+  e_player player = {};
+
+  // When kind is native; the tribe can be found through it.
+  DwellingId dwelling_id = {};
+
+  bool operator==( UnitsOnTile const& ) const = default;
+};
+
+// Aggregate counts over all of the european units owned by a
+// player, wherever they are. These are kept up to date as units
+// are created, destroyed, or change type, player, or ownership,
+// so that the code that runs for each player each turn does not
+// have to scan every unit in the game. Counts by ownership are
+// not here because they are available from the per-player unit
+// sets.
+struct PlayerUnitStats {
+  int total = 0;
+
+  // Units for which is_unit_a_colonist is true.
+  int colonists = 0;
+
+  refl::enum_map<e_unit_type, int> by_type = {};
+
+  // Non-ship units in the harbor.
+  int on_dock = 0;
+
+  // Units in the cargo of ships that are in port in the harbor.
+  int in_cargo_of_ships_in_port = 0;
+
+  bool operator==( PlayerUnitStats const& ) const = default;
+};
+
 struct UnitsState {
   UnitsState();
   // We don't default this because we don't want to compare the
@@ -58,6 +107,23 @@ struct UnitsState {
                      UnitState::native const*> const&
   native_all() const;
 
+  // All of the european units owned by the given player, in as-
+  // cending order of unit id. These are maintained as units are
+  // created, destroyed, change ownership, or change player, so
+  // they are cheap to get.
+  std::set<UnitId> const& euro_units_for_player(
+      e_player player ) const;
+
+  // Same as above but only the units whose ownership is of the
+  // given kind, e.g. only those on the map.
+  std::set<UnitId> const& euro_units_for_player(
+      e_player player, UnitOwnership::e ownership ) const;
+
+  // In debug builds this will be checked against a scan of all
+  // of the units.
+  PlayerUnitStats const& unit_stats_for_player(
+      e_player player ) const;
+
   // Is this a European or native unit.
   e_unit_kind unit_kind( GenericUnitId id ) const;
 
@@ -111,7 +177,10 @@ struct UnitsState {
       UnitId id ) const;
 
   // We allow non-const access to the harbor view state because
-  // changing it will not affect the invariants of this class.
+  // changing it will not affect the invariants of this class,
+  // with the exception of changing a ship to or from being in
+  // port, which must be done via change_to_harbor_view since it
+  // affects the per-player stats.
   base::maybe<UnitOwnership::harbor&> maybe_harbor_view_state_of(
       UnitId id );
   base::maybe<UnitOwnership::harbor const&>
@@ -128,6 +197,11 @@ struct UnitsState {
                      std::unordered_set<GenericUnitId>> const&
   from_coords() const;
 
+  // Summary of what from_coord would return, kept up to date as
+  // units move so that it can be read without hashing. Prefer
+  // this when only the owner or the number of units is needed.
+  UnitsOnTile const& on_tile( gfx::point tile ) const;
+
   // Note this returns only units that are working in the colony,
   // not units that are on the map at the location of the colony.
   std::unordered_set<UnitId> const& from_colony(
@@ -196,6 +270,8 @@ struct UnitsState {
   // ------------------------------------------------------------
   friend struct UnitOwnershipChanger;
   friend struct UnitOnMapMover;
+  // Needs to update the per-player indices when changing player.
+  friend struct Unit;
 
   friend NativeUnitId create_unit_on_map_non_interactive(
       SS& ss, e_native_unit_type type, gfx::point coord,
@@ -261,6 +337,28 @@ struct UnitsState {
 
   void add_or_bump_unit_ordering_index( UnitId id );
 
+  // All changes to the ownership of a european unit must go
+  // through this so that the per-player indices stay in sync.
+  void set_ownership( UnitId id, UnitOwnership ownership );
+
+  // Remove/add the unit from/to the per-player indices according
+  // to its current player and ownership. Anything that changes
+  // what a unit contributes to the per-player stats (e.g. its
+  // type, or the units in its cargo) must also be wrapped in a
+  // call to these.
+  void unindex_euro_unit( UnitId id );
+  void index_euro_unit( UnitId id );
+
+  // Recomputes the units_on_tile_ record from the from_coord set
+  // for the tile. Must be called whenever that set changes or
+  // when one of its units changes player.
+  void update_units_on_tile( Coord coord );
+
+  // Computes the per-player stats from scratch by scanning all
+  // units, for cross-checking the maintained ones.
+  PlayerUnitStats compute_unit_stats_for_player(
+      e_player player ) const;
+
   // ----- Serializable state.
   wrapped::UnitsState o_;
 
@@ -276,6 +374,9 @@ struct UnitsState {
   std::unordered_map<Coord, std::unordered_set<GenericUnitId>>
       units_from_coords_;
 
+  // Dense version of the above holding only a summary.
+  TileGrid<UnitsOnTile> units_on_tile_;
+
   // For units that are held in a colony.
   std::unordered_map<ColonyId, std::unordered_set<UnitId>>
       worker_units_from_colony_;
@@ -302,6 +403,16 @@ struct UnitsState {
   std::unordered_map<UnitId, UnitState::euro const*> euro_units_;
   std::unordered_map<NativeUnitId, UnitState::native const*>
       native_units_;
+
+  // European units by player and by kind of ownership. Ordered so
+  // that iteration is deterministic.
+  struct EuroUnitIndex {
+    std::set<UnitId> all;
+    std::unordered_map<UnitOwnership::e, std::set<UnitId>>
+        by_ownership;
+    PlayerUnitStats stats;
+  };
+  refl::enum_map<e_player, EuroUnitIndex> euro_units_for_player_;
 };
 
 } // namespace rn
@@ -25,12 +25,16 @@
 #include "render/typer.hpp"
 
 // base
+#include "base/hash.hpp"
 #include "base/range-lite.hpp"
 #include "base/string.hpp"
 
 // base-util
 #include "base-util/string.hpp"
 
+// C++ standard library
+#include <unordered_map>
+
 using namespace std;
 
 namespace rn {
@@ -218,6 +222,38 @@ vector<vector<MarkedUpChunk>> text_markup_reflow_impl(
   return reflowed;
 }
 
+/****************************************************************
+** Layout Cache
+*****************************************************************/
+// When the cache reaches this size it is just cleared; the text
+// on screen at any given time should be well below this.
+size_t constexpr kMaxTextLayoutCacheEntries = 512;
+
+struct TextLayoutCacheEntry {
+  e_font font  = {};
+  int max_cols = 0;
+  string text;
+  ReflowedText reflowed;
+};
+
+// Keyed on the hash of the font, reflow info and text. The entry
+// holds the key in full so that collisions can be detected.
+unordered_map<uint64_t, TextLayoutCacheEntry>&
+text_layout_cache() {
+  static unordered_map<uint64_t, TextLayoutCacheEntry> cache;
+  return cache;
+}
+
+uint64_t text_layout_hash( e_font const font,
+                           TextReflowInfo const& r_info,
+                           string_view const text ) {
+  int32_t const params[] = { int32_t( font ), r_info.max_cols };
+  string_view const param_bytes(
+      reinterpret_cast<char const*>( params ), sizeof( params ) );
+  return base::hash_64_fnv1a(
+      text, base::hash_64_fnv1a( param_bytes ) );
+}
+
 } // namespace
 
 /****************************************************************
@@ -261,24 +297,73 @@ void render_text( rr::Renderer& renderer, point where,
   render_text( renderer, where, font::standard(), color, text );
 }
 
+ReflowedText reflow_text_markup( TextReflowInfo const& r_info,
+                                 string_view const text ) {
+  return ReflowedText{
+    .lines = text_markup_reflow_impl( r_info, text ) };
+}
+
+ReflowedText const& reflow_text_markup_cached(
+    e_font const font, TextReflowInfo const& r_info,
+    string_view const text ) {
+  auto& cache         = text_layout_cache();
+  uint64_t const hash = text_layout_hash( font, r_info, text );
+  if( auto it = cache.find( hash ); it != cache.end() ) {
+    TextLayoutCacheEntry& entry = it->second;
+    if( entry.font == font && entry.max_cols == r_info.max_cols &&
+        entry.text == text )
+      return entry.reflowed;
+    // Collision; just replace it.
+    entry = TextLayoutCacheEntry{
+      .font     = font,
+      .max_cols = r_info.max_cols,
+      .text     = string( text ),
+      .reflowed = reflow_text_markup( r_info, text ) };
+    return entry.reflowed;
+  }
+  if( cache.size() >= kMaxTextLayoutCacheEntries ) cache.clear();
+  auto const [it, inserted] = cache.emplace(
+      hash, TextLayoutCacheEntry{
+              .font     = font,
+              .max_cols = r_info.max_cols,
+              .text     = string( text ),
+              .reflowed = reflow_text_markup( r_info, text ) } );
+  CHECK( inserted );
+  return it->second.reflowed;
+}
+
+void clear_text_layout_cache() { text_layout_cache().clear(); }
+
+void render_reflowed_text( rr::Renderer& renderer, point where,
+                           TextMarkupInfo const& m_info,
+                           ReflowedText const& reflowed ) {
+  // The color will be set later.
+  rr::Typer typer = renderer.typer( where, pixel{} );
+  render_lines_markup( typer, reflowed.lines, m_info );
+}
+
 void render_text_markup_reflow(
     rr::Renderer& renderer, point where, e_font font,
     TextMarkupInfo const& markup_info,
     TextReflowInfo const& reflow_info, string_view text ) {
-  (void)font; // TODO
-  vector<vector<MarkedUpChunk>> markedup_reflowed =
-      text_markup_reflow_impl( reflow_info, text );
-  // The color will be set later.
-  rr::Typer typer = renderer.typer( where, pixel{} );
-  render_lines_markup( typer, markedup_reflowed, markup_info );
+  render_reflowed_text(
+      renderer, where, markup_info,
+      reflow_text_markup_cached( font, reflow_info, text ) );
 }
 
 Delta rendered_text_size( rr::ITextometer const& textometer,
                           rr::TextLayout const& text_layout,
                           TextReflowInfo const& reflow_info,
                           string_view text ) {
-  vector<vector<MarkedUpChunk>> lines =
-      text_markup_reflow_impl( reflow_info, text );
+  return rendered_text_size(
+      textometer, text_layout,
+      reflow_text_markup( reflow_info, text ) );
+}
+
+Delta rendered_text_size( rr::ITextometer const& textometer,
+                          rr::TextLayout const& text_layout,
+                          ReflowedText const& reflowed ) {
+  vector<vector<MarkedUpChunk>> const& lines = reflowed.lines;
   Delta res;
   res.h = H{ textometer.font_height() * int( lines.size() ) };
   for( vector<MarkedUpChunk> const& line : lines ) {
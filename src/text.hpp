@@ -15,6 +15,7 @@
 
 // Revolution Now
 #include "font.hpp"
+#include "markup.rds.hpp"
 
 // gfx
 #include "gfx/coord.hpp"
@@ -22,6 +23,7 @@
 
 // C++ standard library
 #include <tuple>
+#include <vector>
 
 namespace rr {
 struct Renderer;
@@ -77,6 +79,37 @@ void render_text_markup_reflow( rr::Renderer& renderer,
                                 TextReflowInfo const& r_info,
                                 std::string_view text );
 
+// Text that has been re-flowed and wrapped (see above) and split
+// into runs of uniformly styled text per line. Computing this is
+// the expensive part of rendering reflowed text, so it should be
+// done once and stored when the text does not change; what re-
+// mains when rendering it is just emitting the glyphs.
+struct ReflowedText {
+  std::vector<std::vector<MarkedUpChunk>> lines;
+
+  bool operator==( ReflowedText const& ) const = default;
+};
+
+ReflowedText reflow_text_markup( TextReflowInfo const& r_info,
+                                 std::string_view text );
+
+// Same as above but memoized in a global cache keyed on the font,
+// the reflow info, and the text. Markup info is not part of the
+// key since it only affects colors, which are applied when ren-
+// dering. The returned reference is only valid until the next
+// call to this function.
+ReflowedText const& reflow_text_markup_cached(
+    e_font font, TextReflowInfo const& r_info,
+    std::string_view text );
+
+// Clears the cache used by the above.
+void clear_text_layout_cache();
+
+void render_reflowed_text( rr::Renderer& renderer,
+                           gfx::point where,
+                           TextMarkupInfo const& m_info,
+                           ReflowedText const& reflowed );
+
 // This is not cheap, so ideally it should be called once and the
 // result stored, as opposed to calling it every frame.
 Delta rendered_text_size( rr::ITextometer const& textometer,
@@ -84,6 +117,11 @@ Delta rendered_text_size( rr::ITextometer const& textometer,
                           TextReflowInfo const& reflow_info,
                           std::string_view text );
 
+// Same as above but for text that has already been reflowed.
+Delta rendered_text_size( rr::ITextometer const& textometer,
+                          rr::TextLayout const& text_layout,
+                          ReflowedText const& reflowed );
+
 // Same as above but no reflow.  Will still account for markup.
 Delta rendered_text_size_no_reflow(
     rr::ITextometer const& textometer,
@@ -12,6 +12,7 @@
 
 // Revolution Now
 #include "imap-updater.hpp"
+#include "production-cache.hpp"
 
 // refl
 #include "refl/to-str.hpp"
@@ -29,8 +30,12 @@ TS::TS( Planes& planes_, IGui& gui_, ICombat& combat_,
     gui( gui_ ),
     combat( combat_ ),
     colony_viewer( colony_viewer_ ),
+    colony_production_cache_(
+        make_unique<ColonyProductionCache>() ),
     saved( saved ) {}
 
+TS::~TS() = default;
+
 void to_str( TS const& o, string& out, base::tag<TS> ) {
   out += "TS@";
   out += fmt::format( "{}", static_cast<void const*>( &o ) );
@@ -16,11 +16,13 @@
 #include "base/error.hpp"
 
 // C++ standard library
+#include <memory>
 #include <utility>
 
 namespace rn {
 
 struct Agents;
+struct ColonyProductionCache;
 struct IColonyViewer;
 struct ICombat;
 struct IGui;
@@ -65,7 +67,7 @@ struct TS {
   TS( Planes& planes, IGui& gui_, ICombat& combat,
       IColonyViewer& colony_viewer, RootState& saved );
 
-  ~TS() = default;
+  ~TS();
 
   TS( TS&& ) = delete;
 
@@ -89,6 +91,19 @@ struct TS {
   TS_FIELD( NativeAgents, native_agents );
   TS_FIELD( Agents, agents );
 
+ public:
+  // Holds the most recently computed production of each colony
+  // so that it does not have to be recomputed when nothing rele-
+  // vant has changed. Since the cache validates its entries
+  // against the game state it can be used from anywhere.
+  ColonyProductionCache& colony_production_cache() const {
+    return *colony_production_cache_;
+  }
+
+ private:
+  std::unique_ptr<ColonyProductionCache>
+      colony_production_cache_;
+
  public:
   // This refers to a serialized state data structure that holds
   // the game state as it was when the game was most recently
@@ -61,6 +61,7 @@
 #include "rcl-game-storage.hpp"
 #include "rebel-sentiment.hpp"
 #include "ref.hpp"
+#include "replay.hpp"
 #include "report-congress.hpp"
 #include "road.hpp"
 #include "roles.hpp"
@@ -115,13 +116,12 @@
 #include "base/to-str-ext-std.hpp"
 #include "base/variant-util.hpp"
 
-// base-util
-#include "base-util/algo.hpp"
-
 // C++ standard library
 #include <algorithm>
+#include <chrono>
 #include <deque>
 #include <queue>
+#include <set>
 
 using namespace std;
 
@@ -333,14 +333,11 @@ bool can_ask_for_orders( SSConst const& ss, Unit const& unit ) {
   }
 }
 
+// Sorted by unit id.
 vector<UnitId> euro_units_all( UnitsState const& units_state,
                                e_player n ) {
-  vector<UnitId> res;
-  res.reserve( units_state.all().size() );
-  for( auto const& p : units_state.euro_all() )
-    if( n == p.second->unit.player_type() )
-      res.push_back( p.first );
-  return res;
+  set<UnitId> const& units = units_state.euro_units_for_player( n );
+  return vector<UnitId>( units.begin(), units.end() );
 }
 
 // Apply a function to all european units. The function may mu-
@@ -406,6 +403,17 @@ wait_bool process_unit_prioritization_request(
   co_return true;
 }
 
+AutosaveWorker& autosave_worker() {
+  static AutosaveWorker worker;
+  return worker;
+}
+
+void report_autosave(
+    maybe<AutosaveWorker::result_t> const& res ) {
+  if( !res.has_value() || res->has_value() ) return;
+  lg.error( "failed to auto-save: {}", res->error() );
+}
+
 // It might seem to make sense to just autosave the game at the
 // start of each turn or at least at the start of the player's
 // turn. However, like in the OG, we instead autosave the game
@@ -443,18 +451,35 @@ wait_bool process_unit_prioritization_request(
 // asking the player for input. Thus, if you just keep loading an
 // autosave file, you will see the year steadily increase just
 // from the loading. We of course are not reproducing that bug.
+//
+// The state is copied on this thread (which is much cheaper than
+// serializing it) and the serialization and file writing are
+// then done on a background thread. An error from a background
+// save gets logged the next time that we come through here.
 void autosave_if_needed( SS& ss ) {
+  AutosaveWorker& worker = autosave_worker();
+  report_autosave( worker.poll() );
   set<int> const autosave_slots = should_autosave( ss.as_const );
   if( autosave_slots.empty() ) return;
-  // TODO: we may want to inject these somewhere higher up.
-  RclGameStorageSave const storage_save( ss );
-  RealGameWriter const game_writer( storage_save );
-  // This will do the save.
-  expect<vector<fs::path>> const paths_saved =
-      autosave( ss.as_const, game_writer, ss.turn.autosave,
-                autosave_slots );
-  if( !paths_saved.has_value() )
-    lg.error( "failed to auto-save: {}", paths_saved.error() );
+  // Need to do this in the live state as well as in the snap-
+  // shot (where the autosave method does it) so that we don't
+  // immediately save again.
+  ss.turn.autosave.last_save = ss.turn.time_point.turns;
+  auto const snapshot        = make_shared<SS>();
+  assign_src_to_dst( as_const( ss.root ), snapshot->root );
+  report_autosave( worker.start( [snapshot, autosave_slots] {
+    // TODO: we may want to inject these somewhere higher up.
+    RclGameStorageSave const storage_save( *snapshot );
+    RealGameWriter const game_writer( storage_save );
+    return autosave( snapshot->as_const, game_writer,
+                     snapshot->turn.autosave, autosave_slots );
+  } ) );
+}
+
+// Called when leaving the turn loop so that we don't exit (or
+// load another game) while an autosave is still being written.
+void finish_autosave() {
+  report_autosave( autosave_worker().wait() );
 }
 
 // This is a bit costly, and so it is unfortunate that, for vi-
@@ -1874,7 +1899,6 @@ wait<> units_turn( IEngine& engine, SS& ss, TS& ts,
     // Refill the queue.
     vector<UnitId> units =
         euro_units_all( ss.units, player.type );
-    util::sort_by_key( units, []( auto id ) { return id; } );
     erase_if( units, [&]( UnitId id ) {
       return should_remove_unit_from_queue(
           ss.units.unit_for( id ) );
@@ -2463,8 +2487,16 @@ wait<TurnCycle> next_turn_iter( IEngine& engine, SS& ss,
   }
 }
 
+string turn_phase_name( TurnCycle const& cycle ) {
+  if( auto const player = cycle.get_if<TurnCycle::player>();
+      player.has_value() )
+    return format( "{}", player->type );
+  return format( "{}", cycle.to_enum() );
+}
+
 // Runs through the various phases of a single turn.
-wait<> next_turn( IEngine& engine, SS& ss, TS& ts ) {
+wait<> next_turn( IEngine& engine, SS& ss, TS& ts,
+                  maybe<ReplaySession&> const replay ) {
   TurnCycle& cycle = ss.turn.cycle;
   ts.planes.get().get_bottom<ILandViewPlane>().start_new_turn();
   auto const& time_point = ss.turn.time_point;
@@ -2472,16 +2504,26 @@ wait<> next_turn( IEngine& engine, SS& ss, TS& ts ) {
       format( "[ starting turn {}: {} {} ]", time_point.turns,
               time_point.season, time_point.year );
   base::print_bar( '=', bar_label );
-  while( !cycle.holds<TurnCycle::finished>() )
+  while( !cycle.holds<TurnCycle::finished>() ) {
+    if( !replay.has_value() ) {
+      cycle = co_await next_turn_iter( engine, ss, ts );
+      continue;
+    }
+    string const phase = turn_phase_name( cycle );
+    auto const start   = chrono::steady_clock::now();
     cycle = co_await next_turn_iter( engine, ss, ts );
+    replay->add_phase_time(
+        phase, chrono::duration_cast<chrono::microseconds>(
+                   chrono::steady_clock::now() - start ) );
+  }
   // The default-constructed cycle represents a new turn where
   // nothing yet has been done. Do this at the end of the cycle
   // so that we don't destroy the turn state after having loaded
   // a saved game.
   cycle = {};
-  // This should be relatively quick.
-  CHECK_HAS_VALUE(
-      ss.as_const.validate_non_terrain_game_state() );
+  // This only looks at what has changed during the turn so it
+  // should be quick.
+  CHECK_HAS_VALUE( ss.validate_changed_game_state() );
 }
 
 } // namespace
@@ -2489,13 +2531,26 @@ wait<> next_turn( IEngine& engine, SS& ss, TS& ts ) {
 /****************************************************************
 ** Turn State Advancement
 *****************************************************************/
+
 // Runs through multiple turns.
 wait<> turn_loop( IEngine& engine, SS& ss, TS& ts ) {
+  SCOPE_EXIT { finish_autosave(); };
   while( true ) {
     try {
-      co_await next_turn( engine, ss, ts );
+      co_await next_turn( engine, ss, ts, /*replay=*/nothing );
     } catch( top_of_turn_loop const& ) {}
   }
 }
 
+wait<> turn_loop( IEngine& engine, SS& ss, TS& ts,
+                  ReplaySession& replay ) {
+  SCOPE_EXIT { finish_autosave(); };
+  while( true ) {
+    try {
+      co_await next_turn( engine, ss, ts, replay );
+    } catch( top_of_turn_loop const& ) { continue; }
+    if( replay.turn_finished() ) co_return;
+  }
+}
+
 } // namespace rn
@@ -18,9 +18,15 @@
 namespace rn {
 
 struct IEngine;
+struct ReplaySession;
 struct SS;
 struct TS;
 
 wait<> turn_loop( IEngine& engine, SS& ss, TS& ts );
 
+// Runs only the number of turns that the replay session asks
+// for, timing each phase of each turn.
+wait<> turn_loop( IEngine& engine, SS& ss, TS& ts,
+                  ReplaySession& replay );
+
 } // namespace rn
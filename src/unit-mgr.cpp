@@ -203,7 +203,7 @@ void change_unit_type( SS& ss, TS& ts, Unit& unit,
                        UnitComposition const& new_comp ) {
   Player const& player =
       player_for_player_or_die( ss.players, unit.player_type() );
-  unit.change_type( player, new_comp );
+  unit.change_type( ss.units, player, new_comp );
   // In order to make sure that fog of war is updated to reflect
   // the new type (i.e. maybe its sighting radius is different),
   // we will replace it on the map.
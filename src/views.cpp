@@ -386,8 +386,9 @@ TextView::TextView( rr::ITextometer const& textometer,
                     TextMarkupInfo const& m_info,
                     TextReflowInfo const& r_info )
   : msg_( std::move( msg ) ),
+    reflowed_( reflow_text_markup( r_info, msg_ ) ),
     text_size_{ rendered_text_size( textometer, rr::TextLayout{},
-                                    r_info, msg_ ) },
+                                    reflowed_ ) },
     markup_info_( m_info ),
     reflow_info_( r_info ) {}
 
@@ -401,8 +402,8 @@ Delta TextView::delta() const { return text_size_; }
 
 void TextView::draw( rr::Renderer& renderer,
                      Coord coord ) const {
-  render_text_markup_reflow( renderer, coord, font::standard(),
-                             markup_info_, reflow_info_, msg_ );
+  render_reflowed_text( renderer, coord, markup_info_,
+                        reflowed_ );
 }
 
 /****************************************************************
@@ -1598,6 +1599,71 @@ bool OnInputView::on_input( input::event_t const& event ) {
   return this->CompositeSingleView::on_input( event );
 }
 
+/****************************************************************
+** RetainedDrawing
+*****************************************************************/
+struct RetainedDrawing::Cache {
+  vector<rr::GenericVertex> vertices;
+  Coord coord;
+  Delta size;
+  rr::RendererMods mods;
+};
+
+RetainedDrawing::RetainedDrawing() = default;
+
+RetainedDrawing::~RetainedDrawing() = default;
+
+void RetainedDrawing::draw(
+    rr::Renderer& renderer, Coord const coord, Delta const size,
+    base::function_ref<void()> const draw_fn ) const {
+  if( cache_ != nullptr &&
+      ( cache_->coord != coord || cache_->size != size ||
+        cache_->mods != renderer.mods() ) )
+    cache_ = nullptr;
+  if( cache_ != nullptr ) {
+    renderer.replay( cache_->vertices, gfx::size{} );
+    return;
+  }
+  auto cache = make_unique<Cache>();
+  renderer.capture( draw_fn, cache->vertices );
+  cache->coord = coord;
+  cache->size  = size;
+  cache->mods  = renderer.mods();
+  cache_       = std::move( cache );
+}
+
+void RetainedDrawing::invalidate() { cache_ = nullptr; }
+
+/****************************************************************
+** RetainedView
+*****************************************************************/
+RetainedView::RetainedView( unique_ptr<View> view )
+  : CompositeSingleView( std::move( view ), Coord{} ) {}
+
+RetainedView::~RetainedView() = default;
+
+void RetainedView::draw( rr::Renderer& renderer,
+                         Coord coord ) const {
+  retained_.draw( renderer, coord, single()->delta(), [&] {
+    this->CompositeSingleView::draw( renderer, coord );
+  } );
+}
+
+bool RetainedView::on_input( input::event_t const& event ) {
+  invalidate();
+  return this->CompositeSingleView::on_input( event );
+}
+
+void RetainedView::on_mouse_leave( Coord from ) {
+  invalidate();
+  this->CompositeSingleView::on_mouse_leave( from );
+}
+
+void RetainedView::on_mouse_enter( Coord to ) {
+  invalidate();
+  this->CompositeSingleView::on_mouse_enter( to );
+}
+
 /****************************************************************
 ** BorderView
 *****************************************************************/
@@ -32,6 +32,9 @@
 // gfx
 #include "gfx/pixel.hpp"
 
+// base
+#include "base/function-ref.hpp"
+
 // C++ standard library
 #include <memory>
 
@@ -385,6 +388,9 @@ class TextView : public View {
 
  private:
   std::string msg_;
+  // Laid out once on construction so that drawing only needs to
+  // emit the glyphs.
+  ReflowedText reflowed_;
   Delta text_size_; // rendered pixel size.
   TextMarkupInfo markup_info_;
   TextReflowInfo reflow_info_;
@@ -1068,6 +1074,78 @@ class OnInputView : public CompositeSingleView {
   OnInput on_input_;
 };
 
+// Holds the vertices captured from one draw of something so
+// that later draws can replay them instead of running the draw-
+// ing code again. The captured vertices are dropped (and the
+// drawing code run again) when any of the following happen:
+//
+//   1. invalidate() is called.
+//   2. It is drawn at a different position or with a different
+//      size than when the vertices were captured. Repositioning
+//      is not done by shifting the vertices because views apply
+//      their positions in different ways (e.g. some via scaled
+//      renderer mods) and so shifting would not be reliable.
+//   3. The renderer mods in effect when drawing differ from
+//      those in effect when the vertices were captured.
+//
+// This is what RetainedView uses, but it can also be held by
+// views that can't be wrapped in one, in which case they must
+// call invalidate whenever anything that they draw changes.
+class RetainedDrawing {
+ public:
+  RetainedDrawing();
+  ~RetainedDrawing();
+
+  void draw( rr::Renderer& renderer, Coord coord, Delta size,
+             base::function_ref<void()> draw_fn ) const;
+
+  void invalidate();
+
+  bool is_retained() const { return cache_ != nullptr; }
+
+ private:
+  struct Cache;
+  mutable std::unique_ptr<Cache> cache_;
+};
+
+// Draws the wrapped view in retained mode (see RetainedDrawing).
+// On top of the cases listed there, the captured vertices are
+// also dropped when the following happen:
+//
+//   1. Input is sent to this view (including mouse enter/leave).
+//   2. children_updated() is called on any ancestor.
+//
+// Views that animate on their own (e.g. via advance_state) must
+// not be wrapped in this, or if they are, then invalidate must be
+// called whenever they change.
+class RetainedView : public CompositeSingleView {
+ public:
+  RetainedView( std::unique_ptr<View> view );
+
+  ~RetainedView() override;
+
+  // Implement Object
+  void draw( rr::Renderer& renderer,
+             Coord coord ) const override;
+
+  // Implement CompositeView
+  void notify_children_updated() override { invalidate(); }
+
+  // Implement UI.
+  bool on_input( input::event_t const& e ) override;
+
+  // Implement ui::object
+  void on_mouse_leave( Coord from ) override;
+  void on_mouse_enter( Coord to ) override;
+
+  void invalidate() { retained_.invalidate(); }
+
+  bool is_retained() const { return retained_.is_retained(); }
+
+ private:
+  RetainedDrawing retained_;
+};
+
 class BorderView : public CompositeSingleView {
  public:
   // padding is how many pixels between inner view and border.
@@ -414,26 +414,17 @@ void recompute_fog_for_player( SS& ss, TS& ts,
     }
   }
 
-  // Unfog the surroundings of units.
-  //
-  // FIXME: it's not ideal that we iterate over all euro units
-  // here because that includes the ones working in colonies that
-  // we don't want. It also would not be ideal to iterate over
-  // all units on the map because that would include all of the
-  // braves walking around which we don't want. Ideally we need
-  // to add a cache for euro units on the map, then we can it-
-  // erate over that only.
+  // Unfog the surroundings of the player's units on the map.
   timer.checkpoint( "de-fog unit surroundings" );
-  for( auto& [unit_id, p_state] : ss.units.euro_all() ) {
-    maybe<UnitOwnership::world const&> world =
-        p_state->ownership.get_if<UnitOwnership::world>();
-    if( !world.has_value() ) continue;
-    Unit const& unit = p_state->unit;
-    if( unit.player_type() != player ) continue;
+  for( UnitId const unit_id : ss.units.euro_units_for_player(
+           player, UnitOwnership::e::world ) ) {
+    UnitState::euro const& st = ss.units.state_of( unit_id );
+    UNWRAP_CHECK_T( UnitOwnership::world const& world,
+                    st.ownership.get_if<UnitOwnership::world>() );
     // This should not yield and squares that don't exist.
     vector<Coord> const visible = unit_visible_squares(
-        ss, ts.map_updater().connectivity(), player, unit.type(),
-        world->coord );
+        ss, ts.map_updater().connectivity(), player,
+        st.unit.type(), world.coord );
     for( point const coord : visible ) { fogged.erase( coord ); }
   }
 
@@ -202,12 +202,11 @@ struct WindowManager {
   int num_windows_created_ = 0;
 
   struct TransientMessage {
-    string msg;
-    double alpha               = 1.0;
-    TextReflowInfo reflow_info = {};
-    // This is stored here because it is expensive to compute; we
-    // don't want to do it every frame.
-    Delta rendered_size = {};
+    double alpha = 1.0;
+    // These are stored here because they are expensive to com-
+    // pute; we don't want to do it every frame.
+    ReflowedText reflowed = {};
+    Delta rendered_size   = {};
   };
 
   co::stream<string> transient_messages_ = {};
@@ -372,7 +371,6 @@ void WindowManager::draw_layout( rr::Renderer& renderer ) const {
     pw.win->draw( renderer, pw.pos );
 
   if( active_transient_message_.has_value() ) {
-    string_view const msg = active_transient_message_->msg;
     SCOPED_RENDERER_MOD_MUL( painter_mods.alpha,
                              active_transient_message_->alpha );
     auto const area = main_window_logical_rect(
@@ -393,10 +391,8 @@ void WindowManager::draw_layout( rr::Renderer& renderer ) const {
     TextMarkupInfo const markup_info{
       .shadow = gfx::pixel::black(),
     };
-    TextReflowInfo const& reflow_info =
-        active_transient_message_->reflow_info;
-    render_text_markup_reflow( renderer, start, e_font::habbo_15,
-                               markup_info, reflow_info, msg );
+    render_reflowed_text( renderer, start, markup_info,
+                          active_transient_message_->reflowed );
   }
 }
 
@@ -557,13 +553,13 @@ wait<> WindowManager::process_transient_messages() {
   while( true ) {
     string msg = co_await transient_messages_.next();
     TextReflowInfo const reflow_info{ .max_cols = 50 };
+    ReflowedText reflowed = reflow_text_markup( reflow_info, msg );
+    Delta const rendered_size = rendered_text_size(
+        engine_.textometer(), rr::TextLayout{}, reflowed );
     active_transient_message_ = {
-      .msg           = msg,
       .alpha         = 1.0,
-      .reflow_info   = reflow_info,
-      .rendered_size = rendered_text_size( engine_.textometer(),
-                                           rr::TextLayout{},
-                                           reflow_info, msg ) };
+      .reflowed      = std::move( reflowed ),
+      .rendered_size = rendered_size };
     SCOPE_EXIT { active_transient_message_.reset(); };
     double delta = .003;
     while( active_transient_message_->alpha > 0 ) {
@@ -726,7 +722,8 @@ namespace {
   ui::LineEditorView* p_le_view = le_view.get();
 
   vector<unique_ptr<ui::View>> view_vec;
-  view_vec.emplace_back( std::move( text ) );
+  view_vec.emplace_back(
+      make_unique<ui::RetainedView>( std::move( text ) ) );
   view_vec.emplace_back( std::move( le_view ) );
   auto va_view = make_unique<ui::VerticalArrayView>(
       std::move( view_vec ),
@@ -941,7 +938,8 @@ wait<maybe<int>> WindowPlane::select_box(
       make_unique<ui::TextView>( manager().engine().textometer(),
                                  string( msg ), m_info, r_info );
   vector<unique_ptr<ui::View>> vert_views;
-  vert_views.push_back( std::move( text_view ) );
+  vert_views.push_back(
+      make_unique<ui::RetainedView>( std::move( text_view ) ) );
   vert_views.push_back( std::move( on_input_view ) );
   auto va_view = make_unique<ui::VerticalArrayView>(
       std::move( vert_views ),
@@ -0,0 +1,157 @@
+/****************************************************************
+**anim-batch-test.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Unit tests for the src/anim-batch.* module.
+*
+*****************************************************************/
+#include "test/testing.hpp"
+
+// Under test.
+#include "src/anim-batch.hpp"
+
+// Testing.
+#include "test/mocking.hpp"
+#include "test/mocks/land-view-plane.hpp"
+
+// Revolution Now
+#include "src/anim-builders.hpp"
+#include "src/co-combinator.hpp"
+#include "src/co-scheduler.hpp"
+
+// Must be last.
+#include "test/catch-common.hpp" // IWYU pragma: keep
+
+namespace rn {
+namespace {
+
+using namespace std;
+
+using ::gfx::point;
+
+/****************************************************************
+** Test Cases
+*****************************************************************/
+TEST_CASE( "[anim-batch] independent moves" ) {
+  MockLandViewPlane land_view;
+  AnimationBatch batch( land_view );
+  GenericUnitId const id1{ 1 };
+  GenericUnitId const id2{ 2 };
+  wait_promise<> p1;
+  wait_promise<> p2;
+
+  land_view
+      .EXPECT__animate_if_visible( anim_seq_for_moved_unit(
+          id1, { .x = 0, .y = 0 }, e_direction::e ) )
+      .returns( p1.wait() );
+  batch.queue_move( id1, { .x = 0, .y = 0 }, e_direction::e );
+
+  land_view
+      .EXPECT__animate_if_visible( anim_seq_for_moved_unit(
+          id2, { .x = 5, .y = 5 }, e_direction::s ) )
+      .returns( p2.wait() );
+  batch.queue_move( id2, { .x = 5, .y = 5 }, e_direction::s );
+
+  wait<> const finished = batch.finish();
+  run_all_cpp_coroutines();
+  REQUIRE_FALSE( finished.ready() );
+
+  p2.set_value_emplace();
+  run_all_cpp_coroutines();
+  REQUIRE_FALSE( finished.ready() );
+
+  p1.set_value_emplace();
+  run_all_cpp_coroutines();
+  REQUIRE( finished.ready() );
+}
+
+TEST_CASE( "[anim-batch] same unit" ) {
+  MockLandViewPlane land_view;
+  AnimationBatch batch( land_view );
+  GenericUnitId const id{ 1 };
+  wait_promise<> p1;
+  wait_promise<> p2;
+
+  land_view
+      .EXPECT__animate_if_visible( anim_seq_for_moved_unit(
+          id, { .x = 0, .y = 0 }, e_direction::e ) )
+      .returns( p1.wait() );
+  batch.queue_move( id, { .x = 0, .y = 0 }, e_direction::e );
+  // The unit is already being animated, so no hiding.
+  batch.queue_move( id, { .x = 1, .y = 0 }, e_direction::e );
+  run_all_cpp_coroutines();
+
+  wait<> const finished = batch.finish_unit( id );
+  REQUIRE_FALSE( finished.ready() );
+
+  land_view
+      .EXPECT__animate_if_visible( anim_seq_for_moved_unit(
+          id, { .x = 1, .y = 0 }, e_direction::e ) )
+      .returns( p2.wait() );
+  p1.set_value_emplace();
+  run_all_cpp_coroutines();
+  REQUIRE_FALSE( finished.ready() );
+
+  p2.set_value_emplace();
+  run_all_cpp_coroutines();
+  REQUIRE( finished.ready() );
+  REQUIRE( batch.finish_unit( GenericUnitId{ 2 } ).ready() );
+}
+
+TEST_CASE( "[anim-batch] overlapping moves" ) {
+  MockLandViewPlane land_view;
+  AnimationBatch batch( land_view );
+  GenericUnitId const id1{ 1 };
+  GenericUnitId const id2{ 2 };
+  GenericUnitId const id3{ 3 };
+  wait_promise<> p1;
+  wait_promise<> p2;
+  wait_promise<> p3;
+
+  land_view
+      .EXPECT__animate_if_visible( anim_seq_for_moved_unit(
+          id1, { .x = 0, .y = 0 }, e_direction::e ) )
+      .returns( p1.wait() );
+  batch.queue_move( id1, { .x = 0, .y = 0 }, e_direction::e );
+
+  // This one moves onto the tile that the first one moved to,
+  // so it has to wait and be hidden in the mean time.
+  land_view
+      .EXPECT__animate_if_visible_and_hold(
+          anim_seq_unit_hidden( id2 ) )
+      .returns( co::halt() );
+  batch.queue_move( id2, { .x = 1, .y = 1 }, e_direction::n );
+
+  // This one doesn't touch the other two so it starts now.
+  land_view
+      .EXPECT__animate_if_visible( anim_seq_for_moved_unit(
+          id3, { .x = 3, .y = 3 }, e_direction::s ) )
+      .returns( p3.wait() );
+  batch.queue_move( id3, { .x = 3, .y = 3 }, e_direction::s );
+  run_all_cpp_coroutines();
+
+  wait<> const finished = batch.finish();
+  REQUIRE_FALSE( finished.ready() );
+
+  p3.set_value_emplace();
+  run_all_cpp_coroutines();
+  REQUIRE_FALSE( finished.ready() );
+
+  land_view
+      .EXPECT__animate_if_visible( anim_seq_for_moved_unit(
+          id2, { .x = 1, .y = 1 }, e_direction::n ) )
+      .returns( p2.wait() );
+  p1.set_value_emplace();
+  run_all_cpp_coroutines();
+  REQUIRE_FALSE( finished.ready() );
+
+  p2.set_value_emplace();
+  run_all_cpp_coroutines();
+  REQUIRE( finished.ready() );
+}
+
+} // namespace
+} // namespace rn
@@ -32,6 +32,9 @@
 #include "src/base/scope-exit.hpp"
 #include "src/base/to-str-ext-std.hpp"
 
+// C++ standard library
+#include <future>
+
 // Must be last.
 #include "test/catch-common.hpp" // IWYU pragma: keep
 
@@ -219,5 +222,40 @@ TEST_CASE( "[auto-save] autosave" ) {
   }
 }
 
+TEST_CASE( "[auto-save] AutosaveWorker" ) {
+  using result_t = AutosaveWorker::result_t;
+  AutosaveWorker worker;
+
+  REQUIRE( !worker.running() );
+  REQUIRE( worker.poll() == nothing );
+  REQUIRE( worker.wait() == nothing );
+
+  promise<void> go;
+  shared_future<void> const ready = go.get_future().share();
+  REQUIRE( worker.start( [ready]() -> result_t {
+    ready.wait();
+    return vector<fs::path>{ "abc" };
+  } ) == nothing );
+  REQUIRE( worker.running() );
+  REQUIRE( worker.poll() == nothing );
+  go.set_value();
+  REQUIRE( worker.wait() == vector<fs::path>{ "abc" } );
+  REQUIRE( !worker.running() );
+  // Only collected once.
+  REQUIRE( worker.wait() == nothing );
+
+  // Starting a new job waits for the previous one and hands back
+  // its result, including errors.
+  REQUIRE( worker.start( []() -> result_t {
+    return "failed";
+  } ) == nothing );
+  maybe<result_t> const prev = worker.start(
+      []() -> result_t { return vector<fs::path>{}; } );
+  REQUIRE( prev.has_value() );
+  REQUIRE( !prev->has_value() );
+  REQUIRE( prev->error() == "failed" );
+  REQUIRE( worker.wait() == vector<fs::path>{} );
+}
+
 } // namespace
 } // namespace rn
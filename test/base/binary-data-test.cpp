@@ -687,5 +687,108 @@ TEST_CASE( "[base/binary-data] FileBinaryIO write" ) {
   REQUIRE( two_numbers.remaining() == 0 );
 }
 
+TEST_CASE( "[base/binary-data] IBinaryIO [span]" ) {
+  array<unsigned char, 4> buffer = { 1, 2, 3, 4 };
+  MemBufferBinaryIO b( buffer );
+
+  array<unsigned char, 3> dst = {};
+  REQUIRE( b.read_bytes( span( dst ).first( 0 ) ) );
+  REQUIRE( b.pos() == 0 );
+  REQUIRE( b.read_bytes( span( dst ) ) );
+  REQUIRE( dst == array<unsigned char, 3>{ 1, 2, 3 } );
+  REQUIRE( b.pos() == 3 );
+  REQUIRE_FALSE( b.read_bytes( span( dst ).first( 2 ) ) );
+  REQUIRE( b.pos() == 3 );
+
+  array<unsigned char, 1> const src = { 9 };
+  REQUIRE( b.write_bytes( span( src ) ) );
+  REQUIRE( buffer == array<unsigned char, 4>{ 1, 2, 3, 9 } );
+  REQUIRE_FALSE( b.write_bytes( span( src ) ) );
+}
+
+TEST_CASE( "[base/binary-data] BufferBinaryIO" ) {
+  BufferBinaryIO b;
+  REQUIRE( b.eof() );
+  REQUIRE( b.pos() == 0 );
+  REQUIRE( b.size() == 0 );
+
+  uint8_t one_byte = 0;
+  REQUIRE_FALSE( b.read( one_byte ) );
+
+  // Writing grows the buffer.
+  uint16_t const two_bytes = 0x3355;
+  REQUIRE( b.write( two_bytes ) );
+  REQUIRE( b.eof() );
+  REQUIRE( b.pos() == 2 );
+  REQUIRE( b.size() == 2 );
+  REQUIRE( b.buffer() == vector<unsigned char>{ 0x55, 0x33 } );
+
+  uint8_t const another = 0x07;
+  REQUIRE( b.write( another ) );
+  REQUIRE( b.pos() == 3 );
+  REQUIRE( b.size() == 3 );
+  REQUIRE( b.buffer() ==
+           vector<unsigned char>{ 0x55, 0x33, 0x07 } );
+
+  BufferBinaryIO b2( vector<unsigned char>{ 1, 3, 2, 4, 7 } );
+  REQUIRE( b2.pos() == 0 );
+  REQUIRE( b2.size() == 5 );
+  uint16_t read_two = 0;
+  REQUIRE( b2.read( read_two ) );
+  REQUIRE( read_two == 0x0301 );
+  REQUIRE( b2.remaining() == 3 );
+
+  // Writing in the middle overwrites.
+  REQUIRE( b2.write( another ) );
+  REQUIRE( b2.size() == 5 );
+  REQUIRE( b2.buffer() ==
+           vector<unsigned char>{ 1, 3, 7, 4, 7 } );
+
+  // Writing past the end extends.
+  REQUIRE( b2.write( two_bytes ) );
+  REQUIRE( b2.write( two_bytes ) );
+  REQUIRE( b2.pos() == 7 );
+  REQUIRE( b2.size() == 7 );
+  REQUIRE( b2.buffer() ==
+           vector<unsigned char>{ 1, 3, 7, 0x55, 0x33, 0x55,
+                                  0x33 } );
+}
+
+TEST_CASE( "[base/binary-data] BufferBinaryIO read_file" ) {
+  expect<BufferBinaryIO, string> const nonexistent =
+      BufferBinaryIO::read_file( "does-not-exist-j89j9j" );
+  REQUIRE(
+      nonexistent ==
+      "failed to open file \"does-not-exist-j89j9j\" for reading."s );
+
+  auto bin_files = testing::data_dir() / "binary-files";
+  UNWRAP_CHECK( five_numbers,
+                BufferBinaryIO::read_file(
+                    bin_files / "five-numbers.bin" ) );
+  REQUIRE( five_numbers.pos() == 0 );
+  REQUIRE( five_numbers.size() == 5 );
+  REQUIRE( five_numbers.read_remainder() ==
+           vector<unsigned char>{ 1, 3, 2, 4, 7 } );
+  REQUIRE( five_numbers.eof() );
+}
+
+TEST_CASE( "[base/binary-data] BufferBinaryIO write_file" ) {
+  fs::path const tmp  = output_folder();
+  fs::path const file = tmp / "three-numbers.bin";
+
+  BufferBinaryIO b;
+  uint16_t const two_bytes = 0x3355;
+  uint8_t const one_byte   = 0x07;
+  REQUIRE( b.write( two_bytes ) );
+  REQUIRE( b.write( one_byte ) );
+  REQUIRE( b.write_file( file ) == valid );
+
+  UNWRAP_CHECK(
+      three_numbers,
+      FileBinaryIO::open_for_rw_fail_on_nonexist( file ) );
+  REQUIRE( three_numbers.read_remainder() ==
+           vector<unsigned char>{ 0x55, 0x33, 0x07 } );
+}
+
 } // namespace
 } // namespace base
@@ -116,5 +116,42 @@ TEST_CASE( "[base/fs] copy_file_overwriting_destination" ) {
   }
 }
 
+TEST_CASE( "[base/fs] rename_file_overwriting_destination" ) {
+  fs::path const tmpdir = fs::temp_directory_path();
+  fs::path const src    = tmpdir / "cdefghijk.txt";
+  fs::path const dst    = tmpdir / "defghijkl.txt";
+  if( fs::exists( src ) ) fs::remove( src );
+  if( fs::exists( dst ) ) fs::remove( dst );
+
+  auto f = [&] {
+    return rename_file_overwriting_destination( src, dst );
+  };
+
+  SECTION( "src not exist" ) {
+    auto const res = f();
+    REQUIRE( !res.valid() );
+    REQUIRE_THAT( res.error(),
+                  StartsWith( "failed to rename file" ) );
+    REQUIRE( !fs::exists( dst ) );
+  }
+
+  SECTION( "src exist, dst not exist" ) {
+    { ofstream{ src } << "abc"; }
+    REQUIRE( f() == valid );
+    REQUIRE( !fs::exists( src ) );
+    REQUIRE( fs::file_size( dst ) == 3 );
+  }
+
+  SECTION( "src exist, dst exist" ) {
+    { ofstream{ src } << "abc"; }
+    { ofstream{ dst }.put( 'a' ); }
+    REQUIRE( f() == valid );
+    REQUIRE( !fs::exists( src ) );
+    REQUIRE( fs::file_size( dst ) == 3 );
+  }
+
+  if( fs::exists( dst ) ) fs::remove( dst );
+}
+
 } // namespace
 } // namespace base
@@ -0,0 +1,93 @@
+/****************************************************************
+**parallel-test.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Unit tests for the base/parallel module.
+*
+*****************************************************************/
+#include "test/testing.hpp"
+
+// Under test.
+#include "src/base/parallel.hpp"
+
+// Must be last.
+#include "test/catch-common.hpp" // IWYU pragma: keep
+
+// C++ standard library.
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+namespace base {
+namespace {
+
+using namespace std;
+
+/****************************************************************
+** Test Cases
+*****************************************************************/
+TEST_CASE( "[base/parallel] default_parallelism" ) {
+  REQUIRE( default_parallelism() >= 1 );
+}
+
+TEST_CASE( "[base/parallel] parallel_for" ) {
+  int n           = 0;
+  int max_threads = 0;
+  vector<int> out;
+  atomic<int> calls = 0;
+
+  auto f = [&] {
+    out.assign( n, -1 );
+    calls = 0;
+    parallel_for(
+        n,
+        [&]( int const i ) {
+          out[i] = i * i;
+          ++calls;
+        },
+        max_threads );
+  };
+
+  auto expected = [&] {
+    vector<int> res;
+    for( int i = 0; i < n; ++i ) res.push_back( i * i );
+    return res;
+  };
+
+  for( int const threads : { 1, 2, 3, 8, 64 } ) {
+    max_threads = threads;
+
+    n = 0;
+    f();
+    REQUIRE( out.empty() );
+    REQUIRE( calls == 0 );
+
+    n = 1;
+    f();
+    REQUIRE( out == expected() );
+    REQUIRE( calls == 1 );
+
+    n = 1000;
+    f();
+    REQUIRE( out == expected() );
+    REQUIRE( calls == 1000 );
+  }
+}
+
+TEST_CASE( "[base/parallel] parallel_for rethrows" ) {
+  auto f = [] {
+    parallel_for(
+        100,
+        []( int const i ) {
+          if( i == 17 ) throw runtime_error( "bad index" );
+        },
+        4 );
+  };
+  REQUIRE_THROWS_WITH( f(), "bad index" );
+}
+
+} // namespace
+} // namespace base
@@ -264,5 +264,14 @@ TEST_CASE( "[cdr/ext-builtin] double from int" ) {
   REQUIRE( conv_from_bt<double>( conv, value{ n } ) == d );
 }
 
+TEST_CASE( "[cdr/ext-builtin] value" ) {
+  value const v = table{ { "a", 5 }, { "b", list{ "x", null } } };
+
+  REQUIRE( conv.to( v ) == v );
+  REQUIRE( conv_from_bt<value>( conv, v ) == v );
+  REQUIRE( conv_from_bt<value>( conv, value{ null } ) ==
+           value{ null } );
+}
+
 } // namespace
 } // namespace cdr
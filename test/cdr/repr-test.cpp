@@ -352,5 +352,52 @@ TEST_CASE( "[cdr] automatic operator[]" ) {
   REQUIRE( v["key"]["key2"].as<list>().size() == 6 );
 }
 
+TEST_CASE( "[cdr] table ordering" ) {
+  table t;
+  REQUIRE( t.emplace( "c", 3 ).second );
+  REQUIRE( t.emplace( "a", 1 ).second );
+  t["d"] = 4;
+  t["b"] = 2;
+  // Does not overwrite.
+  auto [it, inserted] = t.emplace( "a", 5 );
+  REQUIRE( !inserted );
+  REQUIRE( it->first == "a" );
+  REQUIRE( it->second == 1 );
+  t.insert( { "b", 6 } );
+  REQUIRE( t["b"] == 2 );
+
+  vector<string> keys;
+  for( auto const& [k, v] : t ) keys.push_back( k );
+  REQUIRE( keys == vector<string>{ "a", "b", "c", "d" } );
+  REQUIRE( base::to_str( t ) == "{a=1,b=2,c=3,d=4}" );
+
+  table const& ct = t;
+  REQUIRE( ct["c"] == 3 );
+  REQUIRE( ct["e"] == base::nothing );
+
+  // Insertion order does not matter for equality.
+  table const t2{
+    { "d", 4 }, { "c", 3 }, { "b", 2 }, { "a", 1 } };
+  REQUIRE( t2 == t );
+}
+
+TEST_CASE( "[cdr] table from entries" ) {
+  vector<table::entry_type> entries;
+  entries.emplace_back( "y", 1 );
+  entries.emplace_back( "x", 2 );
+  entries.emplace_back( "y", 3 );
+  entries.emplace_back( "w", 4 );
+  table const t( std::move( entries ) );
+  REQUIRE( t.size() == 3 );
+  // First duplicate wins, as with a map.
+  REQUIRE( base::to_str( t ) == "{w=4,x=2,y=1}" );
+  REQUIRE( t == table{ { "y", 1 }, { "x", 2 }, { "w", 4 } } );
+
+  map<string, value> m{ { "b", 1 }, { "a", 2 } };
+  REQUIRE( table( m ) == table{ { "a", 2 }, { "b", 1 } } );
+  REQUIRE( table( std::move( m ) ) ==
+           table{ { "a", 2 }, { "b", 1 } } );
+}
+
 } // namespace
 } // namespace cdr
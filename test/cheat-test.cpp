@@ -789,13 +789,14 @@ TEST_CASE( "[cheat] cheat_advance_colony_one_turn" ) {
   Colony& colony = w.add_colony( { .x = 1, .y = 1 } );
 
   auto const f = [&] [[clang::noinline]] {
-    cheat_advance_colony_one_turn( mock_colony_evolver, colony );
+    cheat_advance_colony_one_turn( w.ss(), mock_colony_evolver,
+                                   colony );
   };
 
   // The Eq-ref trick is to prevent the matcher from storing a
   // copy of the object, which it would still do with only ref.
   mock_colony_evolver.EXPECT__evolve_colony_one_turn(
-      Eq( ref( colony ) ) );
+      Eq( ref( colony ) ), _ );
   ++colony.id; // make sure the mock is not holding a copy.
   f();
 }
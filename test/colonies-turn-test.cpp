@@ -26,6 +26,9 @@
 // Revolution Now
 #include "src/icolony-evolve.rds.hpp"
 #include "src/plane-stack.hpp"
+#include "src/production-cache.hpp"
+#include "src/production.hpp"
+#include "src/ts.hpp"
 
 // ss
 #include "src/ss/player.rds.hpp"
@@ -114,7 +117,8 @@ TEST_CASE( "[colonies-turn] presents transient updates." ) {
       // Doesn't matter what this holds, only the count.
       ColonyEvolution const evolution{ .notifications = { {} } };
       mock_colony_evolver
-          .EXPECT__evolve_colony_one_turn( Eq( ref( colony ) ) )
+          .EXPECT__evolve_colony_one_turn( Eq( ref( colony ) ),
+                                           _ )
           .returns( evolution );
       mock_colony_notification_generator
           .EXPECT__generate_colony_notification_message(
@@ -137,7 +141,8 @@ TEST_CASE( "[colonies-turn] presents transient updates." ) {
       ColonyEvolution const evolution{
         .notifications = { {}, {} } };
       mock_colony_evolver
-          .EXPECT__evolve_colony_one_turn( Eq( ref( colony ) ) )
+          .EXPECT__evolve_colony_one_turn( Eq( ref( colony ) ),
+                                           _ )
           .returns( evolution );
       mock_colony_notification_generator
           .EXPECT__generate_colony_notification_message(
@@ -238,7 +243,7 @@ TEST_CASE(
   ColonyEvolution const evolution{
     .production = { .crosses = 5 } };
   mock_colony_evolver
-      .EXPECT__evolve_colony_one_turn( Eq( ref( colony ) ) )
+      .EXPECT__evolve_colony_one_turn( Eq( ref( colony ) ), _ )
       .returns( evolution );
 
   SECTION( "before declaration" ) {
@@ -253,5 +258,131 @@ TEST_CASE(
   }
 }
 
+TEST_CASE(
+    "[colonies-turn] passes precomputed production to evolver" ) {
+  world w;
+  MockIColonyEvolver mock_colony_evolver;
+  MockIColonyNotificationGenerator
+      mock_colony_notification_generator;
+
+  MockLandViewPlane land_view_plane;
+  w.planes().get().set_bottom<ILandViewPlane>( land_view_plane );
+
+  MockIHarborViewer harbor_viewer;
+
+  auto const evolve_colonies = [&] {
+    co_await_test( evolve_colonies_for_player(
+        w.ss(), w.ts(), w.rand(), w.default_player(),
+        mock_colony_evolver, harbor_viewer,
+        mock_colony_notification_generator ) );
+  };
+
+  // Enough colonies that the production gets computed in paral-
+  // lel, each with a different production.
+  vector<point> const kPoints{
+    { .x = 1, .y = 1 }, { .x = 3, .y = 1 }, { .x = 5, .y = 1 },
+    { .x = 1, .y = 3 }, { .x = 3, .y = 3 }, { .x = 5, .y = 3 },
+    { .x = 1, .y = 5 }, { .x = 3, .y = 5 }, { .x = 5, .y = 5 },
+    { .x = 4, .y = 4 } };
+  vector<ColonyId> colony_ids;
+  for( point const p : kPoints ) {
+    Colony& colony = w.add_colony( p );
+    int const n = colony_ids.size();
+    for( int i = 0; i < n % 4; ++i )
+      w.add_unit_indoors( colony.id, e_indoor_job::bells );
+    for( int i = 0; i < n % 3; ++i )
+      w.add_unit_indoors( colony.id, e_indoor_job::hammers );
+    colony_ids.push_back( colony.id );
+  }
+
+  for( ColonyId const colony_id : colony_ids ) {
+    Colony& colony = w.colonies().colony_for( colony_id );
+    ColonyProduction const expected =
+        production_for_colony( w.ss(), colony );
+    mock_colony_evolver
+        .EXPECT__evolve_colony_one_turn( Eq( ref( colony ) ),
+                                         expected )
+        .returns( ColonyEvolution{} );
+  }
+
+  evolve_colonies();
+}
+
+TEST_CASE(
+    "[colonies-turn] production cache hits on the next turn" ) {
+  world w;
+  MockIColonyEvolver mock_colony_evolver;
+  MockIColonyNotificationGenerator
+      mock_colony_notification_generator;
+
+  MockLandViewPlane land_view_plane;
+  w.planes().get().set_bottom<ILandViewPlane>( land_view_plane );
+
+  MockIHarborViewer harbor_viewer;
+
+  ColonyProductionCache& cache =
+      w.ts().colony_production_cache();
+
+  auto const evolve_colonies = [&] {
+    co_await_test( evolve_colonies_for_player(
+        w.ss(), w.ts(), w.rand(), w.default_player(),
+        mock_colony_evolver, harbor_viewer,
+        mock_colony_notification_generator ) );
+  };
+
+  vector<ColonyId> colony_ids;
+  for( point const p : vector<point>{ { .x = 1, .y = 1 },
+                                      { .x = 4, .y = 4 } } ) {
+    Colony& colony = w.add_colony( p );
+    w.add_unit_outdoors( colony.id, e_direction::s,
+                         e_outdoor_job::food );
+    w.add_unit_indoors( colony.id, e_indoor_job::hammers );
+    colony_ids.push_back( colony.id );
+  }
+
+  auto const expect_evolve = [&] {
+    for( ColonyId const colony_id : colony_ids ) {
+      Colony& colony = w.colonies().colony_for( colony_id );
+      mock_colony_evolver
+          .EXPECT__evolve_colony_one_turn(
+              Eq( ref( colony ) ),
+              production_for_colony( w.ss(), colony ) )
+          .returns( ColonyEvolution{} );
+    }
+  };
+
+  // Turn 1.
+  expect_evolve();
+  evolve_colonies();
+  REQUIRE( cache.size() == 2 );
+  REQUIRE( cache.hits() == 0 );
+
+  // Simulate what evolving the colonies would do to them, which
+  // should not invalidate the cache.
+  for( ColonyId const colony_id : colony_ids ) {
+    Colony& colony = w.colonies().colony_for( colony_id );
+    colony.commodities[e_commodity::food] += 5;
+    colony.commodities[e_commodity::lumber] += 3;
+    colony.sons_of_liberty.num_rebels_from_bells_only += .01;
+  }
+
+  // Turn 2.
+  expect_evolve();
+  evolve_colonies();
+  REQUIRE( cache.size() == 2 );
+  REQUIRE( cache.hits() == 2 );
+
+  // A unit moved to a different square in one colony.
+  Colony& colony = w.colonies().colony_for( colony_ids[0] );
+  swap( colony.outdoor_jobs[e_direction::s],
+        colony.outdoor_jobs[e_direction::e] );
+
+  // Turn 3.
+  expect_evolve();
+  evolve_colonies();
+  REQUIRE( cache.size() == 2 );
+  REQUIRE( cache.hits() == 3 );
+}
+
 } // namespace
 } // namespace rn
@@ -0,0 +1,353 @@
+/****************************************************************
+**combat-odds-test.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Unit tests for the src/combat-odds.* module.
+*
+*****************************************************************/
+#include "test/testing.hpp"
+
+// Under test.
+#include "src/combat-odds.hpp"
+
+// Testing
+#include "test/fake/world.hpp"
+
+// Revolution Now
+#include "src/combat.hpp"
+#include "src/icombat.rds.hpp"
+#include "src/rand.hpp"
+
+// ss
+#include "src/ss/dwelling.rds.hpp"
+#include "src/ss/native-unit.rds.hpp"
+#include "src/ss/player.rds.hpp"
+#include "src/ss/unit.hpp"
+
+// refl
+#include "src/refl/to-str.hpp"
+
+// Must be last.
+#include "test/catch-common.hpp"
+
+namespace rn {
+namespace {
+
+using namespace std;
+
+using ::Catch::Approx;
+
+/****************************************************************
+** Fake World Setup
+*****************************************************************/
+struct World : testing::World {
+  using Base = testing::World;
+  World() : Base() {
+    add_player( e_player::english );
+    add_player( e_player::french );
+    set_default_player_type( e_player::english );
+    create_default_map();
+  }
+
+  void create_default_map() {
+    MapSquare const _ = make_ocean();
+    MapSquare const L = make_grassland();
+    vector<MapSquare> tiles{
+      _, L, _, //
+      L, L, L, //
+      _, L, L, //
+      _, _, _, //
+    };
+    build_map( std::move( tiles ), 3 );
+  }
+};
+
+/****************************************************************
+** Monte-Carlo helpers.
+*****************************************************************/
+// Number of battles to simulate for each comparison. With this
+// many, a probability of 1/2 will have a standard deviation of
+// 0.005 in its observed frequency.
+int constexpr kTrials = 10'000;
+
+// Allowed difference between observed frequencies and the odds;
+// four standard deviations at worst.
+double constexpr kTolerance = 0.02;
+
+void tally( CombatOutcomeOdds& o,
+            EuroUnitCombatOutcome const& outcome ) {
+  switch( outcome.to_enum() ) {
+    using e = EuroUnitCombatOutcome::e;
+    case e::no_change:
+      ++o.no_change;
+      break;
+    case e::destroyed:
+      ++o.destroyed;
+      break;
+    case e::captured:
+    case e::captured_and_demoted:
+      ++o.captured;
+      break;
+    case e::promoted:
+      ++o.promoted;
+      break;
+    case e::demoted:
+      ++o.demoted;
+      break;
+  }
+}
+
+void tally( CombatOutcomeOdds& o,
+            NativeUnitCombatOutcome const& outcome ) {
+  switch( outcome.to_enum() ) {
+    using e = NativeUnitCombatOutcome::e;
+    case e::no_change:
+      ++o.no_change;
+      break;
+    case e::destroyed:
+      ++o.destroyed;
+      break;
+    case e::promoted:
+      ++o.promoted;
+      break;
+  }
+}
+
+void tally( CombatOutcomeOdds& o,
+            EuroNavalUnitCombatOutcome const& outcome ) {
+  switch( outcome.to_enum() ) {
+    using e = EuroNavalUnitCombatOutcome::e;
+    case e::no_change:
+    case e::moved:
+      ++o.no_change;
+      break;
+    case e::sunk:
+      ++o.destroyed;
+      break;
+    case e::damaged:
+      ++o.damaged;
+      break;
+  }
+}
+
+void tally_winner( CombatOdds& o,
+                   maybe<e_combat_winner> const winner ) {
+  if( !winner.has_value() )
+    ++o.evaded;
+  else if( *winner == e_combat_winner::attacker )
+    ++o.attacker_wins;
+  else
+    ++o.defender_wins;
+}
+
+void check_outcome( CombatOutcomeOdds const& observed,
+                    CombatOutcomeOdds const& odds ) {
+  auto const near = [&]( double const count ) {
+    return Approx( count / kTrials ).margin( kTolerance );
+  };
+  REQUIRE( odds.no_change == near( observed.no_change ) );
+  REQUIRE( odds.promoted == near( observed.promoted ) );
+  REQUIRE( odds.demoted == near( observed.demoted ) );
+  REQUIRE( odds.captured == near( observed.captured ) );
+  REQUIRE( odds.damaged == near( observed.damaged ) );
+  REQUIRE( odds.destroyed == near( observed.destroyed ) );
+}
+
+void check_odds( CombatOdds const& observed,
+                 CombatOdds const& odds ) {
+  auto const near = [&]( double const count ) {
+    return Approx( count / kTrials ).margin( kTolerance );
+  };
+  REQUIRE( odds.evaded == near( observed.evaded ) );
+  REQUIRE( odds.attacker_wins ==
+           near( observed.attacker_wins ) );
+  REQUIRE( odds.defender_wins ==
+           near( observed.defender_wins ) );
+  check_outcome( observed.attacker, odds.attacker );
+  check_outcome( observed.defender, odds.defender );
+}
+
+double total( CombatOutcomeOdds const& o ) {
+  return o.no_change + o.promoted + o.demoted + o.captured +
+         o.damaged + o.destroyed;
+}
+
+/****************************************************************
+** Test Cases
+*****************************************************************/
+TEST_CASE( "[combat-odds] attacker_win_probability" ) {
+  REQUIRE( attacker_win_probability( 2, 2 ) == .5 );
+  REQUIRE( attacker_win_probability( 3, 1 ) == .75 );
+  REQUIRE( attacker_win_probability( 0, 1 ) == 0.0 );
+  REQUIRE( attacker_win_probability( 1, 0 ) == 1.0 );
+  REQUIRE( attacker_win_probability( 0, 0 ) == 1.0 );
+}
+
+TEST_CASE( "[combat-odds] combat_promotion_odds" ) {
+  World W;
+  Unit const& soldier = W.add_unit_on_map(
+      e_unit_type::soldier, { .x = 1, .y = 0 } );
+  Unit const& colonist = W.add_unit_on_map(
+      e_unit_type::free_colonist, { .x = 1, .y = 1 } );
+
+  REQUIRE( combat_promotion_odds( W.ss(), colonist ) ==
+           nothing );
+  maybe<CombatPromotionOdds> odds =
+      combat_promotion_odds( W.ss(), soldier );
+  REQUIRE( odds.has_value() );
+  REQUIRE( odds->to.type() == e_unit_type::veteran_soldier );
+  REQUIRE( odds->roll == .45 );
+
+  // Promotions are certain with George Washington.
+  W.english().fathers.has[e_founding_father::george_washington] =
+      true;
+  odds = combat_promotion_odds( W.ss(), soldier );
+  REQUIRE( odds.has_value() );
+  REQUIRE( odds->to.type() == e_unit_type::veteran_soldier );
+  REQUIRE( odds->roll == nothing );
+}
+
+TEST_CASE( "[combat-odds] euro attack euro" ) {
+  World W;
+  Unit const& attacker = W.add_unit_on_map(
+      e_unit_type::soldier, { .x = 1, .y = 0 } );
+  Unit const& defender =
+      W.add_unit_on_map( e_unit_type::free_colonist,
+                         { .x = 1, .y = 1 }, e_player::french );
+
+  CombatOdds const odds = combat_odds(
+      W.ss(), CombatOddsQuery{ .attacker = attacker.id(),
+                               .defender = defender.id() } );
+  REQUIRE( odds.evaded == 0.0 );
+  REQUIRE( odds.attacker_wins == Approx( 2.0 / 3.0 ) );
+  REQUIRE( odds.defender_wins == Approx( 1.0 / 3.0 ) );
+  REQUIRE( odds.attacker.promoted == Approx( 2.0 / 3.0 * .45 ) );
+  REQUIRE( odds.attacker.no_change ==
+           Approx( 2.0 / 3.0 * .55 ) );
+  REQUIRE( odds.attacker.demoted == Approx( 1.0 / 3.0 ) );
+  REQUIRE( total( odds.attacker ) == Approx( 1.0 ) );
+  // A colonist cannot be promoted and gets captured.
+  REQUIRE( odds.defender.no_change == Approx( 1.0 / 3.0 ) );
+  REQUIRE( odds.defender.captured == Approx( 2.0 / 3.0 ) );
+  REQUIRE( total( odds.defender ) == Approx( 1.0 ) );
+
+  Rand rand;
+  RealCombat combat( W.ss(), rand );
+  CombatOdds observed;
+  for( int i = 0; i < kTrials; ++i ) {
+    CombatEuroAttackEuro const res =
+        combat.euro_attack_euro( attacker, defender );
+    tally_winner( observed, res.winner );
+    tally( observed.attacker, res.attacker.outcome );
+    tally( observed.defender, res.defender.outcome );
+  }
+  check_odds( observed, odds );
+}
+
+TEST_CASE( "[combat-odds] euro attack brave" ) {
+  World W;
+  Dwelling const& dwelling =
+      W.add_dwelling( { .x = 2, .y = 1 }, e_tribe::arawak );
+  Unit const& attacker = W.add_unit_on_map(
+      e_unit_type::scout, { .x = 1, .y = 0 } );
+  NativeUnit const& defender = W.add_native_unit_on_map(
+      e_native_unit_type::brave, { .x = 1, .y = 1 },
+      dwelling.id );
+
+  CombatOdds const odds = combat_odds(
+      W.ss(), CombatOddsQuery{ .attacker = attacker.id(),
+                               .defender = defender.id } );
+  REQUIRE( total( odds.attacker ) == Approx( 1.0 ) );
+  REQUIRE( total( odds.defender ) == Approx( 1.0 ) );
+  REQUIRE( odds.defender.destroyed == odds.attacker_wins );
+
+  Rand rand;
+  RealCombat combat( W.ss(), rand );
+  CombatOdds observed;
+  for( int i = 0; i < kTrials; ++i ) {
+    CombatEuroAttackBrave const res =
+        combat.euro_attack_brave( attacker, defender );
+    tally_winner( observed, res.winner );
+    tally( observed.attacker, res.attacker.outcome );
+    tally( observed.defender, res.defender.outcome );
+  }
+  check_odds( observed, odds );
+}
+
+TEST_CASE( "[combat-odds] ship attack ship" ) {
+  World W;
+  Unit const& attacker = W.add_unit_on_map(
+      e_unit_type::privateer, { .x = 0, .y = 3 } );
+  Unit const& defender =
+      W.add_unit_on_map( e_unit_type::merchantman,
+                         { .x = 1, .y = 3 }, e_player::french );
+
+  CombatOdds const odds = combat_odds(
+      W.ss(), CombatOddsQuery{ .attacker = attacker.id(),
+                               .defender = defender.id() } );
+  REQUIRE( odds.evaded == Approx( .25 ) );
+  REQUIRE( odds.attacker_wins == Approx( .75 * 8.0 / 14.0 ) );
+  REQUIRE( odds.defender_wins == Approx( .75 * 6.0 / 14.0 ) );
+  REQUIRE( odds.evaded + odds.attacker_wins +
+               odds.defender_wins ==
+           Approx( 1.0 ) );
+  REQUIRE( odds.attacker.destroyed ==
+           Approx( odds.defender_wins / 13.0 ) );
+  REQUIRE( odds.attacker.damaged ==
+           Approx( odds.defender_wins * 12.0 / 13.0 ) );
+  REQUIRE( total( odds.attacker ) == Approx( 1.0 ) );
+  REQUIRE( total( odds.defender ) == Approx( 1.0 ) );
+
+  Rand rand;
+  RealCombat combat( W.ss(), rand );
+  CombatOdds observed;
+  for( int i = 0; i < kTrials; ++i ) {
+    CombatShipAttackShip const res =
+        combat.ship_attack_ship( attacker, defender );
+    tally_winner( observed, res.winner );
+    tally( observed.attacker, res.attacker.outcome );
+    tally( observed.defender, res.defender.outcome );
+  }
+  check_odds( observed, odds );
+}
+
+TEST_CASE( "[combat-odds] batched" ) {
+  World W;
+  Dwelling const& dwelling =
+      W.add_dwelling( { .x = 2, .y = 1 }, e_tribe::arawak );
+  Unit const& soldier = W.add_unit_on_map(
+      e_unit_type::soldier, { .x = 1, .y = 0 } );
+  Unit const& dragoon = W.add_unit_on_map(
+      e_unit_type::dragoon, { .x = 1, .y = 0 } );
+  Unit const& colonist =
+      W.add_unit_on_map( e_unit_type::free_colonist,
+                         { .x = 1, .y = 1 }, e_player::french );
+  NativeUnit const& brave = W.add_native_unit_on_map(
+      e_native_unit_type::brave, { .x = 2, .y = 2 },
+      dwelling.id );
+
+  vector<CombatOddsQuery> const queries{
+    { .attacker = soldier.id(), .defender = colonist.id() },
+    { .attacker = soldier.id(), .defender = brave.id },
+    { .attacker = dragoon.id(), .defender = colonist.id() },
+    { .attacker = dragoon.id(), .defender = brave.id },
+  };
+
+  vector<CombatOdds> const batched =
+      combat_odds( W.ss(), queries );
+  REQUIRE( batched.size() == queries.size() );
+  for( int i = 0; i < ssize( queries ); ++i ) {
+    INFO( fmt::format( "i={}", i ) );
+    REQUIRE( batched[i] == combat_odds( W.ss(), queries[i] ) );
+  }
+  REQUIRE( batched[2].attacker_wins >
+           batched[0].attacker_wins );
+  REQUIRE( combat_odds( W.ss(), vector<CombatOddsQuery>{} )
+               .empty() );
+}
+
+} // namespace
+} // namespace rn
@@ -0,0 +1,46 @@
+/****************************************************************
+**renderer.hpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-19.
+*
+* Description: Real renderer on top of a mocked OpenGL.
+*
+*****************************************************************/
+#pragma once
+
+// Testing
+#include "test/mocks/gl/iface.hpp"
+
+// C++ standard library
+#include <memory>
+
+namespace rr {
+
+struct Renderer;
+
+/****************************************************************
+** FakeRenderer
+*****************************************************************/
+// Creates a real renderer on top of a mocked OpenGL, expecting
+// all of the OpenGL calls that are made when creating and de-
+// stroying it. The renderer can then be used for anything that
+// does not talk to the GPU (e.g. emitting and capturing ver-
+// tices); tests that need more can add their own expectations
+// to the mock.
+struct FakeRenderer {
+  FakeRenderer();
+
+  ~FakeRenderer();
+
+  gl::MockOpenGL& mock() { return mock_; }
+
+  Renderer& renderer() { return *renderer_; }
+
+ private:
+  gl::MockOpenGL mock_;
+  std::unique_ptr<Renderer> renderer_;
+};
+
+} // namespace rr
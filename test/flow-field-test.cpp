@@ -0,0 +1,156 @@
+/****************************************************************
+**flow-field-test.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Unit tests for the src/flow-field.* module.
+*
+*****************************************************************/
+#include "test/testing.hpp"
+
+// Under test.
+#include "src/flow-field.hpp"
+
+// Testing.
+#include "test/fake/world.hpp"
+
+// Revolution Now
+#include "src/goto-viewer.hpp"
+#include "src/goto.hpp"
+#include "src/visibility.hpp"
+
+// ss
+#include "src/ss/ref.hpp"
+#include "src/ss/terrain.hpp"
+
+// refl
+#include "src/refl/to-str.hpp"
+
+// Must be last.
+#include "test/catch-common.hpp" // IWYU pragma: keep
+
+namespace rn {
+namespace {
+
+using namespace std;
+
+using ::gfx::point;
+
+/****************************************************************
+** Fake World Setup
+*****************************************************************/
+struct world : testing::World {
+  world() {
+    add_player( e_player::dutch );
+    set_default_player_type( e_player::dutch );
+  }
+
+  void create_island_map() {
+    MapSquare const _ = make_ocean();
+    MapSquare const L = make_grassland();
+    vector<MapSquare> tiles{
+      L, L, _, L, L, L, //
+      L, L, _, L, L, L, //
+      _, _, _, L, L, L, //
+      L, L, L, L, L, L, //
+      L, L, L, L, L, L, //
+      L, L, L, L, L, L, //
+    };
+    build_map( std::move( tiles ), 6 );
+  }
+
+  void create_ocean_map() {
+    MapSquare const _ = make_ocean();
+    vector<MapSquare> tiles{
+      _, _, _, _, _, _, _, //
+      _, _, _, _, _, _, _, //
+      _, _, _, _, _, _, _, //
+    };
+    build_map( std::move( tiles ), 7 );
+  }
+};
+
+/****************************************************************
+** Test Cases
+*****************************************************************/
+TEST_CASE( "[flow-field] compute_flow_field" ) {
+  world w;
+  w.create_island_map();
+
+  VisibilityEntire const viz( w.ss() );
+  GotoMapViewer const viewer( w.ss(), viz, e_player::dutch,
+                              e_unit_type::free_colonist );
+
+  point const dst{ .x = 4, .y = 4 };
+  FlowField const field = compute_flow_field(
+      viewer, w.ss().terrain.world_size_tiles(), dst );
+
+  REQUIRE( field.cost_from( dst ) == 0 );
+  REQUIRE( field.direction_from( dst ) == nothing );
+  REQUIRE( field.direction_from( { .x = 5, .y = 5 } ) ==
+           e_direction::nw );
+  REQUIRE( field.direction_from( { .x = 3, .y = 3 } ) ==
+           e_direction::se );
+  REQUIRE( field.cost_from( { .x = 5, .y = 5 } ) ==
+           field.cost_from( { .x = 3, .y = 3 } ) );
+
+  // Cardinal moves are preferred when costs are equal.
+  REQUIRE( field.direction_from( { .x = 4, .y = 0 } ) ==
+           e_direction::s );
+
+  // Off of the map.
+  REQUIRE( field.cost_from( { .x = 6, .y = 0 } ) == nothing );
+  REQUIRE( field.direction_from( { .x = 6, .y = 0 } ) ==
+           nothing );
+
+  // Cut off by water.
+  REQUIRE( field.cost_from( { .x = 0, .y = 0 } ) == nothing );
+  REQUIRE( field.path_from( { .x = 0, .y = 0 } ) == nothing );
+
+  // The paths are as long as the searched ones.
+  point const src{ .x = 0, .y = 3 };
+  UNWRAP_CHECK( path, field.path_from( src ) );
+  GotoPath const searched =
+      compute_goto_path( viewer, src, dst );
+  REQUIRE( path.reverse_path.size() == 4 );
+  REQUIRE( searched.reverse_path.size() == 4 );
+  REQUIRE( path.reverse_path[0] == dst );
+  REQUIRE( path.reverse_path.back() ==
+           src.moved( *field.direction_from( src ) ) );
+
+  // Already at the destination.
+  UNWRAP_CHECK( empty_path, field.path_from( dst ) );
+  REQUIRE( empty_path.reverse_path.empty() );
+}
+
+TEST_CASE( "[flow-field] compute_harbor_flow_field" ) {
+  world w;
+  w.create_ocean_map();
+
+  VisibilityEntire const viz( w.ss() );
+  GotoMapViewer const viewer( w.ss(), viz, e_player::dutch,
+                              e_unit_type::caravel );
+
+  FlowField const field = compute_harbor_flow_field(
+      viewer, w.ss().terrain.world_size_tiles() );
+
+  // Both map edges are launch points.
+  REQUIRE( field.cost_from( { .x = 0, .y = 1 } ) == 0 );
+  REQUIRE( field.cost_from( { .x = 6, .y = 1 } ) == 0 );
+  REQUIRE( field.direction_from( { .x = 1, .y = 2 } ) ==
+           e_direction::w );
+
+  point const src{ .x = 4, .y = 1 };
+  UNWRAP_CHECK( path, field.path_from( src ) );
+  GotoPath const searched =
+      compute_harbor_goto_path( viewer, src );
+  vector<point> const expected{ { .x = 6, .y = 1 },
+                                { .x = 5, .y = 1 } };
+  REQUIRE( path.reverse_path == expected );
+  REQUIRE( searched.reverse_path == expected );
+}
+
+} // namespace
+} // namespace rn
@@ -0,0 +1,178 @@
+/****************************************************************
+**vertex-ring.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Unit tests for the src/gl/vertex-ring.* module.
+*
+*****************************************************************/
+#include "test/mocking.hpp"
+#include "test/testing.hpp"
+
+// Under test.
+#include "src/gl/vertex-ring.hpp"
+
+// Testing
+#include "test/mocks/gl/iface.hpp"
+
+// Must be last.
+#include "test/catch-common.hpp"
+
+namespace gl {
+namespace {
+
+using namespace std;
+
+using namespace ::mock::matchers;
+
+struct Vertex {
+  float x = 0;
+  float y = 0;
+};
+
+GLbitfield constexpr kMapFlags = GL_MAP_WRITE_BIT |
+                                 GL_MAP_INVALIDATE_RANGE_BIT |
+                                 GL_MAP_UNSYNCHRONIZED_BIT;
+
+GLsync fake_sync( intptr_t const n ) {
+  return reinterpret_cast<GLsync>( n );
+}
+
+vector<Vertex> make_vertices( int const n, float const start ) {
+  vector<Vertex> res( n );
+  for( int i = 0; i < n; ++i )
+    res[i] = Vertex{ .x = start + i, .y = -( start + i ) };
+  return res;
+}
+
+TEST_CASE( "[gl/vertex-ring] upload" ) {
+  gl::MockOpenGL mock;
+
+  mock.EXPECT__gl_GetError().by_default().returns( GL_NO_ERROR );
+
+  mock.EXPECT__gl_GenBuffers( 1, Not( Null() ) )
+      .sets_arg<1>( 42 );
+  mock.EXPECT__gl_DeleteBuffers( 1, Pointee( 42 ) );
+  VertexBuffer<Vertex> buf;
+  VertexRing<Vertex> ring;
+
+  auto expect_bind_unbind = [&] {
+    mock.EXPECT__gl_GetIntegerv( GL_ARRAY_BUFFER_BINDING,
+                                 Not( Null() ) )
+        .sets_arg<1>( 41 );
+    mock.EXPECT__gl_BindBuffer( GL_ARRAY_BUFFER, 42 );
+    mock.EXPECT__gl_GetIntegerv( GL_ARRAY_BUFFER_BINDING,
+                                 Not( Null() ) )
+        .sets_arg<1>( 42 );
+    mock.EXPECT__gl_BindBuffer( GL_ARRAY_BUFFER, 41 );
+    mock.EXPECT__gl_GetIntegerv( GL_ARRAY_BUFFER_BINDING,
+                                 Not( Null() ) )
+        .sets_arg<1>( 41 );
+  };
+
+  // Stands in for the GPU buffer.
+  vector<Vertex> mapped( 60 );
+
+  REQUIRE( ring.region() == 0 );
+  REQUIRE( ring.region_capacity_bytes() == 0 );
+
+  // First upload allocates the buffer.
+  vector<Vertex> const v1 = make_vertices( 10, 1 );
+  expect_bind_unbind();
+  mock.EXPECT__gl_BufferData( GL_ARRAY_BUFFER,
+                              3 * 10 * sizeof( Vertex ), Null(),
+                              GL_STREAM_DRAW );
+  expect_bind_unbind();
+  mock.EXPECT__gl_MapBufferRange( GL_ARRAY_BUFFER, 0,
+                                  10 * sizeof( Vertex ), kMapFlags )
+      .returns( static_cast<void*>( &mapped[0] ) );
+  mock.EXPECT__gl_UnmapBuffer( GL_ARRAY_BUFFER ).returns( GL_TRUE );
+  REQUIRE( ring.upload( buf, v1 ) == 0 );
+  REQUIRE( ring.region() == 0 );
+  REQUIRE( ring.region_capacity_bytes() == 10 * sizeof( Vertex ) );
+  REQUIRE( mapped[0].x == 1 );
+  REQUIRE( mapped[9].x == 10 );
+  REQUIRE( mapped[9].y == -10 );
+
+  mock.EXPECT__gl_FenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 )
+      .returns( fake_sync( 1 ) );
+  ring.fence();
+
+  // Second upload goes into the next region.
+  vector<Vertex> const v2 = make_vertices( 5, 100 );
+  expect_bind_unbind();
+  mock.EXPECT__gl_MapBufferRange( GL_ARRAY_BUFFER,
+                                  10 * sizeof( Vertex ),
+                                  5 * sizeof( Vertex ), kMapFlags )
+      .returns( static_cast<void*>( &mapped[10] ) );
+  mock.EXPECT__gl_UnmapBuffer( GL_ARRAY_BUFFER ).returns( GL_TRUE );
+  REQUIRE( ring.upload( buf, v2 ) == 10 );
+  REQUIRE( ring.region() == 1 );
+  REQUIRE( mapped[10].x == 100 );
+  REQUIRE( mapped[14].x == 104 );
+  // Previous region untouched.
+  REQUIRE( mapped[9].x == 10 );
+
+  mock.EXPECT__gl_FenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 )
+      .returns( fake_sync( 2 ) );
+  ring.fence();
+
+  // An empty upload maps nothing and needs no fence.
+  REQUIRE( ring.upload( buf, span<Vertex const>{} ) == 20 );
+  REQUIRE( ring.region() == 2 );
+  ring.fence();
+
+  // Wrapping around to the first region must wait on its fence.
+  vector<Vertex> const v3 = make_vertices( 2, 7 );
+  mock.EXPECT__gl_ClientWaitSync( fake_sync( 1 ),
+                                  GL_SYNC_FLUSH_COMMANDS_BIT, _ )
+      .returns( GL_TIMEOUT_EXPIRED );
+  mock.EXPECT__gl_ClientWaitSync( fake_sync( 1 ),
+                                  GL_SYNC_FLUSH_COMMANDS_BIT, _ )
+      .returns( GL_CONDITION_SATISFIED );
+  mock.EXPECT__gl_DeleteSync( fake_sync( 1 ) );
+  expect_bind_unbind();
+  mock.EXPECT__gl_MapBufferRange( GL_ARRAY_BUFFER, 0,
+                                  2 * sizeof( Vertex ), kMapFlags )
+      .returns( static_cast<void*>( &mapped[0] ) );
+  mock.EXPECT__gl_UnmapBuffer( GL_ARRAY_BUFFER ).returns( GL_TRUE );
+  REQUIRE( ring.upload( buf, v3 ) == 0 );
+  REQUIRE( ring.region() == 0 );
+  REQUIRE( mapped[0].x == 7 );
+  REQUIRE( mapped[1].x == 8 );
+  REQUIRE( mapped[2].x == 3 );
+
+  mock.EXPECT__gl_FenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 )
+      .returns( fake_sync( 3 ) );
+  ring.fence();
+
+  // Outgrowing the regions orphans the buffer, dropping all of
+  // the fences, and at least doubles the region size.
+  vector<Vertex> const v4 = make_vertices( 11, 50 );
+  mock.EXPECT__gl_DeleteSync( fake_sync( 3 ) );
+  mock.EXPECT__gl_DeleteSync( fake_sync( 2 ) );
+  expect_bind_unbind();
+  mock.EXPECT__gl_BufferData( GL_ARRAY_BUFFER,
+                              3 * 20 * sizeof( Vertex ), Null(),
+                              GL_STREAM_DRAW );
+  expect_bind_unbind();
+  mock.EXPECT__gl_MapBufferRange( GL_ARRAY_BUFFER, 0,
+                                  11 * sizeof( Vertex ), kMapFlags )
+      .returns( static_cast<void*>( &mapped[0] ) );
+  mock.EXPECT__gl_UnmapBuffer( GL_ARRAY_BUFFER ).returns( GL_TRUE );
+  REQUIRE( ring.upload( buf, v4 ) == 0 );
+  REQUIRE( ring.region() == 0 );
+  REQUIRE( ring.region_capacity_bytes() == 20 * sizeof( Vertex ) );
+  REQUIRE( mapped[10].x == 60 );
+
+  // The last fence is released when the ring goes away.
+  mock.EXPECT__gl_FenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 )
+      .returns( fake_sync( 4 ) );
+  ring.fence();
+  mock.EXPECT__gl_DeleteSync( fake_sync( 4 ) );
+}
+
+} // namespace
+} // namespace gl
@@ -3080,6 +3080,30 @@ TEST_CASE( "[goto] find_next_move_for_unit_with_goto_target" ) {
   REQUIRE( f() == expected );
   destroy_dwelling( w.ss(), w.map_updater(), dwelling_id_1 );
 
+  // Dwelling appears on tile on path, path gets repaired.
+  registry.units.clear();
+  registry.stats = {};
+  set_unit_pos( { .x = 2, .y = 2 } );
+  target   = goto_target::map{ .tile     = { .x = 7, .y = 7 },
+                               .snapshot = empty_or_friendly{} };
+  expected = EvolveGoto::move{ .to = e_direction::se };
+  REQUIRE( f() == expected );
+  REQUIRE( registry.stats.full_searches == 1 );
+  REQUIRE( registry.stats.repairs == 0 );
+  set_unit_pos( { .x = 3, .y = 3 } );
+  DwellingId const dwelling_id_2 =
+      w.add_dwelling( { .x = 4, .y = 4 }, arawak ).id;
+  expected = EvolveGoto::move{ .to = e_direction::e };
+  REQUIRE( f() == expected );
+  REQUIRE( registry.stats.full_searches == 1 );
+  REQUIRE( registry.stats.repairs == 1 );
+  REQUIRE( registry.units[p_unit->id()].path.reverse_path ==
+           vector<point>{ { .x = 7, .y = 7 },
+                          { .x = 6, .y = 6 },
+                          { .x = 5, .y = 5 },
+                          { .x = 5, .y = 4 } } );
+  destroy_dwelling( w.ss(), w.map_updater(), dwelling_id_2 );
+
   // Destination changes contents.
   registry.units.clear();
   set_unit_pos( { .x = 2, .y = 2 } );
@@ -3205,6 +3229,68 @@ TEST_CASE( "[goto] find_next_move_for_unit_with_goto_target" ) {
   REQUIRE( f() == expected );
 }
 
+TEST_CASE( "[goto] shared flow fields" ) {
+  world w;
+  w.create_isolation_map();
+  EvolveGoto expected;
+
+  using enum e_unit_type;
+
+  GotoRegistry registry;
+  VisibilityEntire const viz( w.ss() );
+  goto_target const target = create_goto_map_target(
+      w.ss(), w.default_player_type(), { .x = 4, .y = 4 } );
+
+  auto const f = [&] [[clang::noinline]] ( Unit const& unit ) {
+    GotoMapViewer const viewer( w.ss(), viz, unit.player_type(),
+                                unit.type() );
+    return find_next_move_for_unit_with_goto_target(
+        w.ss().as_const, w.map_updater().connectivity(),
+        registry, viewer, unit, target );
+  };
+
+  Unit const& unit_1 =
+      w.add_unit_on_map( free_colonist, { .x = 3, .y = 3 } );
+  Unit const& unit_2 =
+      w.add_unit_on_map( free_colonist, { .x = 5, .y = 5 } );
+  Unit const& unit_3 =
+      w.add_unit_on_map( free_colonist, { .x = 0, .y = 3 } );
+  Unit const& scout =
+      w.add_unit_on_map( seasoned_scout, { .x = 3, .y = 4 } );
+
+  // The first unit to go somewhere just searches.
+  expected = EvolveGoto::move{ .to = e_direction::se };
+  REQUIRE( f( unit_1 ) == expected );
+  REQUIRE( registry.stats.full_searches == 1 );
+  REQUIRE( registry.stats.flow_fields == 0 );
+
+  // The second builds the field, and the rest use it.
+  expected = EvolveGoto::move{ .to = e_direction::nw };
+  REQUIRE( f( unit_2 ) == expected );
+  REQUIRE( f( unit_3 ).holds<EvolveGoto::move>() );
+  REQUIRE( registry.stats.full_searches == 1 );
+  REQUIRE( registry.stats.flow_fields == 1 );
+  REQUIRE( registry.stats.flow_field_paths == 2 );
+  auto const& path_3 =
+      registry.units[unit_3.id()].path.reverse_path;
+  REQUIRE( path_3.size() == 3 );
+  REQUIRE( path_3[0] == point{ .x = 4, .y = 4 } );
+
+  // Different unit type.
+  expected = EvolveGoto::move{ .to = e_direction::e };
+  REQUIRE( f( scout ) == expected );
+  REQUIRE( registry.stats.full_searches == 2 );
+  REQUIRE( registry.stats.flow_fields == 1 );
+
+  // Fields are dropped on the next turn.
+  ++w.turn().time_point.turns;
+  registry.units.clear();
+  expected = EvolveGoto::move{ .to = e_direction::nw };
+  REQUIRE( f( unit_2 ) == expected );
+  REQUIRE( registry.stats.full_searches == 3 );
+  REQUIRE( registry.stats.flow_fields == 1 );
+}
+
 // Just do something basic here since the bulk of it is already
 // tested in other test cases. One thing that this provides is
 // that it will break if omniscient path finding is enabled.
@@ -0,0 +1,91 @@
+/****************************************************************
+**lua-cache.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Unit tests for the src/lua-cache.* module.
+*
+*****************************************************************/
+#include "test/testing.hpp"
+
+// Under test.
+#include "src/lua-cache.hpp"
+
+// luapp
+#include "src/luapp/error.hpp"
+#include "src/luapp/state.hpp"
+
+// C++ standard library
+#include <fstream>
+
+// Must be last.
+#include "test/catch-common.hpp"
+
+namespace rn {
+namespace {
+
+using namespace std;
+
+void write_file( fs::path const& p, string_view contents ) {
+  ofstream out( p, ios::binary | ios::trunc );
+  out << contents;
+}
+
+TEST_CASE( "[lua-cache] load_lua_file_cached" ) {
+  fs::path const dir = fs::temp_directory_path() / "rn-lua-cache";
+  fs::remove_all( dir );
+  fs::create_directories( dir );
+  fs::path const source = dir / "module.lua";
+  fs::path const cache  = dir / "cache";
+
+  lua::state st;
+  LuaCacheStats stats;
+
+  auto load = [&] {
+    return load_lua_file_cached( st, source, cache, stats )
+        .call<int>();
+  };
+
+  write_file( source, "return 1 + 2" );
+
+  // Cold.
+  REQUIRE( load() == 3 );
+  REQUIRE( stats.hits == 0 );
+  REQUIRE( stats.misses == 1 );
+
+  // Warm.
+  REQUIRE( load() == 3 );
+  REQUIRE( stats.hits == 1 );
+  REQUIRE( stats.misses == 1 );
+
+  // Source changed.
+  write_file( source, "return 5 + 6" );
+  REQUIRE( load() == 11 );
+  REQUIRE( stats.hits == 1 );
+  REQUIRE( stats.misses == 2 );
+  REQUIRE( load() == 11 );
+  REQUIRE( stats.hits == 2 );
+  REQUIRE( stats.misses == 2 );
+
+  // Corrupt the cache entry, which should fall back to the
+  // source and rewrite the entry.
+  for( auto const& e : fs::recursive_directory_iterator( cache ) )
+    if( e.is_regular_file() ) write_file( e.path(), "garbage" );
+  REQUIRE( load() == 11 );
+  REQUIRE( stats.hits == 2 );
+  REQUIRE( stats.misses == 3 );
+  REQUIRE( load() == 11 );
+  REQUIRE( stats.hits == 3 );
+  REQUIRE( stats.misses == 3 );
+
+  // Errors in the source are still reported.
+  write_file( source, "return +" );
+  REQUIRE_THROWS( load() );
+
+  fs::remove_all( dir );
+}
+
+} // namespace
+} // namespace rn
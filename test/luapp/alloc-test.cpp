@@ -0,0 +1,144 @@
+/****************************************************************
+**alloc.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Unit tests for the src/luapp/alloc.* module.
+*
+*****************************************************************/
+#include "test/testing.hpp"
+
+// Under test.
+#include "src/luapp/alloc.hpp"
+
+// Testing
+#include "test/luapp/common.hpp"
+
+// C++ standard library
+#include <cstring>
+
+// Must be last.
+#include "test/catch-common.hpp"
+
+namespace lua {
+namespace {
+
+using namespace std;
+
+void* call( Allocator& alloc, void* ptr, size_t osize,
+            size_t nsize ) {
+  return Allocator::lua_alloc( &alloc, ptr, osize, nsize );
+}
+
+TEST_CASE( "[lua-alloc] small blocks" ) {
+  Allocator alloc;
+  // When ptr is null osize is the Lua type tag.
+  void* const p1 = call( alloc, nullptr, /*LUA_TTABLE=*/5, 24 );
+  REQUIRE( p1 != nullptr );
+  memset( p1, 'x', 24 );
+  REQUIRE( alloc.stats().live_bytes == 24 );
+  REQUIRE( alloc.stats().num_allocs == 1 );
+  REQUIRE( alloc.stats().chunk_bytes == Allocator::kChunkSize );
+
+  // Growing within the size class does not move the block.
+  REQUIRE( call( alloc, p1, 24, 32 ) == p1 );
+  REQUIRE( alloc.stats().live_bytes == 32 );
+  REQUIRE( alloc.stats().num_reallocs == 1 );
+
+  // Growing into another size class moves it and keeps the con-
+  // tents.
+  void* const p2 = call( alloc, p1, 32, 100 );
+  REQUIRE( p2 != nullptr );
+  REQUIRE( p2 != p1 );
+  REQUIRE( static_cast<char*>( p2 )[23] == 'x' );
+  REQUIRE( alloc.stats().live_bytes == 100 );
+
+  // The old block was put on the freelist.
+  void* const p3 = call( alloc, nullptr, 0, 30 );
+  REQUIRE( p3 == p1 );
+
+  REQUIRE( call( alloc, p2, 100, 0 ) == nullptr );
+  REQUIRE( call( alloc, p3, 30, 0 ) == nullptr );
+  REQUIRE( alloc.stats().live_bytes == 0 );
+  REQUIRE( alloc.stats().peak_bytes == 130 );
+  REQUIRE( alloc.stats().num_allocs == 2 );
+  REQUIRE( alloc.stats().num_frees == 2 );
+  REQUIRE( alloc.stats().num_failed == 0 );
+  REQUIRE( alloc.stats().chunk_bytes == Allocator::kChunkSize );
+}
+
+TEST_CASE( "[lua-alloc] large blocks" ) {
+  Allocator alloc;
+  void* const p1 = call( alloc, nullptr, 0, 200 );
+  REQUIRE( p1 != nullptr );
+  memset( p1, 'y', 200 );
+  void* const p2 = call( alloc, p1, 200, 10'000 );
+  REQUIRE( p2 != nullptr );
+  REQUIRE( static_cast<char*>( p2 )[199] == 'y' );
+  REQUIRE( alloc.stats().live_bytes == 10'000 );
+  // Shrink back down into a small size class.
+  void* const p3 = call( alloc, p2, 10'000, 16 );
+  REQUIRE( p3 != nullptr );
+  REQUIRE( static_cast<char*>( p3 )[15] == 'y' );
+  REQUIRE( alloc.stats().live_bytes == 16 );
+  REQUIRE( call( alloc, p3, 16, 0 ) == nullptr );
+  REQUIRE( alloc.stats().live_bytes == 0 );
+  REQUIRE( alloc.stats().peak_bytes == 10'000 );
+}
+
+TEST_CASE( "[lua-alloc] cap" ) {
+  Allocator alloc;
+  alloc.set_cap( 1000 );
+  void* const p1 = call( alloc, nullptr, 0, 600 );
+  REQUIRE( p1 != nullptr );
+  REQUIRE( call( alloc, nullptr, 0, 600 ) == nullptr );
+  REQUIRE( call( alloc, p1, 600, 1200 ) == nullptr );
+  REQUIRE( alloc.stats().num_failed == 2 );
+  REQUIRE( alloc.stats().live_bytes == 600 );
+  // Shrinking always succeeds.
+  alloc.set_cap( 100 );
+  void* const p2 = call( alloc, p1, 600, 300 );
+  REQUIRE( p2 != nullptr );
+  REQUIRE( call( alloc, p2, 300, 0 ) == nullptr );
+  REQUIRE( alloc.stats().live_bytes == 0 );
+}
+
+LUA_TEST_CASE( "[lua-alloc] state" ) {
+  C.openlibs();
+  base::maybe<AllocStats> const before = st.memory.stats();
+  REQUIRE( before.has_value() );
+  REQUIRE( before->live_bytes > 0 );
+  REQUIRE( before->num_allocs > 0 );
+
+  st.script.run( R"lua(
+    local t = {}
+    for i = 1, 1000 do t[i] = { x=i, y=i } end
+  )lua" );
+  base::maybe<AllocStats> const after = st.memory.stats();
+  REQUIRE( after.has_value() );
+  REQUIRE( after->num_allocs > before->num_allocs + 1000 );
+  REQUIRE( after->peak_bytes > before->peak_bytes );
+
+  // Views see the same allocator.
+  state view = state::view( L );
+  REQUIRE( view.memory.stats().has_value() );
+
+  st.memory.set_cap( after->live_bytes + 64 * 1024 );
+  lua_valid const res = st.script.run_safe( R"lua(
+    local t = {}
+    for i = 1, 1000000 do t[i] = { x=i, y=i } end
+  )lua" );
+  REQUIRE( !res );
+  REQUIRE( res.error().msg.find( "not enough memory" ) !=
+           string::npos );
+  REQUIRE( st.memory.stats()->num_failed > 0 );
+
+  // The state is still usable after lifting the cap.
+  st.memory.set_cap( base::nothing );
+  REQUIRE( st.script.run<int>( "return 1+2" ) == 3 );
+}
+
+} // namespace
+} // namespace lua
@@ -172,6 +172,35 @@ LUA_TEST_CASE( "[lua-c-api] loadstring" ) {
   REQUIRE( C.stack_size() == 0 );
 }
 
+LUA_TEST_CASE( "[lua-c-api] loadbuffer/dump" ) {
+  string_view const script = "return 5 + ...";
+  REQUIRE( C.loadbuffer( script, "=test", "t" ) == valid );
+  REQUIRE( C.stack_size() == 1 );
+  string const bytecode = C.dump( /*strip=*/false );
+  REQUIRE( C.stack_size() == 1 );
+  REQUIRE( !bytecode.empty() );
+  C.pop();
+
+  // Binary chunks are rejected in text mode and vice versa.
+  REQUIRE( !C.loadbuffer( bytecode, "=test", "t" ) );
+  REQUIRE( C.stack_size() == 0 );
+  REQUIRE( !C.loadbuffer( script, "=test", "b" ) );
+  REQUIRE( C.stack_size() == 0 );
+
+  REQUIRE( C.loadbuffer( bytecode, "=test", "b" ) == valid );
+  REQUIRE( C.stack_size() == 1 );
+  C.push( 3 );
+  REQUIRE( C.pcall( /*nargs=*/1, /*nresults=*/1 ) == valid );
+  REQUIRE( C.stack_size() == 1 );
+  REQUIRE( C.get<int>( -1 ) == 8 );
+  C.pop();
+
+  // Truncated bytecode.
+  REQUIRE( !C.loadbuffer( bytecode.substr( 0, 10 ), "=test",
+                          "b" ) );
+  REQUIRE( C.stack_size() == 0 );
+}
+
 LUA_TEST_CASE( "[lua-c-api] dostring" ) {
   REQUIRE( C.getglobal( "xyz" ) == type::nil );
   REQUIRE( C.stack_size() == 1 );
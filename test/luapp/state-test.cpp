@@ -97,6 +97,27 @@ LUA_TEST_CASE( "[lua-state] script loading" ) {
   REQUIRE( f() == "hello" );
 }
 
+LUA_TEST_CASE( "[lua-state] script load buffer and dump" ) {
+  string_view const code = R"lua(
+    return 'hello'
+  )lua";
+  lua_expect<rfunction> f =
+      st.script.load_buffer_safe( code, "@x.lua", "t" );
+  REQUIRE( f.has_value() );
+  REQUIRE( ( *f )() == "hello" );
+
+  string const bytecode = st.script.dump( *f, /*strip=*/false );
+  REQUIRE( C.stack_size() == 0 );
+
+  lua_expect<rfunction> g =
+      st.script.load_buffer_safe( bytecode, "@x.lua", "b" );
+  REQUIRE( g.has_value() );
+  REQUIRE( ( *g )() == "hello" );
+
+  REQUIRE( !st.script.load_buffer_safe( bytecode, "@x.lua", "t" )
+                .has_value() );
+}
+
 LUA_TEST_CASE( "[lua-state] inline lua function" ) {
   std::function<lua::any()> f = st.script.load( R"lua(
     local x = 0
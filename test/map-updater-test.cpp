@@ -712,7 +712,8 @@ TEST_CASE(
     .x_size  = 3,
     .indices = { 1, 2, 1, 2, 1, 2, 1, 2, 2 },
     .indices_with_right_edge_access = { 2, 1 },
-    .indices_with_left_edge_access  = { 2, 1 } };
+    .indices_with_left_edge_access  = { 2, 1 },
+    .generation                     = 1 };
   REQUIRE( connectivity == expected );
 
   // Insert marker.
@@ -721,7 +722,8 @@ TEST_CASE(
     .x_size  = 3,
     .indices = { 1, 2, 1, 2, 1, 2, 1, 2, 2, 999 },
     .indices_with_right_edge_access = { 2, 1 },
-    .indices_with_left_edge_access  = { 2, 1 } };
+    .indices_with_left_edge_access  = { 2, 1 },
+    .generation                     = 1 };
   REQUIRE( connectivity == expected ); // sanity check.
 
   map_updater.connectivity();
@@ -731,13 +733,14 @@ TEST_CASE(
     .x_size  = 3,
     .indices = { 1, 2, 1, 2, 1, 2, 1, 2, 2, 999 },
     .indices_with_right_edge_access = { 2, 1 },
-    .indices_with_left_edge_access  = { 2, 1 } };
+    .indices_with_left_edge_access  = { 2, 1 },
+    .generation                     = 1 };
   REQUIRE( connectivity == expected );
 
   map_updater.modify_entire_map_no_redraw( []( auto& ) {} );
 
   // Connectivity reset (marked dirty) but not yet regenerated.
-  expected = TerrainConnectivity{};
+  expected = TerrainConnectivity{ .generation = 2 };
   REQUIRE( connectivity == expected );
 
   map_updater.connectivity();
@@ -747,7 +750,8 @@ TEST_CASE(
     .x_size  = 3,
     .indices = { 1, 2, 1, 2, 1, 2, 1, 2, 2 },
     .indices_with_right_edge_access = { 2, 1 },
-    .indices_with_left_edge_access  = { 2, 1 } };
+    .indices_with_left_edge_access  = { 2, 1 },
+    .generation                     = 2 };
   REQUIRE( connectivity == expected );
 }
 
@@ -135,6 +135,18 @@ struct MockOpenGL : IOpenGL {
                   ( GLenum ) );
 
   MOCK_GL_METHOD( void, gl_ActiveTexture, ( GLenum ) );
+
+  MOCK_GL_METHOD( void*, gl_MapBufferRange,
+                  ( GLenum, GLintptr, GLsizeiptr, GLbitfield ) );
+
+  MOCK_GL_METHOD( GLboolean, gl_UnmapBuffer, ( GLenum ) );
+
+  MOCK_GL_METHOD( GLsync, gl_FenceSync, ( GLenum, GLbitfield ) );
+
+  MOCK_GL_METHOD( GLenum, gl_ClientWaitSync,
+                  ( GLsync, GLbitfield, GLuint64 ) );
+
+  MOCK_GL_METHOD( void, gl_DeleteSync, ( GLsync ) );
 };
 
 static_assert( !std::is_abstract_v<MockOpenGL> );
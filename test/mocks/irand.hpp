@@ -29,6 +29,7 @@ namespace rn {
 *****************************************************************/
 struct MockIRand : IRand {
   MOCK_METHOD( void, reseed, (rng::entropy const&), () );
+  MOCK_METHOD( void, set_engine, (rng::e_rng_engine), () );
   MOCK_METHOD( bool, bernoulli, (double), () );
   MOCK_METHOD( int, uniform_int, (int, int), () );
   MOCK_METHOD( double, uniform_double, (double, double), () );
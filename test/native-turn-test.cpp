@@ -23,11 +23,15 @@
 #include "test/util/coro.hpp"
 
 // Revolution Now
+#include "src/anim-builders.hpp"
 #include "src/iraid.rds.hpp"
 #include "src/itribe-evolve.rds.hpp"
 #include "src/plane-stack.hpp"
 #include "src/ts.hpp"
 
+// config
+#include "src/config/land-view.rds.hpp"
+
 // ss
 #include "src/ss/dwelling.rds.hpp"
 #include "src/ss/fog-square.rds.hpp"
@@ -40,6 +44,7 @@
 #include "refl/to-str.hpp"
 
 // base
+#include "base/scope-exit.hpp"
 #include "base/to-str-ext-std.hpp"
 
 // Must be last.
@@ -512,6 +517,73 @@ TEST_CASE( "[native-turn] unit iteration, travel" ) {
   }
 }
 
+TEST_CASE( "[native-turn] travel animations" ) {
+  World W;
+  RealRaid real_raid( W.ss(), W.ts(), W.rand() );
+  RealTribeEvolve real_tribe_evolver( W.ss(), W.rand() );
+
+  MockLandViewPlane mock_land_view;
+  W.planes().get().set_bottom<ILandViewPlane>( mock_land_view );
+
+  auto f = [&] {
+    co_await_test( natives_turn( W.engine(), W.ss(), W.ts(),
+                                 real_raid,
+                                 real_tribe_evolver ) );
+  };
+
+  MockINativeAgent& native_agent =
+      W.native_agent( e_tribe::arawak );
+
+  auto [dwelling_id1, unit_id1] = W.add_dwelling_and_brave_ids(
+      { .x = 0, .y = 0 }, e_tribe::arawak );
+  auto [dwelling_id2, unit_id2] = W.add_dwelling_and_brave_ids(
+      { .x = 0, .y = 1 }, e_tribe::arawak );
+  native_agent.EXPECT__select_unit( set{ unit_id1, unit_id2 } )
+      .returns( unit_id2 );
+  native_agent.EXPECT__command_for( unit_id2 )
+      .returns( NativeUnitCommand::move{
+        .direction = e_direction::e } );
+  native_agent.EXPECT__select_unit( set{ unit_id1 } )
+      .returns( unit_id1 );
+  native_agent.EXPECT__command_for( unit_id1 )
+      .returns( NativeUnitCommand::move{
+        .direction = e_direction::e } );
+
+  auto& conf = detail::__config_land_view;
+
+  SECTION( "sequential" ) {
+    SCOPED_SET_AND_RESTORE( conf.ai_moves.concurrent_animations,
+                            false );
+    // Each move pans the viewport to the unit if needed.
+    mock_land_view.EXPECT__animate_if_visible(
+        anim_seq_for_unit_move( W.ss(), unit_id2,
+                                e_direction::e ) );
+    mock_land_view.EXPECT__animate_if_visible(
+        anim_seq_for_unit_move( W.ss(), unit_id1,
+                                e_direction::e ) );
+    f();
+  }
+
+  SECTION( "concurrent" ) {
+    SCOPED_SET_AND_RESTORE( conf.ai_moves.concurrent_animations,
+                            true );
+    // The units have already been moved when these are animated
+    // and the viewport is not panned.
+    mock_land_view.EXPECT__animate_if_visible(
+        anim_seq_for_moved_unit( unit_id2, { .x = 0, .y = 1 },
+                                 e_direction::e ) );
+    mock_land_view.EXPECT__animate_if_visible(
+        anim_seq_for_moved_unit( unit_id1, { .x = 0, .y = 0 },
+                                 e_direction::e ) );
+    f();
+  }
+
+  REQUIRE( W.units().coord_for( unit_id1 ) ==
+           Coord{ .x = 1, .y = 0 } );
+  REQUIRE( W.units().coord_for( unit_id2 ) ==
+           Coord{ .x = 1, .y = 1 } );
+}
+
 TEST_CASE( "[native-turn] attack euro unit" ) {
   World W;
   MockIRaid mock_raid;
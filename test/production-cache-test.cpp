@@ -0,0 +1,228 @@
+/****************************************************************
+**production-cache-test.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-19.
+*
+* Description: Unit tests for the src/production-cache.* module.
+*
+*****************************************************************/
+#include "test/testing.hpp"
+
+// Under test.
+#include "src/production-cache.hpp"
+
+// Testing.
+#include "test/fake/world.hpp"
+
+// Revolution Now
+#include "src/production.hpp"
+#include "src/unit-mgr.hpp"
+
+// ss
+#include "src/ss/player.rds.hpp"
+#include "src/ss/ref.hpp"
+
+// refl
+#include "refl/to-str.hpp"
+
+// base
+#include "base/to-str-ext-std.hpp"
+
+// Must be last.
+#include "test/catch-common.hpp"
+
+namespace rn {
+namespace {
+
+using namespace std;
+
+/****************************************************************
+** Fake World Setup
+*****************************************************************/
+struct World : testing::World {
+  using Base = testing::World;
+  World() : Base() {
+    add_player( e_player::dutch );
+    create_default_map();
+  }
+
+  void create_default_map() {
+    MapSquare const _ = make_ocean();
+    MapSquare const L = make_grassland();
+    vector<MapSquare> tiles{
+      L, L, L, _, _, //
+      L, L, _, _, _, //
+      L, L, L, _, _, //
+      L, L, L, _, _, //
+      L, L, L, _, _, //
+    };
+    build_map( std::move( tiles ), 5 );
+  }
+};
+
+/****************************************************************
+** Test Cases
+*****************************************************************/
+TEST_CASE( "[production-cache] production_for_colony" ) {
+  World W;
+  Colony& colony = W.add_colony( { .x = 2, .y = 2 } );
+  Player& player = W.dutch();
+  ColonyProductionCache cache;
+
+  auto const f = [&] {
+    return cache.production_for_colony( W.ss(), colony );
+  };
+
+  auto const expected = [&] {
+    return production_for_colony( W.ss(), colony );
+  };
+
+  REQUIRE( cache.size() == 0 );
+  REQUIRE( cache.find( W.ss(), colony ) == nothing );
+
+  // Miss.
+  REQUIRE( f() == expected() );
+  REQUIRE( cache.size() == 1 );
+  REQUIRE( cache.hits() == 0 );
+
+  // Hit.
+  REQUIRE( f() == expected() );
+  REQUIRE( cache.hits() == 1 );
+
+  // Building added. The buildings are not an input to the land
+  // yields, so this still hits, but the production reflects it.
+  colony.buildings[e_colony_building::church] = true;
+  REQUIRE( cache.find( W.ss(), colony ).has_value() );
+  REQUIRE( f() == expected() );
+  REQUIRE( f().crosses == 2 );
+
+  // Stock changed. Likewise.
+  colony.commodities[e_commodity::food] += 10;
+  colony.commodities[e_commodity::furs] += 150;
+  REQUIRE( cache.find( W.ss(), colony ).has_value() );
+  REQUIRE( f() == expected() );
+
+  // Indoor unit added. Likewise.
+  W.add_unit_indoors( colony.id, e_indoor_job::coats );
+  REQUIRE( cache.find( W.ss(), colony ).has_value() );
+  REQUIRE( f() == expected() );
+  REQUIRE( f().fur_coats.product_produced_theoretical > 0 );
+
+  // Outdoor unit added.
+  Unit& unit = W.add_unit_outdoors(
+      colony.id, e_direction::e, e_outdoor_job::fish );
+  REQUIRE( cache.find( W.ss(), colony ) == nothing );
+  REQUIRE( f() == expected() );
+  int const fish = f().food_horses.fish_produced;
+  REQUIRE( fish > 0 );
+  REQUIRE( cache.find( W.ss(), colony ).has_value() );
+
+  // Outdoor unit type changed.
+  change_unit_type( W.ss(), W.ts(), unit,
+                    e_unit_type::expert_fisherman );
+  REQUIRE( cache.find( W.ss(), colony ) == nothing );
+  REQUIRE( f() == expected() );
+  REQUIRE( f().food_horses.fish_produced > fish );
+
+  // Father added.
+  player.fathers.has[e_founding_father::pocahontas] = true;
+  REQUIRE( cache.find( W.ss(), colony ) == nothing );
+  REQUIRE( f() == expected() );
+  REQUIRE( cache.find( W.ss(), colony ).has_value() );
+
+  // Center square changed.
+  W.square( { .x = 2, .y = 2 } ).irrigation = true;
+  REQUIRE( cache.find( W.ss(), colony ) == nothing );
+  REQUIRE( f() == expected() );
+
+  // Surrounding square changed.
+  W.square( { .x = 1, .y = 1 } ).road = true;
+  REQUIRE( cache.find( W.ss(), colony ) == nothing );
+  REQUIRE( f() == expected() );
+  REQUIRE( cache.find( W.ss(), colony ).has_value() );
+
+  // A square two tiles away changed. This turns the square being
+  // fished into a coast square which gives it a bonus.
+  int const fish_before = f().food_horses.fish_produced;
+  W.square( { .x = 4, .y = 2 } ) = W.make_grassland();
+  REQUIRE( cache.find( W.ss(), colony ) == nothing );
+  REQUIRE( f() == expected() );
+  REQUIRE( f().food_horses.fish_produced > fish_before );
+  REQUIRE( cache.size() == 1 );
+
+  cache.clear();
+  REQUIRE( cache.size() == 0 );
+  REQUIRE( cache.find( W.ss(), colony ) == nothing );
+}
+
+TEST_CASE( "[production-cache] sons of liberty" ) {
+  World W;
+  Colony& colony = W.add_colony( { .x = 1, .y = 2 } );
+  W.add_unit_outdoors( colony.id, e_direction::w,
+                       e_outdoor_job::food );
+  ColonyProductionCache cache;
+
+  auto const f = [&] {
+    return cache.production_for_colony( W.ss(), colony );
+  };
+
+  auto const expected = [&] {
+    return production_for_colony( W.ss(), colony );
+  };
+
+  REQUIRE( f() == expected() );
+  int const corn = f().food_horses.corn_produced;
+
+  // Bells that do not cross a threshold do not invalidate.
+  colony.sons_of_liberty.num_rebels_from_bells_only = .1;
+  REQUIRE( cache.find( W.ss(), colony ).has_value() );
+  REQUIRE( f() == expected() );
+
+  // 100% SoL gives a bonus to the land production.
+  colony.sons_of_liberty.num_rebels_from_bells_only = 1.0;
+  REQUIRE( cache.find( W.ss(), colony ) == nothing );
+  REQUIRE( f() == expected() );
+  REQUIRE( f().food_horses.corn_produced > corn );
+}
+
+TEST_CASE( "[production-cache] store" ) {
+  World W;
+  Colony& colony1 = W.add_colony( { .x = 0, .y = 0 } );
+  Colony& colony2 = W.add_colony( { .x = 2, .y = 3 } );
+  ColonyProductionCache cache;
+
+  ColonyLandYields const yields1 =
+      land_yields_for_colony( W.ss(), colony1 );
+  ColonyLandYields const yields2 =
+      land_yields_for_colony( W.ss(), colony2 );
+
+  REQUIRE( cache.store( W.ss(), colony1, yields1 ) == yields1 );
+  REQUIRE( cache.size() == 1 );
+  REQUIRE( cache.find( W.ss(), colony1 ) == yields1 );
+  REQUIRE( cache.find( W.ss(), colony2 ) == nothing );
+
+  REQUIRE( cache.store( W.ss(), colony2, yields2 ) == yields2 );
+  REQUIRE( cache.size() == 2 );
+  REQUIRE( cache.find( W.ss(), colony1 ) == yields1 );
+  REQUIRE( cache.find( W.ss(), colony2 ) == yields2 );
+  REQUIRE( cache.hits() == 4 );
+
+  // Changing one colony does not affect the other.
+  W.add_unit_outdoors( colony1.id, e_direction::e,
+                       e_outdoor_job::food );
+  REQUIRE( cache.find( W.ss(), colony1 ) == nothing );
+  REQUIRE( cache.find( W.ss(), colony2 ) == yields2 );
+
+  ColonyLandYields const yields1_new =
+      land_yields_for_colony( W.ss(), colony1 );
+  REQUIRE( yields1_new != yields1 );
+  REQUIRE( cache.store( W.ss(), colony1, yields1_new ) ==
+           yields1_new );
+  REQUIRE( cache.size() == 2 );
+  REQUIRE( cache.find( W.ss(), colony1 ) == yields1_new );
+}
+
+} // namespace
+} // namespace rn
@@ -0,0 +1,369 @@
+/****************************************************************
+**production-eval-test.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-19.
+*
+* Description: Unit tests for the src/production-eval.* module.
+*
+*****************************************************************/
+#include "test/testing.hpp"
+
+// Under test.
+#include "src/production-eval.hpp"
+
+// Testing.
+#include "test/fake/world.hpp"
+
+// Revolution Now
+#include "src/production.hpp"
+
+// ss
+#include "src/ss/colony.rds.hpp"
+#include "src/ss/old-world-state.rds.hpp"
+#include "src/ss/player.rds.hpp"
+#include "src/ss/ref.hpp"
+
+// rds
+#include "src/rds/switch-macro.hpp"
+
+// refl
+#include "refl/to-str.hpp"
+
+// base
+#include "base/to-str-ext-std.hpp"
+
+// C++ standard library
+#include <chrono>
+
+// Must be last.
+#include "test/catch-common.hpp"
+
+namespace rn {
+namespace {
+
+using namespace std;
+
+/****************************************************************
+** Fake World Setup
+*****************************************************************/
+struct World : testing::World {
+  using Base = testing::World;
+  World() : Base() {
+    add_player( e_player::dutch );
+    create_default_map();
+  }
+
+  static inline Coord const kColonyTile{ .x = 1, .y = 1 };
+
+  void create_default_map() {
+    MapSquare const _ = make_ocean();
+    MapSquare const G = make_grassland();
+    MapSquare const C = make_terrain( e_terrain::conifer );
+    MapSquare const P = make_terrain( e_terrain::prairie );
+    MapSquare const S = make_terrain( e_terrain::savannah );
+    MapSquare const H = make_terrain( e_terrain::hills );
+    MapSquare const B = make_terrain( e_terrain::broadleaf );
+    MapSquare const M = make_terrain( e_terrain::mountains );
+    MapSquare const L = make_terrain( e_terrain::plains );
+    vector<MapSquare> tiles{
+      C, P, _, //
+      S, G, H, //
+      B, M, L, //
+    };
+    build_map( std::move( tiles ), 3 );
+  }
+
+  // Gives the colony every building and puts two units to work
+  // in each (except the schools) and five on the surrounding
+  // squares, so that there is room left everywhere.
+  Colony& add_populated_colony() {
+    Colony& colony = add_colony( kColonyTile );
+    for( e_colony_building const building :
+         refl::enum_values<e_colony_building> )
+      colony.buildings[building] = true;
+    for( e_indoor_job const job :
+         refl::enum_values<e_indoor_job> ) {
+      if( job == e_indoor_job::teacher ) continue;
+      add_unit_indoors( colony.id, job );
+      add_expert_unit_indoors( colony.id, job );
+    }
+    add_expert_unit_outdoors( colony.id, e_direction::se,
+                              e_outdoor_job::food );
+    add_expert_unit_outdoors( colony.id, e_direction::ne,
+                              e_outdoor_job::fish );
+    add_unit_outdoors( colony.id, e_direction::nw,
+                       e_outdoor_job::lumber );
+    add_expert_unit_outdoors( colony.id, e_direction::e,
+                              e_outdoor_job::ore );
+    add_unit_outdoors( colony.id, e_direction::w,
+                       e_outdoor_job::sugar,
+                       e_unit_type::petty_criminal );
+    for( e_commodity const c : refl::enum_values<e_commodity> )
+      colony.commodities[c] = 7;
+    colony.commodities[e_commodity::food] = 50;
+    return colony;
+  }
+};
+
+// The quantities from the full production computation that
+// should agree with the evaluator.
+EvaluatedProduction from_production(
+    ColonyProduction const& pr ) {
+  EvaluatedProduction res;
+  auto const raw = [&]( e_commodity const c,
+                        RawMaterialAndProduct const& rp ) {
+    res.net[c] = rp.raw_produced - rp.raw_consumed_actual;
+  };
+  raw( e_commodity::sugar, pr.sugar_rum );
+  res.net[e_commodity::rum] =
+      pr.sugar_rum.product_produced_actual;
+  raw( e_commodity::tobacco, pr.tobacco_cigars );
+  res.net[e_commodity::cigars] =
+      pr.tobacco_cigars.product_produced_actual;
+  raw( e_commodity::cotton, pr.cotton_cloth );
+  res.net[e_commodity::cloth] =
+      pr.cotton_cloth.product_produced_actual;
+  raw( e_commodity::furs, pr.fur_coats );
+  res.net[e_commodity::coats] =
+      pr.fur_coats.product_produced_actual;
+  raw( e_commodity::silver, pr.silver );
+  raw( e_commodity::lumber, pr.lumber_hammers );
+  res.hammers = pr.lumber_hammers.product_produced_actual;
+  raw( e_commodity::ore, pr.ore_tools );
+  raw( e_commodity::tools, pr.tools_muskets );
+  res.net[e_commodity::muskets] =
+      pr.tools_muskets.product_produced_actual;
+  res.net[e_commodity::food] =
+      pr.food_horses.food_produced -
+      pr.food_horses.food_consumed_by_colonists_theoretical;
+  res.bells   = pr.bells;
+  res.crosses = pr.crosses;
+  return res;
+}
+
+void move_unit( Colony& colony, UnitId const unit_id,
+                ColonyJob const& job ) {
+  for( e_indoor_job const j : refl::enum_values<e_indoor_job> )
+    erase( colony.indoor_jobs[j], unit_id );
+  for( e_direction const d : refl::enum_values<e_direction> )
+    if( colony.outdoor_jobs[d].has_value() &&
+        colony.outdoor_jobs[d]->unit_id == unit_id )
+      colony.outdoor_jobs[d] = nothing;
+  SWITCH( job ) {
+    CASE( indoor ) {
+      colony.indoor_jobs[indoor.job].push_back( unit_id );
+      break;
+    }
+    CASE( outdoor ) {
+      colony.outdoor_jobs[outdoor.direction] = OutdoorUnit{
+        .unit_id = unit_id, .job = outdoor.job };
+      break;
+    }
+  }
+}
+
+vector<ColonyJob> all_jobs() {
+  vector<ColonyJob> res;
+  for( e_indoor_job const job : refl::enum_values<e_indoor_job> )
+    res.push_back( ColonyJob::indoor{ .job = job } );
+  for( e_direction const d : refl::enum_values<e_direction> )
+    for( e_outdoor_job const job :
+         refl::enum_values<e_outdoor_job> )
+      res.push_back(
+          ColonyJob::outdoor{ .direction = d, .job = job } );
+  return res;
+}
+
+/****************************************************************
+** Test Cases
+*****************************************************************/
+TEST_CASE( "[production-eval] initial assignment" ) {
+  World W;
+  Colony& colony = W.add_populated_colony();
+  Player& player = W.dutch();
+
+  SECTION( "default" ) {}
+  SECTION( "founding fathers" ) {
+    player.fathers.has[e_founding_father::thomas_jefferson] =
+        true;
+    player.fathers.has[e_founding_father::thomas_paine] = true;
+    player.fathers.has[e_founding_father::william_penn] = true;
+    W.old_world( player ).taxes.tax_rate = 30;
+  }
+  SECTION( "sons of liberty" ) {
+    colony.sons_of_liberty.num_rebels_from_bells_only = 20;
+  }
+  SECTION( "tories" ) {
+    W.settings().game_setup_options.difficulty =
+        e_difficulty::viceroy;
+  }
+  SECTION( "no raw material in stock" ) {
+    for( e_commodity const c : refl::enum_values<e_commodity> )
+      colony.commodities[c] = 0;
+  }
+
+  ProductionEvaluator const evaluator( W.ss(), colony );
+  REQUIRE( evaluator.num_units() == 18 + 5 );
+  REQUIRE( evaluator.evaluate() ==
+           from_production(
+               production_for_colony( W.ss(), colony ) ) );
+}
+
+TEST_CASE( "[production-eval] yield and has_room" ) {
+  World W;
+  Colony& colony = W.add_colony( World::kColonyTile );
+  W.add_expert_unit_outdoors( colony.id, e_direction::nw,
+                              e_outdoor_job::lumber );
+  W.add_unit_indoors( colony.id, e_indoor_job::hammers );
+  colony.commodities[e_commodity::food]   = 20;
+  colony.commodities[e_commodity::lumber] = 2;
+
+  ProductionEvaluator evaluator( W.ss(), colony );
+  REQUIRE( evaluator.num_units() == 2 );
+
+  ColonyJob const hammers =
+      ColonyJob::indoor{ .job = e_indoor_job::hammers };
+  ColonyJob const lumber_nw = ColonyJob::outdoor{
+    .direction = e_direction::nw, .job = e_outdoor_job::lumber };
+  ColonyJob const lumber_s = ColonyJob::outdoor{
+    .direction = e_direction::s, .job = e_outdoor_job::lumber };
+  ColonyJob const teacher =
+      ColonyJob::indoor{ .job = e_indoor_job::teacher };
+
+  auto const expected = [&] {
+    return from_production(
+        production_for_colony( W.ss(), colony ) );
+  };
+
+  // Indoor units come first.
+  REQUIRE( evaluator.job( 0 ) == hammers );
+  REQUIRE( evaluator.job( 1 ) == lumber_nw );
+
+  // Neither is an expert carpenter.
+  REQUIRE( evaluator.yield( 0, hammers ) > 0 );
+  REQUIRE( evaluator.yield( 0, hammers ) ==
+           evaluator.yield( 1, hammers ) );
+  // But one is an expert lumberjack.
+  REQUIRE( evaluator.yield( 0, lumber_nw ) > 0 );
+  REQUIRE( evaluator.yield( 1, lumber_nw ) >
+           evaluator.yield( 0, lumber_nw ) );
+  REQUIRE( evaluator.yield( 1, teacher ) == 0 );
+
+  REQUIRE( evaluator.has_room( hammers ) );
+  REQUIRE_FALSE( evaluator.has_room( lumber_nw ) );
+  REQUIRE( evaluator.has_room( lumber_s ) );
+  // No schoolhouse.
+  REQUIRE_FALSE( evaluator.has_room( teacher ) );
+
+  EvaluatedProduction ev = evaluator.evaluate();
+  REQUIRE( ev.hammers == evaluator.yield( 0, hammers ) );
+  REQUIRE( ev.net[e_commodity::lumber] ==
+           evaluator.yield( 1, lumber_nw ) -
+               evaluator.yield( 0, hammers ) );
+  REQUIRE( ev == expected() );
+
+  evaluator.assign( 1, lumber_s );
+  move_unit( colony, evaluator.unit_id( 1 ), lumber_s );
+  REQUIRE( evaluator.has_room( lumber_nw ) );
+  REQUIRE_FALSE( evaluator.has_room( lumber_s ) );
+  REQUIRE( evaluator.evaluate() == expected() );
+
+  evaluator.assign( 1, hammers );
+  move_unit( colony, evaluator.unit_id( 1 ), hammers );
+  REQUIRE( evaluator.has_room( lumber_s ) );
+  ev = evaluator.evaluate();
+  // Only what is in stock can be used.
+  REQUIRE( ev.net[e_commodity::lumber] == -2 );
+  REQUIRE( ev.hammers == 2 );
+  REQUIRE( ev == expected() );
+}
+
+// Tries every job for every unit and checks that the result
+// agrees with the full computation on the modified colony.
+TEST_CASE( "[production-eval] all single moves" ) {
+  World W;
+  Colony& colony = W.add_populated_colony();
+  W.dutch().fathers.has[e_founding_father::thomas_jefferson] =
+      true;
+  colony.sons_of_liberty.num_rebels_from_bells_only = 10;
+
+  ProductionEvaluator evaluator( W.ss(), colony );
+  vector<ColonyJob> const jobs = all_jobs();
+  for( int idx = 0; idx < evaluator.num_units(); ++idx ) {
+    UnitId const unit_id         = evaluator.unit_id( idx );
+    ColonyJob const original_job = evaluator.job( idx );
+    for( ColonyJob const& job : jobs ) {
+      if( job != original_job && !evaluator.has_room( job ) )
+        continue;
+      evaluator.assign( idx, job );
+      move_unit( colony, unit_id, job );
+      INFO( fmt::format( "unit: {}, job: {}", unit_id, job ) );
+      REQUIRE( evaluator.evaluate() ==
+               from_production(
+                   production_for_colony( W.ss(), colony ) ) );
+      evaluator.assign( idx, original_job );
+      move_unit( colony, unit_id, original_job );
+    }
+  }
+  REQUIRE( evaluator.evaluate() ==
+           from_production(
+               production_for_colony( W.ss(), colony ) ) );
+}
+
+// Run with: [production-eval-benchmark]
+TEST_CASE( "[production-eval] benchmark",
+           "[.][production-eval-benchmark]" ) {
+  using Clock = chrono::steady_clock;
+  World W;
+  Colony const& colony = W.add_populated_colony();
+  vector<ColonyJob> const jobs = all_jobs();
+
+  auto const time_it = [&]( auto&& fn ) {
+    Clock::time_point const start = Clock::now();
+    int const count               = fn();
+    chrono::duration<double> const elapsed =
+        Clock::now() - start;
+    return count / elapsed.count();
+  };
+
+  ProductionEvaluator evaluator( W.ss(), colony );
+  int checksum = 0;
+  double const evals_per_sec = time_it( [&] {
+    int count = 0;
+    for( int i = 0; i < 200; ++i ) {
+      for( int idx = 0; idx < evaluator.num_units(); ++idx ) {
+        ColonyJob const original_job = evaluator.job( idx );
+        for( ColonyJob const& job : jobs ) {
+          if( !evaluator.has_room( job ) ) continue;
+          evaluator.assign( idx, job );
+          checksum += evaluator.evaluate().bells;
+          ++count;
+          evaluator.assign( idx, original_job );
+        }
+      }
+    }
+    return count;
+  } );
+
+  double const full_per_sec = time_it( [&] {
+    int const count = 20'000;
+    for( int i = 0; i < count; ++i )
+      checksum += production_for_colony( W.ss(), colony ).bells;
+    return count;
+  } );
+
+  fmt::println(
+      "production evaluations per second on a colony with {} "
+      "units:",
+      evaluator.num_units() );
+  fmt::println( "  ProductionEvaluator:   {:.0f}",
+                evals_per_sec );
+  fmt::println( "  production_for_colony: {:.0f}",
+                full_per_sec );
+  REQUIRE( checksum > 0 );
+}
+
+} // namespace
+} // namespace rn
@@ -537,6 +537,37 @@ TEST_CASE( "[rand/entropy] consume" ) {
   REQUIRE( w == expected_w );
 }
 
+TEST_CASE( "[rand/entropy] derived" ) {
+  entropy const e{
+    .e1 = 0x6151c187,
+    .e2 = 0x6da636d6,
+    .e3 = 0xfbe4a276,
+    .e4 = 0x00f00076,
+  };
+
+  REQUIRE( e.derived( 0 ) == entropy{
+                                .e1 = 0x43b3cd6a,
+                                .e2 = 0x090597b1,
+                                .e3 = 0xa6caf8b1,
+                                .e4 = 0x2421a865,
+                              } );
+  REQUIRE( e.derived( 1 ) == entropy{
+                                .e1 = 0xc4366043,
+                                .e2 = 0x253e47b0,
+                                .e3 = 0x7d2a42bd,
+                                .e4 = 0x443ab0e8,
+                              } );
+
+  // Does not modify the original.
+  REQUIRE( e.e1 == 0x6151c187 );
+
+  // Chaining is order dependent.
+  REQUIRE( e.derived( 1 ).derived( 2 ) !=
+           e.derived( 2 ).derived( 1 ) );
+  REQUIRE( e.derived( 1 ).derived( 2 ) ==
+           e.derived( 1 ).derived( 2 ) );
+}
+
 LUA_TEST_CASE( "[rand/entropy] traverse" ) {
   vector<uint32_t> v1;
   vector<string> v2;
@@ -0,0 +1,142 @@
+/****************************************************************
+**philox-test.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Unit tests for the rand/philox module.
+*
+*****************************************************************/
+#include "test/testing.hpp"
+
+// Under test.
+#include "src/rand/philox.hpp"
+
+// rand
+#include "src/rand/entropy.hpp"
+
+// Must be last.
+#include "test/catch-common.hpp" // IWYU pragma: keep
+
+// C++ standard library
+#include <set>
+
+namespace rng {
+namespace {
+
+using namespace std;
+
+using block_t = philox4x32::block_t;
+using key_t   = philox4x32::key_t;
+
+entropy constexpr kSeed{
+  .e1 = 0x6151c187,
+  .e2 = 0x6da636d6,
+  .e3 = 0xfbe4a276,
+  .e4 = 0x00f00076,
+};
+
+/****************************************************************
+** Test Cases
+*****************************************************************/
+// These are the known answer vectors for Philox4x32-10 that come
+// with the Random123 reference implementation.
+TEST_CASE( "[rand/philox] known answers" ) {
+  REQUIRE( philox4x32::block( block_t{ 0, 0, 0, 0 },
+                              key_t{ 0, 0 } ) ==
+           block_t{ 0x6627e8d5, 0xe169c58d, 0xbc57ac4c,
+                    0x9b00dbd8 } );
+
+  REQUIRE( philox4x32::block(
+               block_t{ 0xffffffff, 0xffffffff, 0xffffffff,
+                        0xffffffff },
+               key_t{ 0xffffffff, 0xffffffff } ) ==
+           block_t{ 0x408f276d, 0x41c83b0e, 0xa20bc7c6,
+                    0x6d5451fd } );
+
+  REQUIRE( philox4x32::block(
+               block_t{ 0x243f6a88, 0x85a308d3, 0x13198a2e,
+                        0x03707344 },
+               key_t{ 0xa4093822, 0x299f31d0 } ) ==
+           block_t{ 0xd16cfe09, 0x94fdcceb, 0x5001e420,
+                    0x24126ea1 } );
+}
+
+TEST_CASE( "[rand/philox] default is zero seed" ) {
+  philox4x32 gen;
+  REQUIRE( gen() == 0x6627e8d5 );
+  REQUIRE( gen() == 0xe169c58d );
+  REQUIRE( gen() == 0xbc57ac4c );
+  REQUIRE( gen() == 0x9b00dbd8 );
+  REQUIRE( gen.position() == 4 );
+  REQUIRE( gen == philox4x32( entropy{} ) );
+}
+
+TEST_CASE( "[rand/philox] seeded" ) {
+  philox4x32 gen( kSeed );
+  REQUIRE( gen() == 0x4281a178 );
+  REQUIRE( gen() == 0x7fcc7317 );
+  REQUIRE( gen() == 0x6a1e2db5 );
+  REQUIRE( gen() == 0x2f7a8669 );
+  // Next block.
+  REQUIRE( gen() == 0xd7798187 );
+  REQUIRE( gen() == 0x6215a0a5 );
+
+  gen.reseed( kSeed );
+  REQUIRE( gen.position() == 0 );
+  REQUIRE( gen() == 0x4281a178 );
+}
+
+TEST_CASE( "[rand/philox] discard" ) {
+  philox4x32 gen1( kSeed );
+  philox4x32 gen2( kSeed );
+
+  for( int i = 0; i < 1003; ++i ) (void)gen1();
+  gen2.discard( 1003 );
+  REQUIRE( gen1.position() == 1003 );
+  REQUIRE( gen2.position() == 1003 );
+  REQUIRE( gen1 == gen2 );
+  for( int i = 0; i < 10; ++i ) REQUIRE( gen1() == gen2() );
+
+  // Way out into the stream without drawing anything.
+  philox4x32 gen3( kSeed );
+  gen3.discard( uint64_t{ 1 } << 40 );
+  REQUIRE( gen3.position() == uint64_t{ 1 } << 40 );
+  (void)gen3();
+}
+
+TEST_CASE( "[rand/philox] streams are distinct" ) {
+  // Same key, different streams.
+  entropy other = kSeed;
+  ++other.e4;
+  philox4x32 gen1( kSeed );
+  philox4x32 gen2( other );
+  REQUIRE( gen1 != gen2 );
+  set<uint32_t> seen;
+  for( int i = 0; i < 100; ++i ) {
+    seen.insert( gen1() );
+    seen.insert( gen2() );
+  }
+  // The odds of a collision in 200 draws are negligible.
+  REQUIRE( seen.size() == 200 );
+}
+
+TEST_CASE( "[rand/philox] substreams" ) {
+  // Draws from one entity's substream do not depend on what was
+  // drawn from any other.
+  auto const first_draws = []( entropy const& seed,
+                               uint32_t const id ) {
+    philox4x32 gen( seed.derived( 7 ).derived( id ) );
+    return vector<uint32_t>{ gen(), gen(), gen() };
+  };
+
+  vector<uint32_t> const a = first_draws( kSeed, 1 );
+  vector<uint32_t> const b = first_draws( kSeed, 2 );
+  REQUIRE( a != b );
+  REQUIRE( first_draws( kSeed, 1 ) == a );
+  REQUIRE( first_draws( kSeed, 2 ) == b );
+}
+
+} // namespace
+} // namespace rng
@@ -57,6 +57,44 @@ TEST_CASE( "[rand/random] construct with seed" ) {
   REQUIRE( n == 1911169126 );
 }
 
+TEST_CASE( "[rand/random] engines" ) {
+  entropy const e{
+    .e1 = 0x6151c187,
+    .e2 = 0x6da636d6,
+    .e3 = 0xfbe4a276,
+    .e4 = 0x00f00076,
+  };
+
+  random r;
+  REQUIRE( r.engine() == e_rng_engine::mersenne );
+
+  r.set_engine( e_rng_engine::philox );
+  REQUIRE( r.engine() == e_rng_engine::philox );
+  r.reseed( e );
+  REQUIRE( r.engine() == e_rng_engine::philox );
+  // First two outputs of the philox stream for this seed.
+  REQUIRE( r.uniform<uint32_t>() == 0x4281a178 );
+  REQUIRE( r.uniform<uint32_t>() == 0x7fcc7317 );
+
+  random r2( e_rng_engine::philox, e );
+  REQUIRE( r2.uniform<uint32_t>() == 0x4281a178 );
+
+  // The distributions work the same over both engines.
+  for( int i = 0; i < 100; ++i ) {
+    int const n = r2.uniform_int( 3, 7 );
+    REQUIRE( n >= 3 );
+    REQUIRE( n <= 7 );
+    double const d = r2.uniform_double( -1.0, 1.0 );
+    REQUIRE( d >= -1.0 );
+    REQUIRE( d < 1.0 );
+  }
+
+  // Switching back gives the original behavior.
+  r.set_engine( e_rng_engine::mersenne );
+  r.reseed( e );
+  REQUIRE( r.uniform<uint32_t>() == 1911169126 );
+}
+
 TEST_CASE( "[rand/random] reseed" ) {
   random r;
 
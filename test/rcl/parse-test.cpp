@@ -351,6 +351,41 @@ TEST_CASE( "[parse] table with duplicate keys" ) {
   }
 }
 
+TEST_CASE( "[parse] long blank runs and comments" ) {
+  using namespace cdr;
+  using namespace cdr::literals;
+  static string const input =
+      "                          # leading comment 'x\n"
+      "a {                                      \n"
+      "                  b: \"x # not a comment\" # \"c\"\n"
+      "\t\t\t\t\t\t\t\t\t\t\tc: 'y#z' ############\n"
+      "                                 d: word  # trailing\r\n"
+      "  e: 123456789012 #\n"
+      "}                                   \n"
+      "                                 ";
+
+  auto doc = parse( "fake-file", input );
+  REQUIRE( doc );
+  table const expected{
+    "a"_key = table{ "b"_key = "x # not a comment",
+                     "c"_key = "y#z",
+                     "d"_key = "word",
+                     "e"_key = 123456789012 } };
+  REQUIRE( doc->top_tbl() == expected );
+}
+
+TEST_CASE( "[parse] error position after long blank runs" ) {
+  static string const input =
+      "a: 1                                          # c  \n"
+      "                                b: 2\n"
+      "                                c: ]\n";
+
+  auto doc = parse( "fake-file", input );
+  REQUIRE( !doc.has_value() );
+  REQUIRE( doc.error() ==
+           "fake-file:error:3:36: unexpected character" );
+}
+
 TEST_CASE( "[parse] can parse 64 bit ints" ) {
   using namespace cdr;
   using namespace cdr::literals;
@@ -77,5 +77,28 @@ TEST_CASE( "[refl/validate] validate_recursive" ) {
   REQUIRE( f() == valid );
 }
 
+TEST_CASE( "[refl/validate] is_valid_recursive" ) {
+  rdstest::ValidatableLevel1 top;
+
+  auto const f = [&] [[clang::noinline]] {
+    return is_valid_recursive( top );
+  };
+
+  REQUIRE_FALSE( f() );
+
+  top.o.y.x = 5;
+  top.o.y.y = 7;
+  REQUIRE_FALSE( f() );
+
+  top.n = 2;
+  REQUIRE( f() );
+
+  top.o.y.v.resize( 1 );
+  REQUIRE_FALSE( f() );
+
+  top.o.y.v[0].b = true;
+  REQUIRE( f() );
+}
+
 } // namespace
 } // namespace refl
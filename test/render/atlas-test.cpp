@@ -95,25 +95,27 @@ TEST_CASE( "[render/atlas] single image" ) {
   maybe<Atlas> atlas = builder.build( size{ .w = 5, .h = 7 } );
   REQUIRE( atlas.has_value() );
 
-  REQUIRE( atlas->img.size_pixels() == size{ .w = 5, .h = 5 } );
+  REQUIRE( atlas->img.size_pixels() == size{ .w = 5, .h = 4 } );
   pixel expected_atlas_pixels[] = {
-    R, R, B, G, G, //
-    R, R, B, G, G, //
-    R, R, B, _, _, //
-    W, W, _, _, _, //
-    W, W, _, _, _, //
+    R, R, G, G, B, //
+    R, R, G, G, B, //
+    R, R, W, W, B, //
+    _, _, W, W, _, //
   };
   REQUIRE( image_equals( atlas->img, expected_atlas_pixels ) );
+  REQUIRE( atlas->stats ==
+           RectPackStats{ .size_used     = { .w = 5, .h = 4 },
+                          .area_occupied = 17 } );
 
   REQUIRE( atlas->dict.size() == 4 );
   REQUIRE( atlas->dict.lookup( 0 ) ==
-           rect{ .origin = { .x = 2, .y = 0 },
+           rect{ .origin = { .x = 4, .y = 0 },
                  .size   = { .w = 1, .h = 3 } } );
   REQUIRE( atlas->dict.lookup( 1 ) ==
-           rect{ .origin = { .x = 3, .y = 0 },
+           rect{ .origin = { .x = 2, .y = 0 },
                  .size   = { .w = 2, .h = 2 } } );
   REQUIRE( atlas->dict.lookup( 2 ) ==
-           rect{ .origin = { .x = 0, .y = 3 },
+           rect{ .origin = { .x = 2, .y = 2 },
                  .size   = { .w = 2, .h = 2 } } );
   REQUIRE( atlas->dict.lookup( 3 ) ==
            rect{ .origin = { .x = 0, .y = 0 },
@@ -247,46 +249,54 @@ TEST_CASE( "[render/atlas] multiple images" ) {
   REQUIRE( builder.build( size{ .w = 5, .h = 5 } ) == nothing );
   REQUIRE( builder.build( size{ .w = 6, .h = 5 } ) == nothing );
   REQUIRE( builder.build( size{ .w = 7, .h = 5 } ) == nothing );
-  REQUIRE( builder.build( size{ .w = 8, .h = 5 } ) == nothing );
+  REQUIRE( builder.build( size{ .w = 8, .h = 4 } ) == nothing );
+  REQUIRE( builder.build( size{ .w = 8, .h = 5 } ) != nothing );
   REQUIRE( builder.build( size{ .w = 9, .h = 5 } ) != nothing );
 
   maybe<Atlas> atlas = builder.build( size{ .w = 11, .h = 10 } );
   REQUIRE( atlas.has_value() );
 
-  REQUIRE( atlas->img.size_pixels() == size{ .w = 9, .h = 5 } );
+  // The smallest bin that works is 4x10, but only a 4x9 area of
+  // it is used, and the image is trimmed to that.
+  REQUIRE( atlas->img.size_pixels() == size{ .w = 4, .h = 9 } );
   pixel expected_atlas_pixels[] = {
-    R, R, R, B, B, B, B, G, G, //
-    R, R, R, B, B, B, B, G, G, //
-    R, R, R, B, W, W, W, W, W, //
-    R, _, _, _, W, W, W, W, W, //
-    R, _, _, _, _, _, _, G, _, //
+    R, R, B, R, //
+    R, R, B, R, //
+    R, R, B, R, //
+    B, B, B, R, //
+    B, B, B, R, //
+    W, W, W, G, //
+    W, W, W, _, //
+    G, G, W, W, //
+    G, G, W, W, //
   };
   REQUIRE( image_equals( atlas->img, expected_atlas_pixels ) );
+  REQUIRE( atlas->stats.area_occupied == 35 );
 
   REQUIRE( atlas->dict.size() == 8 );
   REQUIRE( atlas->dict.lookup( 0 ) ==
-           rect{ .origin = { .x = 3, .y = 0 },
+           rect{ .origin = { .x = 2, .y = 0 },
                  .size   = { .w = 1, .h = 3 } } );
   REQUIRE( atlas->dict.lookup( 1 ) ==
-           rect{ .origin = { .x = 7, .y = 0 },
+           rect{ .origin = { .x = 0, .y = 7 },
                  .size   = { .w = 2, .h = 2 } } );
   REQUIRE( atlas->dict.lookup( 2 ) ==
-           rect{ .origin = { .x = 7, .y = 2 },
+           rect{ .origin = { .x = 2, .y = 7 },
                  .size   = { .w = 2, .h = 2 } } );
   REQUIRE( atlas->dict.lookup( 3 ) ==
-           rect{ .origin = { .x = 1, .y = 0 },
+           rect{ .origin = { .x = 0, .y = 0 },
                  .size   = { .w = 2, .h = 3 } } );
   REQUIRE( atlas->dict.lookup( 4 ) ==
-           rect{ .origin = { .x = 4, .y = 0 },
+           rect{ .origin = { .x = 0, .y = 3 },
                  .size   = { .w = 3, .h = 2 } } );
   REQUIRE( atlas->dict.lookup( 5 ) ==
-           rect{ .origin = { .x = 7, .y = 4 },
+           rect{ .origin = { .x = 3, .y = 5 },
                  .size   = { .w = 1, .h = 1 } } );
   REQUIRE( atlas->dict.lookup( 6 ) ==
-           rect{ .origin = { .x = 4, .y = 2 },
+           rect{ .origin = { .x = 0, .y = 5 },
                  .size   = { .w = 3, .h = 2 } } );
   REQUIRE( atlas->dict.lookup( 7 ) ==
-           rect{ .origin = { .x = 0, .y = 0 },
+           rect{ .origin = { .x = 3, .y = 0 },
                  .size   = { .w = 1, .h = 5 } } );
 }
 
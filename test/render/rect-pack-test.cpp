@@ -735,5 +735,183 @@ TEST_CASE( "[render/rect-pack] lots o bars" ) {
   }
 }
 
+TEST_CASE( "[render/rect-pack] max_rects empty" ) {
+  vector<rect> input;
+
+  maybe<RectPackStats> const stats =
+      pack_rects_max_rects( input, size{ .w = 2, .h = 2 } );
+  REQUIRE( stats == RectPackStats{} );
+  REQUIRE( stats->efficiency() == 1.0 );
+
+  REQUIRE( pack_rects_best( input, size{} ) == RectPackStats{} );
+}
+
+TEST_CASE( "[render/rect-pack] max_rects zero area" ) {
+  vector<rect> input = {
+    rect{ .origin = { .x = -1, .y = -1 },
+          .size   = { .w = 0, .h = 0 } },
+    rect{ .origin = { .x = -1, .y = -1 },
+          .size   = { .w = 3, .h = 0 } },
+    rect{ .origin = { .x = -1, .y = -1 },
+          .size   = { .w = 1, .h = 1 } },
+  };
+
+  maybe<RectPackStats> const stats =
+      pack_rects_max_rects( input, size{ .w = 1, .h = 1 } );
+  REQUIRE( stats == RectPackStats{ .size_used = { .w = 1, .h = 1 },
+                                   .area_occupied = 1 } );
+  REQUIRE( input[0].origin == point{ .x = 0, .y = 0 } );
+  REQUIRE( input[1].origin == point{ .x = 0, .y = 0 } );
+  REQUIRE( input[2].origin == point{ .x = 0, .y = 0 } );
+}
+
+TEST_CASE( "[render/rect-pack] max_rects multiple" ) {
+  vector<rect> input;
+  auto add_rect = [&]( size const s ) mutable {
+    input.push_back(
+        rect{ .origin = { .x = -1, .y = -1 }, .size = s } );
+  };
+
+  add_rect( size{ .w = 2, .h = 1 } );
+  add_rect( size{ .w = 2, .h = 2 } );
+  add_rect( size{ .w = 1, .h = 1 } );
+  add_rect( size{ .w = 8, .h = 4 } );
+  add_rect( size{ .w = 4, .h = 4 } );
+  add_rect( size{ .w = 1, .h = 1 } );
+  add_rect( size{ .w = 1, .h = 1 } );
+
+  maybe<RectPackStats> stats;
+
+  SECTION( "ample space, default options" ) {
+    stats = pack_rects_max_rects( input,
+                                  size{ .w = 100, .h = 100 } );
+    REQUIRE( stats ==
+             RectPackStats{ .size_used     = { .w = 19, .h = 4 },
+                            .area_occupied = 57 } );
+    REQUIRE( input[0].origin == point{ .x = 14, .y = 0 } );
+    REQUIRE( input[1].origin == point{ .x = 12, .y = 0 } );
+    REQUIRE( input[2].origin == point{ .x = 16, .y = 0 } );
+    REQUIRE( input[3].origin == point{ .x = 0, .y = 0 } );
+    REQUIRE( input[4].origin == point{ .x = 8, .y = 0 } );
+    REQUIRE( input[5].origin == point{ .x = 17, .y = 0 } );
+    REQUIRE( input[6].origin == point{ .x = 18, .y = 0 } );
+  }
+
+  SECTION( "ample space, best" ) {
+    stats = pack_rects_best( input, size{ .w = 100, .h = 100 } );
+    REQUIRE( stats ==
+             RectPackStats{ .size_used     = { .w = 15, .h = 4 },
+                            .area_occupied = 57 } );
+    REQUIRE( input[0].origin == point{ .x = 12, .y = 2 } );
+    REQUIRE( input[1].origin == point{ .x = 12, .y = 0 } );
+    REQUIRE( input[2].origin == point{ .x = 12, .y = 3 } );
+    REQUIRE( input[3].origin == point{ .x = 0, .y = 0 } );
+    REQUIRE( input[4].origin == point{ .x = 8, .y = 0 } );
+    REQUIRE( input[5].origin == point{ .x = 13, .y = 3 } );
+    REQUIRE( input[6].origin == point{ .x = 14, .y = 0 } );
+  }
+
+  SECTION( "not enough area" ) {
+    stats = pack_rects_best( input, size{ .w = 14, .h = 4 } );
+    REQUIRE( stats == nothing );
+  }
+
+  SECTION( "just enough height" ) {
+    stats = pack_rects_max_rects( input, size{ .w = 12, .h = 6 } );
+    REQUIRE( stats ==
+             RectPackStats{ .size_used     = { .w = 12, .h = 6 },
+                            .area_occupied = 57 } );
+    REQUIRE( input[0].origin == point{ .x = 2, .y = 4 } );
+    REQUIRE( input[1].origin == point{ .x = 0, .y = 4 } );
+    REQUIRE( input[2].origin == point{ .x = 2, .y = 5 } );
+    REQUIRE( input[3].origin == point{ .x = 0, .y = 0 } );
+    REQUIRE( input[4].origin == point{ .x = 8, .y = 0 } );
+    REQUIRE( input[5].origin == point{ .x = 3, .y = 5 } );
+    REQUIRE( input[6].origin == point{ .x = 4, .y = 4 } );
+  }
+}
+
+TEST_CASE( "[render/rect-pack] max_rects fills holes" ) {
+  vector<rect> input;
+  auto add_rect = [&]( size const s ) mutable {
+    input.push_back(
+        rect{ .origin = { .x = -1, .y = -1 }, .size = s } );
+  };
+
+  add_rect( size{ .w = 1, .h = 3 } );
+  add_rect( size{ .w = 2, .h = 2 } );
+  add_rect( size{ .w = 2, .h = 2 } );
+  add_rect( size{ .w = 2, .h = 3 } );
+  add_rect( size{ .w = 3, .h = 2 } );
+  add_rect( size{ .w = 1, .h = 1 } );
+  add_rect( size{ .w = 3, .h = 2 } );
+  add_rect( size{ .w = 1, .h = 5 } );
+
+  size const max_size = { .w = 8, .h = 5 };
+
+  // The shelf packer can't do it.
+  vector<rect> copy = input;
+  REQUIRE( pack_rects( copy, max_size ) == nothing );
+
+  maybe<RectPackStats> const stats =
+      pack_rects_best( input, max_size );
+  REQUIRE( stats ==
+           RectPackStats{ .size_used     = { .w = 8, .h = 5 },
+                          .area_occupied = 35 } );
+  REQUIRE( stats->efficiency() == 35.0 / 40.0 );
+  REQUIRE( input[0].origin == point{ .x = 6, .y = 2 } );
+  REQUIRE( input[1].origin == point{ .x = 3, .y = 2 } );
+  REQUIRE( input[2].origin == point{ .x = 6, .y = 0 } );
+  REQUIRE( input[3].origin == point{ .x = 0, .y = 0 } );
+  REQUIRE( input[4].origin == point{ .x = 0, .y = 3 } );
+  REQUIRE( input[5].origin == point{ .x = 2, .y = 2 } );
+  REQUIRE( input[6].origin == point{ .x = 2, .y = 0 } );
+  REQUIRE( input[7].origin == point{ .x = 5, .y = 0 } );
+}
+
+TEST_CASE( "[render/rect-pack] max_rects lots o squares" ) {
+  vector<rect> input;
+  for( int i = 0; i < 16 * 16; ++i )
+    input.push_back(
+        rect{ .origin = { .x = -1, .y = -1 },
+              .size   = { .w = 2, .h = 2 } } );
+
+  REQUIRE( pack_rects_best( input, size{ .w = 31, .h = 32 } ) ==
+           nothing );
+  maybe<RectPackStats> const stats =
+      pack_rects_best( input, size{ .w = 32, .h = 32 } );
+  REQUIRE( stats ==
+           RectPackStats{ .size_used     = { .w = 32, .h = 32 },
+                          .area_occupied = 32 * 32 } );
+  REQUIRE( stats->efficiency() == 1.0 );
+}
+
+TEST_CASE( "[render/rect-pack] max_rects no overlaps" ) {
+  vector<rect> input;
+  for( int i = 0; i < 100; ++i )
+    input.push_back(
+        rect{ .origin = { .x = -1, .y = -1 },
+              .size   = { .w = 1 + ( i * 7 ) % 13,
+                          .h = 1 + ( i * 11 ) % 17 } } );
+
+  maybe<RectPackStats> const stats =
+      pack_rects_best( input, size{ .w = 96, .h = 96 } );
+  REQUIRE( stats.has_value() );
+  REQUIRE( stats->area_occupied == 6240 );
+  REQUIRE( stats->efficiency() > .95 );
+
+  rect const bounds{ .origin = {}, .size = stats->size_used };
+  for( int i = 0; i < ssize( input ); ++i ) {
+    INFO( fmt::format( "i={}", i ) );
+    REQUIRE( input[i].is_inside( bounds ) );
+    for( int j = i + 1; j < ssize( input ); ++j ) {
+      INFO( fmt::format( "j={}", j ) );
+      maybe<rect> const overlap =
+          input[i].clipped_by( input[j] );
+      REQUIRE( ( !overlap.has_value() || overlap->area() == 0 ) );
+    }
+  }
+}
+
 } // namespace
 } // namespace rr
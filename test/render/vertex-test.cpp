@@ -42,14 +42,14 @@ TEST_CASE( "[render/vertex] SpriteVertex" ) {
   REQUIRE( gv.type == 0 );
   REQUIRE( gv.depixelate == gl::vec4{} );
   REQUIRE( gv.depixelate_stages == gl::vec4{} );
-  REQUIRE( gv.position == gl::vec2{ .x = 1, .y = 2 } );
-  REQUIRE( gv.atlas_position == gl::vec2{ .x = 3, .y = 4 } );
+  REQUIRE( gv.position == pack_i16x2( 1, 2 ) );
+  REQUIRE( gv.atlas_position == pack_u16x2( 3, 4 ) );
   REQUIRE( gv.atlas_rect ==
            gl::vec4{ .x = 5, .y = 6, .z = 1, .w = 2 } );
-  REQUIRE( gv.reference_position_1 == gl::vec2{} );
-  REQUIRE( gv.reference_position_2 == gl::vec2{} );
-  REQUIRE( gv.stencil_key_color == gl::color{} );
-  REQUIRE( gv.fixed_color == gl::color{} );
+  REQUIRE( gv.reference_position_1 == 0 );
+  REQUIRE( gv.reference_position_2 == 0 );
+  REQUIRE( gv.stencil_key_color == 0 );
+  REQUIRE( gv.fixed_color == 0 );
   REQUIRE( gv.alpha_multiplier == 1.0f );
 }
 
@@ -61,16 +61,15 @@ TEST_CASE( "[render/vertex] SolidVertex" ) {
   REQUIRE( gv.type == 1 );
   REQUIRE( gv.depixelate == gl::vec4{} );
   REQUIRE( gv.depixelate_stages == gl::vec4{} );
-  REQUIRE( gv.position == gl::vec2{ .x = 1, .y = 2 } );
-  REQUIRE( gv.atlas_position == gl::vec2{} );
+  REQUIRE( gv.position == pack_i16x2( 1, 2 ) );
+  REQUIRE( gv.atlas_position == 0 );
   REQUIRE( gv.atlas_rect == gl::vec4{} );
-  REQUIRE( gv.reference_position_1 == gl::vec2{} );
-  REQUIRE( gv.reference_position_2 == gl::vec2{} );
-  REQUIRE( gv.stencil_key_color == gl::color{} );
-  REQUIRE( gv.fixed_color == gl::color{ .r = 10.0f / 255.0f,
-                                        .g = 20.0f / 255.0f,
-                                        .b = 30.0f / 255.0f,
-                                        .a = 40.0f / 255.0f } );
+  REQUIRE( gv.reference_position_1 == 0 );
+  REQUIRE( gv.reference_position_2 == 0 );
+  REQUIRE( gv.stencil_key_color == 0 );
+  REQUIRE( gv.fixed_color ==
+           pack_rgba8(
+               pixel{ .r = 10, .g = 20, .b = 30, .a = 40 } ) );
   REQUIRE( gv.alpha_multiplier == 1.0f );
 }
 
@@ -86,19 +85,17 @@ TEST_CASE( "[render/vertex] SpriteStencilVertex" ) {
   REQUIRE( gv.type == 3 );
   REQUIRE( gv.depixelate == gl::vec4{} );
   REQUIRE( gv.depixelate_stages == gl::vec4{} );
-  REQUIRE( gv.position == gl::vec2{ .x = 1, .y = 2 } );
-  REQUIRE( gv.atlas_position == gl::vec2{ .x = 3, .y = 4 } );
+  REQUIRE( gv.position == pack_i16x2( 1, 2 ) );
+  REQUIRE( gv.atlas_position == pack_u16x2( 3, 4 ) );
   REQUIRE( gv.atlas_rect ==
            gl::vec4{ .x = 5, .y = 6, .z = 1, .w = 2 } );
   REQUIRE( gv.reference_position_1 ==
-           gl::vec2{ .x = 2, .y = 3 } );
-  REQUIRE( gv.reference_position_2 == gl::vec2{} );
+           pack_i16x2( 2, 3 ) );
+  REQUIRE( gv.reference_position_2 == 0 );
   REQUIRE( gv.stencil_key_color ==
-           gl::color{ .r = 10.0f / 255.0f,
-                      .g = 20.0f / 255.0f,
-                      .b = 30.0f / 255.0f,
-                      .a = 40.0f / 255.0f } );
-  REQUIRE( gv.fixed_color == gl::color{} );
+           pack_rgba8(
+               pixel{ .r = 10, .g = 20, .b = 30, .a = 40 } ) );
+  REQUIRE( gv.fixed_color == 0 );
   REQUIRE( gv.alpha_multiplier == 1.0f );
 }
 
@@ -114,21 +111,18 @@ TEST_CASE( "[render/vertex] FixedStencilVertex" ) {
   REQUIRE( gv.type == 2 );
   REQUIRE( gv.depixelate == gl::vec4{} );
   REQUIRE( gv.depixelate_stages == gl::vec4{} );
-  REQUIRE( gv.position == gl::vec2{ .x = 1, .y = 2 } );
-  REQUIRE( gv.atlas_position == gl::vec2{ .x = 3, .y = 4 } );
+  REQUIRE( gv.position == pack_i16x2( 1, 2 ) );
+  REQUIRE( gv.atlas_position == pack_u16x2( 3, 4 ) );
   REQUIRE( gv.atlas_rect ==
            gl::vec4{ .x = 5, .y = 6, .z = 1, .w = 2 } );
-  REQUIRE( gv.reference_position_1 == gl::vec2{} );
-  REQUIRE( gv.reference_position_2 == gl::vec2{} );
+  REQUIRE( gv.reference_position_1 == 0 );
+  REQUIRE( gv.reference_position_2 == 0 );
   REQUIRE( gv.stencil_key_color ==
-           gl::color{ .r = 10.0f / 255.0f,
-                      .g = 20.0f / 255.0f,
-                      .b = 30.0f / 255.0f,
-                      .a = 40.0f / 255.0f } );
-  REQUIRE( gv.fixed_color == gl::color{ .r = 20.0f / 255.0f,
-                                        .g = 30.0f / 255.0f,
-                                        .b = 40.0f / 255.0f,
-                                        .a = 50.0f / 255.0f } );
+           pack_rgba8(
+               pixel{ .r = 10, .g = 20, .b = 30, .a = 40 } ) );
+  REQUIRE( gv.fixed_color ==
+           pack_rgba8(
+               pixel{ .r = 20, .g = 30, .b = 40, .a = 50 } ) );
   REQUIRE( gv.alpha_multiplier == 1.0f );
 }
 
@@ -141,21 +135,45 @@ TEST_CASE( "[render/vertex] LineVertex" ) {
   REQUIRE( gv.type == 4 );
   REQUIRE( gv.depixelate == gl::vec4{} );
   REQUIRE( gv.depixelate_stages == gl::vec4{} );
-  REQUIRE( gv.position == gl::vec2{ .x = 1, .y = 2 } );
-  REQUIRE( gv.atlas_position == gl::vec2{} );
+  REQUIRE( gv.position == pack_i16x2( 1, 2 ) );
+  REQUIRE( gv.atlas_position == 0 );
   REQUIRE( gv.atlas_rect == gl::vec4{} );
   REQUIRE( gv.reference_position_1 ==
-           gl::vec2{ .x = 2, .y = 3 } );
+           pack_i16x2( 2, 3 ) );
   REQUIRE( gv.reference_position_2 ==
-           gl::vec2{ .x = 4, .y = 5 } );
-  REQUIRE( gv.stencil_key_color == gl::color{} );
-  REQUIRE( gv.fixed_color == gl::color{ .r = 10.0f / 255.0f,
-                                        .g = 20.0f / 255.0f,
-                                        .b = 30.0f / 255.0f,
-                                        .a = 40.0f / 255.0f } );
+           pack_i16x2( 4, 5 ) );
+  REQUIRE( gv.stencil_key_color == 0 );
+  REQUIRE( gv.fixed_color ==
+           pack_rgba8(
+               pixel{ .r = 10, .g = 20, .b = 30, .a = 40 } ) );
   REQUIRE( gv.alpha_multiplier == 1.0f );
 }
 
+TEST_CASE( "[render/vertex] packing" ) {
+  REQUIRE( pack_i16x2( 0, 0 ) == 0 );
+  REQUIRE( pack_i16x2( 1, 2 ) == 0x00020001 );
+  REQUIRE( pack_i16x2( -1, 2 ) == 0x0002ffff );
+  REQUIRE( pack_i16x2( 3, -4 ) == 0xfffc0003 );
+  REQUIRE( pack_u16x2( 65535, 7 ) == 0x0007ffff );
+  REQUIRE( pack_rgba8( pixel{ .r = 1, .g = 2, .b = 3, .a = 4 } ) ==
+           0x04030201 );
+
+  REQUIRE( unpack_i16x2( pack_i16x2( -32768, 32767 ) ) ==
+           point{ .x = -32768, .y = 32767 } );
+  REQUIRE( unpack_i16x2( pack_i16x2( -5, -6 ) ) ==
+           point{ .x = -5, .y = -6 } );
+  REQUIRE( unpack_u16x2( pack_u16x2( 65535, 0 ) ) ==
+           point{ .x = 65535, .y = 0 } );
+  REQUIRE( unpack_rgba8( pack_rgba8(
+               pixel{ .r = 10, .g = 200, .b = 30, .a = 255 } ) ) ==
+           pixel{ .r = 10, .g = 200, .b = 30, .a = 255 } );
+
+  REQUIRE( pack_i16x2( point{ .x = -3, .y = 9 } ) ==
+           pack_i16x2( -3, 9 ) );
+  REQUIRE( pack_u16x2( size{ .w = 4, .h = 5 } ) ==
+           pack_u16x2( 4, 5 ) );
+}
+
 TEST_CASE( "[render/vertex] depixelation" ) {
   maybe<TxDpxl> txdpxl;
   SpriteVertex vert( point{ .x = 1, .y = 2 },
@@ -167,8 +185,8 @@ TEST_CASE( "[render/vertex] depixelation" ) {
   REQUIRE( vert.depixelation_hash_anchor() == gl::vec2{} );
   REQUIRE( vert.depixelation_gradient() == gl::vec2{} );
   REQUIRE( vert.depixelation_stage_anchor() == gl::vec2{} );
-  REQUIRE( vert.generic().reference_position_1 == gl::vec2{} );
-  REQUIRE( vert.generic().reference_position_2 == gl::vec2{} );
+  REQUIRE( vert.generic().reference_position_1 == 0 );
+  REQUIRE( vert.generic().reference_position_2 == 0 );
   REQUIRE( vert.generic().depixelate == gl::vec4{} );
   REQUIRE( vert.generic().depixelate_stages == gl::vec4{} );
 
@@ -182,8 +200,8 @@ TEST_CASE( "[render/vertex] depixelation" ) {
            gl::vec2{ .x = 1, .y = 2 } );
   REQUIRE( vert.depixelation_gradient() ==
            gl::vec2{ .x = 4.4, .y = 5.5 } );
-  REQUIRE( vert.generic().reference_position_1 == gl::vec2{} );
-  REQUIRE( vert.generic().reference_position_2 == gl::vec2{} );
+  REQUIRE( vert.generic().reference_position_1 == 0 );
+  REQUIRE( vert.generic().reference_position_2 == 0 );
   REQUIRE( vert.generic().depixelate ==
            gl::vec4{ .x = 1, .y = 2, .z = .5, .w = 0 } );
   REQUIRE( vert.generic().depixelate_stages ==
@@ -198,8 +216,8 @@ TEST_CASE( "[render/vertex] depixelation" ) {
            gl::vec2{ .x = 1, .y = 2 } );
   REQUIRE( vert.depixelation_gradient() == gl::vec2{} );
   REQUIRE( vert.depixelation_stage_anchor() == gl::vec2{} );
-  REQUIRE( vert.generic().reference_position_1 == gl::vec2{} );
-  REQUIRE( vert.generic().reference_position_2 == gl::vec2{} );
+  REQUIRE( vert.generic().reference_position_1 == 0 );
+  REQUIRE( vert.generic().reference_position_2 == 0 );
   REQUIRE( vert.generic().depixelate ==
            gl::vec4{ .x = 1, .y = 2, .z = 1.0, .w = 1 } );
   REQUIRE( vert.generic().depixelate_stages == gl::vec4{} );
@@ -0,0 +1,428 @@
+/****************************************************************
+**replay-test.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Unit tests for the src/replay.* module.
+*
+*****************************************************************/
+#include "test/mocking.hpp"
+#include "test/testing.hpp"
+
+// Under test.
+#include "src/replay.hpp"
+
+// Testing
+#include "test/fake/world.hpp"
+#include "test/mocks/iagent.hpp"
+#include "test/mocks/iengine.hpp"
+#include "test/mocks/igui.hpp"
+#include "test/mocks/inative-agent.hpp"
+#include "test/mocks/land-view-plane.hpp"
+#include "test/util/coro.hpp"
+
+// Revolution Now
+#include "src/agents.hpp"
+#include "src/iraid.rds.hpp"
+#include "src/itribe-evolve.rds.hpp"
+#include "src/native-turn.hpp"
+#include "src/plane-stack.hpp"
+#include "src/rand.hpp"
+#include "src/ts.hpp"
+
+// ss
+#include "src/ss/native-enums.rds.hpp"
+#include "src/ss/player.rds.hpp"
+#include "src/ss/ref.hpp"
+#include "src/ss/root.hpp"
+#include "src/ss/woodcut.rds.hpp"
+
+// Must be last.
+#include "test/catch-common.hpp"
+
+namespace rn {
+namespace {
+
+using namespace std;
+
+using ::mock::matchers::_;
+
+command const kMove = command::move{ .d = e_direction::sw };
+
+/****************************************************************
+** Fakes
+*****************************************************************/
+// Skips all animations, so it can be used for any number of
+// moves without setting expectations for each one.
+struct UnattendedLandView : MockLandViewPlane {
+  wait<> animate_if_visible(
+      AnimationSequence const& ) override {
+    return make_wait<>();
+  }
+
+  wait<> animate_if_visible_and_hold(
+      AnimationSequence const& ) override {
+    return make_wait<>();
+  }
+};
+
+/****************************************************************
+** Test Cases
+*****************************************************************/
+
+TEST_CASE( "[replay] records and replays agent decisions" ) {
+  DecisionLog recorder;
+  REQUIRE( recorder.mode() == e_replay_mode::record );
+  {
+    auto inner = make_unique<MockIAgent>( e_player::dutch );
+    auto& mock = *inner;
+    ReplayAgent agent( std::move( inner ), recorder );
+    REQUIRE( agent.player_type() == e_player::dutch );
+
+    mock.EXPECT__name_colony().returns<maybe<string>>(
+        "my colony" );
+    REQUIRE( co_await_test( agent.name_colony() ) ==
+             "my colony" );
+
+    mock.EXPECT__ask_orders( UnitId{ 3 } ).returns( kMove );
+    REQUIRE( agent.ask_orders( UnitId{ 3 } ) == kMove );
+
+    mock.EXPECT__handle( signal::ChooseImmigrant{} )
+        .returns( 2 );
+    REQUIRE( co_await_test( agent.handle(
+                 signal::ChooseImmigrant{} ) ) == 2 );
+
+    // Not a decision, so not recorded.
+    mock.EXPECT__message_box( "hello" ).returns( make_wait<>() );
+    co_await_test( agent.message_box( "hello" ) );
+  }
+  REQUIRE( recorder.decisions().size() == 3 );
+  REQUIRE( recorder.decisions()[0].key == "dutch.name_colony" );
+  REQUIRE( recorder.decisions()[1].key == "dutch.ask_orders.3" );
+  REQUIRE( recorder.decisions()[2].key ==
+           "dutch.ChooseImmigrant" );
+
+  DecisionLog replayer( recorder.decisions() );
+  REQUIRE( replayer.mode() == e_replay_mode::replay );
+  {
+    // The inner agent is still asked for decisions so that it
+    // draws the same random numbers as when recording.
+    auto inner = make_unique<MockIAgent>( e_player::dutch );
+    auto& mock = *inner;
+    ReplayAgent agent( std::move( inner ), replayer );
+    mock.EXPECT__name_colony().returns<maybe<string>>(
+        "my colony" );
+    REQUIRE( co_await_test( agent.name_colony() ) ==
+             "my colony" );
+    mock.EXPECT__ask_orders( UnitId{ 3 } ).returns( kMove );
+    REQUIRE( agent.ask_orders( UnitId{ 3 } ) == kMove );
+    mock.EXPECT__handle( signal::ChooseImmigrant{} )
+        .returns( 2 );
+    REQUIRE( co_await_test( agent.handle(
+                 signal::ChooseImmigrant{} ) ) == 2 );
+  }
+  REQUIRE( replayer.num_replayed() == 3 );
+  REQUIRE( replayer.divergence() == nothing );
+}
+
+TEST_CASE( "[replay] agent makes a different decision" ) {
+  DecisionLog replayer( { ReplayDecision{
+    .key    = "dutch.ask_orders.3",
+    .result = cdr::run_conversion_to_canonical( kMove ) } } );
+  auto inner = make_unique<MockIAgent>( e_player::dutch );
+  auto& mock = *inner;
+  ReplayAgent agent( std::move( inner ), replayer );
+
+  // The agent's decision wins since that is what the game will
+  // continue with.
+  mock.EXPECT__ask_orders( UnitId{ 3 } )
+      .returns( command::forfeight{} );
+  REQUIRE( agent.ask_orders( UnitId{ 3 } ) ==
+           command::forfeight{} );
+  REQUIRE( replayer.num_replayed() == 0 );
+  REQUIRE( replayer.divergence() ==
+           "replay diverged at decision #0 "
+           "(`dutch.ask_orders.3'): the result differs from the "
+           "one in the log." );
+}
+
+TEST_CASE( "[replay] divergence" ) {
+  DecisionLog replayer( { ReplayDecision{
+    .key = "dutch.ask_orders.3", .result = cdr::null } } );
+  auto inner = make_unique<MockIAgent>( e_player::dutch );
+  auto& mock = *inner;
+  ReplayAgent agent( std::move( inner ), replayer );
+
+  // Different unit, so the inner agent is asked.
+  mock.EXPECT__ask_orders( UnitId{ 4 } ).returns( kMove );
+  REQUIRE( agent.ask_orders( UnitId{ 4 } ) == kMove );
+  REQUIRE( replayer.num_replayed() == 0 );
+  REQUIRE( replayer.divergence() ==
+           "replay diverged at decision #0 "
+           "(`dutch.ask_orders.4'): the log has "
+           "`dutch.ask_orders.3' instead." );
+
+  // Once diverged, everything is forwarded.
+  mock.EXPECT__ask_orders( UnitId{ 3 } ).returns( kMove );
+  REQUIRE( agent.ask_orders( UnitId{ 3 } ) == kMove );
+  REQUIRE( replayer.num_replayed() == 0 );
+}
+
+TEST_CASE( "[replay] malformed decision diverges" ) {
+  DecisionLog replayer( { ReplayDecision{
+    .key = "gui.int_input", .result = "hello" } } );
+  MockIGui mock_gui;
+  ReplayGui gui( mock_gui, replayer );
+
+  mock_gui.EXPECT__int_input( _ ).returns( 5 );
+  REQUIRE( co_await_test( gui.optional_int_input( {} ) ) ==
+           5 );
+  REQUIRE( replayer.divergence().has_value() );
+}
+
+TEST_CASE( "[replay] nested decisions are not recorded" ) {
+  DecisionLog recorder;
+  MockIGui mock_gui;
+  ReplayGui gui( mock_gui, recorder );
+
+  mock_gui.EXPECT__choice( _ ).returns<maybe<string>>( "b" );
+  int const n = recorder.decide_sync<int>( "outer", [&] {
+    // e.g. a human agent that asks the gui.
+    return co_await_test( gui.optional_choice( {} ) ) == "b"
+               ? 7
+               : 0;
+  } );
+  REQUIRE( n == 7 );
+  REQUIRE( recorder.decisions() ==
+           vector<ReplayDecision>{
+             { .key = "outer", .result = 7 } } );
+
+  mock_gui.EXPECT__choice( _ ).returns<maybe<string>>( "c" );
+  REQUIRE( co_await_test( gui.optional_choice( {} ) ) == "c" );
+  REQUIRE( recorder.decisions().size() == 2 );
+  REQUIRE( recorder.decisions()[1] ==
+           ReplayDecision{ .key    = "gui.choice",
+                           .result = "c" } );
+}
+
+TEST_CASE( "[replay] display-only gui calls are dropped" ) {
+  DecisionLog recorder;
+  // No expectations are set on this, so any call would fail.
+  MockIGui mock_gui;
+  ReplayGui gui( mock_gui, recorder );
+  co_await_test( gui.message_box( "hello" ) );
+  gui.transient_message_box( "hello" );
+  co_await_test(
+      gui.display_woodcut( e_woodcut::discovered_new_world ) );
+  REQUIRE( co_await_test( gui.wait_for( 5us ) ) == 5us );
+  REQUIRE( recorder.decisions().empty() );
+}
+
+TEST_CASE( "[replay] native agent" ) {
+  DecisionLog recorder;
+  {
+    auto inner =
+        make_unique<MockINativeAgent>( e_tribe::arawak );
+    auto& mock = *inner;
+    ReplayNativeAgent agent( std::move( inner ), recorder );
+    mock.EXPECT__select_unit(
+            set{ NativeUnitId{ 1 }, NativeUnitId{ 2 } } )
+        .returns( NativeUnitId{ 2 } );
+    REQUIRE( agent.select_unit( { NativeUnitId{ 1 },
+                                  NativeUnitId{ 2 } } ) ==
+             NativeUnitId{ 2 } );
+    mock.EXPECT__command_for( NativeUnitId{ 2 } )
+        .returns( NativeUnitCommand::forfeight{} );
+    REQUIRE( agent.command_for( NativeUnitId{ 2 } ) ==
+             NativeUnitCommand::forfeight{} );
+  }
+
+  DecisionLog replayer( recorder.decisions() );
+  auto inner = make_unique<MockINativeAgent>( e_tribe::arawak );
+  auto& mock = *inner;
+  ReplayNativeAgent agent( std::move( inner ), replayer );
+  mock.EXPECT__select_unit(
+          set{ NativeUnitId{ 1 }, NativeUnitId{ 2 } } )
+      .returns( NativeUnitId{ 2 } );
+  mock.EXPECT__command_for( NativeUnitId{ 2 } )
+      .returns( NativeUnitCommand::forfeight{} );
+  REQUIRE( agent.select_unit(
+               { NativeUnitId{ 1 }, NativeUnitId{ 2 } } ) ==
+           NativeUnitId{ 2 } );
+  REQUIRE( agent.command_for( NativeUnitId{ 2 } ) ==
+           NativeUnitCommand::forfeight{} );
+  REQUIRE( replayer.divergence() == nothing );
+}
+
+TEST_CASE( "[replay] save/load log" ) {
+  fs::path const file =
+      fs::temp_directory_path() / "rn-replay-test.rcl";
+  vector<ReplayDecision> const decisions{
+    { .key    = "dutch.ask_orders.3",
+      .result = cdr::run_conversion_to_canonical( kMove ) },
+    { .key = "dutch.name_colony", .result = cdr::null },
+    { .key = "gui.choice", .result = "some.thing" } };
+  ReplayLog const log{ .slot             = 3,
+                       .seed             = { 1, 2, 3, 4 },
+                       .num_turns        = 5,
+                       .start_state_hash = "0123456789abcdef",
+                       .final_state_hash = "fedcba9876543210",
+                       .decisions        = decisions };
+  REQUIRE( save_replay_log( file, log ).valid() );
+  base::expect<ReplayLog> const loaded = load_replay_log( file );
+  REQUIRE( loaded.has_value() );
+  REQUIRE( *loaded == log );
+  fs::remove( file );
+}
+
+TEST_CASE( "[replay] root_state_hash" ) {
+  RootState root;
+  uint64_t const h1 = root_state_hash( root );
+  REQUIRE( root_state_hash( root ) == h1 );
+  root.turn.time_point.turns = 3;
+  uint64_t const h2 = root_state_hash( root );
+  REQUIRE( h2 != h1 );
+  root.turn.time_point.turns = 0;
+  REQUIRE( root_state_hash( root ) == h1 );
+}
+
+TEST_CASE( "[replay] ReplaySession" ) {
+  ReplaySession recorder = ReplaySession::recorder(
+      fs::temp_directory_path() / "rn-replay-session.rcl",
+      /*slot=*/1, /*num_turns=*/2 );
+  REQUIRE( recorder.mode() == e_replay_mode::record );
+  RootState root;
+  rng::seed const seed{ 5, 6, 7, 8 };
+  REQUIRE( recorder.start( root, seed ) == seed );
+  REQUIRE( !recorder.turn_finished() );
+  REQUIRE( recorder.turn_finished() );
+  recorder.add_phase_time( "natives", 3ms );
+  recorder.add_phase_time( "natives", 4ms );
+  REQUIRE( recorder.phase_report() ==
+           "             natives:      7ms over 2 runs\n"
+           "               total:      7ms\n" );
+  root.turn.time_point.turns = 2;
+  REQUIRE( recorder.finish( root ).valid() );
+  REQUIRE( recorder.log().num_turns == 2 );
+  REQUIRE( recorder.log().seed == seed );
+
+  ReplaySession replayer =
+      ReplaySession::replayer( recorder.log() );
+  REQUIRE( replayer.mode() == e_replay_mode::replay );
+  root.turn.time_point.turns = 0;
+  // Seed from the log wins.
+  REQUIRE( replayer.start( root, rng::seed{} ) == seed );
+  REQUIRE( !replayer.turn_finished() );
+  REQUIRE( replayer.turn_finished() );
+  // Different final state.
+  REQUIRE( !replayer.finish( root ).valid() );
+  root.turn.time_point.turns = 2;
+  REQUIRE( replayer.finish( root ).valid() );
+  fs::remove( fs::temp_directory_path() /
+              "rn-replay-session.rcl" );
+}
+
+TEST_CASE( "[replay] human players are unattended" ) {
+  fs::path const file =
+      fs::temp_directory_path() / "rn-replay-human.rcl";
+
+  // Runs a one turn span in which the human player is asked for
+  // orders and is shown some things. No expectations are set on
+  // the gui mock, so this fails if anything asks for input.
+  auto const run = []( ReplaySession& session ) {
+    testing::World w;
+    w.add_player( e_player::dutch );
+    w.set_human_player_and_rest_ai( e_player::dutch );
+    REQUIRE( w.dutch().control == e_player_control::human );
+    put_human_players_under_ai_control( w.ss() );
+    REQUIRE( w.dutch().control == e_player_control::ai );
+    session.start( w.root(), rng::seed{ 1, 2, 3, 4 } );
+
+    ReplayGui gui( w.gui(), session.decisions() );
+    Agents const agents = create_replay_agents(
+        session, w.engine(), w.ss(), w.map_updater(),
+        w.planes(), gui, w.rand() );
+    IAgent& agent = agents[e_player::dutch];
+    REQUIRE( !agent.human() );
+    REQUIRE( agent.ask_orders( UnitId{ 1 } ) ==
+             command::forfeight{} );
+    co_await_test( agent.message_box( "hello" ) );
+    co_await_test( gui.message_box( "hello" ) );
+    REQUIRE( session.turn_finished() );
+    return session.finish( w.root() );
+  };
+
+  ReplaySession recorder = ReplaySession::recorder(
+      file, /*slot=*/1, /*num_turns=*/1 );
+  REQUIRE( run( recorder ).valid() );
+  REQUIRE( recorder.log().decisions.size() == 1 );
+
+  ReplaySession replayer =
+      ReplaySession::replayer( recorder.log() );
+  REQUIRE( run( replayer ).valid() );
+  REQUIRE( replayer.decisions().num_replayed() == 1 );
+  fs::remove( file );
+}
+
+TEST_CASE( "[replay] natives turns with real agents" ) {
+  fs::path const file =
+      fs::temp_directory_path() / "rn-replay-natives.rcl";
+
+  // Runs a few turns of the natives with the real AI agents and
+  // a real rng, which both they and the game rules draw from.
+  auto const run = []( ReplaySession& session ) {
+    testing::World w;
+    w.add_player( e_player::dutch );
+    w.set_human_player_and_rest_ai( e_player::dutch );
+    w.build_map( vector<MapSquare>( 8 * 8, w.make_grassland() ),
+                 8 );
+    w.add_dwelling_and_brave( { .x = 1, .y = 1 },
+                              e_tribe::arawak );
+    w.add_dwelling_and_brave( { .x = 6, .y = 2 },
+                              e_tribe::arawak );
+    w.add_dwelling_and_brave( { .x = 3, .y = 6 },
+                              e_tribe::sioux );
+    put_human_players_under_ai_control( w.ss() );
+
+    Rand rand;
+    rand.reseed(
+        session.start( w.root(), rng::seed{ 1, 2, 3, 4 } ) );
+    MockIEngine engine;
+    engine.EXPECT__rand().by_default().returns( rand );
+
+    UnattendedLandView land_view;
+    w.planes().get().set_bottom<ILandViewPlane>( land_view );
+
+    NativeAgents native_agents =
+        create_replay_native_agents( session, w.ss(), rand );
+    auto _1 = w.ts().set_native_agents( native_agents );
+    RealRaid const raid( w.ss(), w.ts(), rand );
+    RealTribeEvolve const tribe_evolver( w.ss(), rand );
+
+    do {
+      co_await_test( natives_turn( engine, w.ss(), w.ts(), raid,
+                                   tribe_evolver ) );
+    } while( !session.turn_finished() );
+    return session.finish( w.root() );
+  };
+
+  ReplaySession recorder = ReplaySession::recorder(
+      file, /*slot=*/1, /*num_turns=*/10 );
+  REQUIRE( run( recorder ).valid() );
+  ReplayLog const& log = recorder.log();
+  REQUIRE( log.decisions.size() > 10 );
+  REQUIRE( log.final_state_hash != log.start_state_hash );
+
+  ReplaySession replayer = ReplaySession::replayer( log );
+  base::valid_or<string> const replayed = run( replayer );
+  INFO( replayed.valid() ? "" : replayed.error() );
+  REQUIRE( replayed.valid() );
+  REQUIRE( replayer.decisions().num_replayed() ==
+           ssize( log.decisions ) );
+  fs::remove( file );
+}
+
+} // namespace
+} // namespace rn
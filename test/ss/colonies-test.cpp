@@ -41,5 +41,36 @@ TEST_CASE( "[ss/colonies] last_colony_id" ) {
   REQUIRE( colonies_state.last_colony_id() == 2 );
 }
 
+TEST_CASE( "[ss/colonies] colonies_within/closest_colonies" ) {
+  ColoniesState colonies_state;
+
+  gfx::point const tile{ .x = 5, .y = 5 };
+  REQUIRE( colonies_state.colonies_within( tile, 10 ).empty() );
+  REQUIRE( colonies_state.closest_colonies( tile, 2 ).empty() );
+
+  colonies_state.add_colony( Colony{
+    .name = "1", .location = { .x = 20, .y = 5 } } );
+  colonies_state.add_colony( Colony{
+    .name = "2", .location = { .x = 6, .y = 6 } } );
+  colonies_state.add_colony( Colony{
+    .name = "3", .location = { .x = 4, .y = 4 } } );
+
+  REQUIRE( colonies_state.colonies_within( tile, 2 ) ==
+           vector<ColonyId>{ 2, 3 } );
+  REQUIRE( colonies_state.colonies_within( tile, 15 ) ==
+           vector<ColonyId>{ 2, 3, 1 } );
+  REQUIRE( colonies_state.closest_colonies( tile, 1 ) ==
+           vector<ColonyId>{ 2 } );
+  REQUIRE( colonies_state.closest_colonies(
+               { .x = 30, .y = 5 }, 2 ) ==
+           vector<ColonyId>{ 1, 2 } );
+
+  colonies_state.destroy_colony( 2 );
+  REQUIRE( colonies_state.colonies_within( tile, 2 ) ==
+           vector<ColonyId>{ 3 } );
+  REQUIRE( colonies_state.closest_colonies( tile, 1 ) ==
+           vector<ColonyId>{ 3 } );
+}
+
 } // namespace
 } // namespace rn
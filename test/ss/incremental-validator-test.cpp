@@ -0,0 +1,130 @@
+/****************************************************************
+**incremental-validator-test.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-19.
+*
+* Description: Unit tests for the src/ss/incremental-validator.*
+*              module.
+*
+*****************************************************************/
+#include "test/testing.hpp"
+
+// Under test.
+#include "src/ss/incremental-validator.hpp"
+
+// Testing.
+#include "test/fake/world.hpp"
+
+// ss
+#include "src/ss/dwelling.rds.hpp"
+#include "src/ss/natives.hpp"
+#include "src/ss/root.hpp"
+
+// Must be last.
+#include "test/catch-common.hpp" // IWYU pragma: keep
+
+namespace rn {
+namespace {
+
+using namespace std;
+
+using ::base::valid;
+using ::base::valid_or;
+using ::Catch::Matchers::Contains;
+
+/****************************************************************
+** Fake World Setup
+*****************************************************************/
+struct world : testing::World {
+  world() {
+    add_player( e_player::dutch );
+    set_default_player_type( e_player::dutch );
+    create_default_map();
+    // Patches to satisfy validation.
+    root().land_view.viewport.zoom = 1.0;
+  }
+
+  void create_default_map() {
+    MapSquare const L = make_grassland();
+    vector<MapSquare> tiles{
+      L, L, L, //
+      L, L, L, //
+      L, L, L, //
+    };
+    build_map( std::move( tiles ), 3 );
+  }
+};
+
+/****************************************************************
+** Test Cases
+*****************************************************************/
+TEST_CASE( "[ss/incremental-validator] validate" ) {
+  world w;
+  IncrementalValidator validator;
+
+  auto const f = [&] [[clang::noinline]] {
+    return validator.validate( w.root() );
+  };
+
+  DwellingId const dwelling_id =
+      w.add_dwelling( { .x = 0, .y = 0 }, e_tribe::apache ).id;
+  REQUIRE( validate_recursive_non_terrain( w.root() ) == valid );
+  REQUIRE( f() == valid );
+  REQUIRE( f() == valid );
+
+  // Entity added.
+  w.add_dwelling( { .x = 2, .y = 2 }, e_tribe::sioux );
+  REQUIRE( f() == valid );
+
+  // Entity changed.
+  Dwelling& dwelling = w.natives().dwelling_for( dwelling_id );
+  dwelling.relationship[e_player::dutch].dwelling_only_alarm =
+      100;
+  valid_or<string> res = f();
+  REQUIRE( res != valid );
+  REQUIRE_THAT( res.error(),
+                Contains( "root.natives.dwellings[" ) );
+  REQUIRE_THAT(
+      res.error(),
+      Contains( "dwelling_only_alarm must be in [0, 99]." ) );
+  // Still fails since the failed pass does not record anything.
+  REQUIRE( f() != valid );
+
+  dwelling.relationship[e_player::dutch].dwelling_only_alarm =
+      99;
+  REQUIRE( f() == valid );
+
+  // Top-level group changed.
+  w.turn().time_point.year = -1;
+  res = f();
+  REQUIRE( res != valid );
+  REQUIRE_THAT( res.error(), Contains( "root.turn" ) );
+  REQUIRE_THAT( res.error(),
+                Contains( "game year must be >= 0" ) );
+
+  w.turn().time_point.year = 1600;
+  REQUIRE( f() == valid );
+}
+
+TEST_CASE( "[ss/incremental-validator] reset" ) {
+  world w;
+  IncrementalValidator validator;
+
+  auto const f = [&] [[clang::noinline]] {
+    return validator.validate( w.root() );
+  };
+
+  REQUIRE( f() == valid );
+  w.root().version.major = -1;
+  validator.reset();
+  REQUIRE_THAT(
+      f().error(),
+      Contains( "major version number must be >= 0" ) );
+  w.root().version.major = 0;
+  REQUIRE( f() == valid );
+}
+
+} // namespace
+} // namespace rn
@@ -31,6 +31,8 @@ namespace {
 
 using namespace std;
 
+using ::gfx::point;
+
 /****************************************************************
 ** Fake World Setup
 *****************************************************************/
@@ -100,6 +102,27 @@ TEST_CASE(
           .has_value() );
 }
 
+TEST_CASE(
+    "[ss/natives] dwellings_within / closest_dwellings" ) {
+  World W;
+  point const tile{ .x = 2, .y = 2 };
+  REQUIRE( W.natives().dwellings_within( tile, 5 ).empty() );
+  W.add_dwelling( { .x = 4, .y = 4 }, e_tribe::iroquois );
+  W.add_dwelling( { .x = 3, .y = 2 }, e_tribe::iroquois );
+  W.add_dwelling( { .x = 0, .y = 0 }, e_tribe::cherokee );
+  REQUIRE( W.natives().dwellings_within( tile, 1 ) ==
+           vector{ DwellingId{ 2 } } );
+  REQUIRE( W.natives().dwellings_within( tile, 3 ) ==
+           vector{ DwellingId{ 2 }, DwellingId{ 1 },
+                   DwellingId{ 3 } } );
+  REQUIRE( W.natives().closest_dwellings( tile, 2 ) ==
+           vector{ DwellingId{ 2 }, DwellingId{ 1 } } );
+  W.natives().destroy_dwelling( DwellingId{ 2 } );
+  REQUIRE( W.natives().dwellings_within( tile, 1 ).empty() );
+  REQUIRE( W.natives().closest_dwellings( tile, 1 ) ==
+           vector{ DwellingId{ 1 } } );
+}
+
 TEST_CASE( "[ss/natives] destroy_tribe_last_step" ) {
   World W;
   REQUIRE_FALSE( W.natives().tribe_exists( e_tribe::arawak ) );
@@ -63,6 +63,7 @@ value cdr_game_state_default = table{
         "seeds"_key =
           table{
             "gameplay_seed"_key = null,
+            "engine"_key = "mersenne",
           },
       },
   "settings"_key =
@@ -594,5 +595,31 @@ TEST_CASE( "[ss/ref] validate_non_terrain_game_state" ) {
       Contains( "major version number must be >= 0" ) );
 }
 
+TEST_CASE( "[ss/ref] validate_changed_game_state" ) {
+  SS ss;
+  RootState& root = ss.root;
+
+  // Patches to satisfy validation.
+  root.land_view.viewport.zoom = 1.0;
+
+  auto const f = [&] [[clang::noinline]] {
+    return ss.validate_changed_game_state();
+  };
+
+  REQUIRE( f() == valid );
+
+  root.turn.time_point.year = -1;
+  REQUIRE_THAT( f().error(),
+                Contains( "game year must be >= 0" ) );
+
+  root.turn.time_point.year = 0;
+  REQUIRE( f() == valid );
+
+  root.version.major = -1;
+  REQUIRE_THAT(
+      f().error(),
+      Contains( "major version number must be >= 0" ) );
+}
+
 } // namespace
 } // namespace rn
@@ -0,0 +1,112 @@
+/****************************************************************
+**tile-buckets-test.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Unit tests for the src/ss/tile-buckets.* module.
+*
+*****************************************************************/
+#include "test/testing.hpp"
+
+// Under test.
+#include "src/ss/tile-buckets.hpp"
+
+// C++ standard library
+#include <vector>
+
+// Must be last.
+#include "test/catch-common.hpp" // IWYU pragma: keep
+
+namespace rn {
+namespace {
+
+using namespace std;
+
+using ::gfx::point;
+
+/****************************************************************
+** Test Cases
+*****************************************************************/
+TEST_CASE( "[ss/tile-buckets] within" ) {
+  TileBuckets<int> buckets;
+  point const center{ .x = 10, .y = 10 };
+  REQUIRE( buckets.within( center, 100 ).empty() );
+
+  buckets.add( { .x = 10, .y = 10 }, 5 );
+  buckets.add( { .x = 11, .y = 10 }, 3 );
+  buckets.add( { .x = 9, .y = 10 }, 2 );
+  buckets.add( { .x = 11, .y = 11 }, 1 );
+  buckets.add( { .x = 13, .y = 14 }, 4 );
+  buckets.add( { .x = 0, .y = 0 }, 6 );
+  buckets.add( { .x = 40, .y = 2 }, 7 );
+  REQUIRE( buckets.size() == 7 );
+
+  REQUIRE( buckets.within( center, 0 ) == vector{ 5 } );
+  REQUIRE( buckets.within( center, 1 ) == vector{ 5, 2, 3 } );
+  REQUIRE( buckets.within( center, 1.5 ) ==
+           vector{ 5, 2, 3, 1 } );
+  // Exactly on the boundary is included.
+  REQUIRE( buckets.within( center, 5 ) ==
+           vector{ 5, 2, 3, 1, 4 } );
+  REQUIRE( buckets.within( center, 100 ) ==
+           vector{ 5, 2, 3, 1, 4, 6, 7 } );
+  REQUIRE( buckets.within( center, -1 ).empty() );
+  // Center off of the map.
+  REQUIRE( buckets.within( { .x = -2, .y = -2 }, 3 ) ==
+           vector{ 6 } );
+
+  buckets.remove( { .x = 9, .y = 10 }, 2 );
+  REQUIRE( buckets.size() == 6 );
+  REQUIRE( buckets.within( center, 1 ) == vector{ 5, 3 } );
+}
+
+TEST_CASE( "[ss/tile-buckets] nearest" ) {
+  TileBuckets<int> buckets;
+  point const center{ .x = 10, .y = 10 };
+  REQUIRE( buckets.nearest( center, 3 ).empty() );
+
+  buckets.add( { .x = 40, .y = 2 }, 7 );
+  REQUIRE( buckets.nearest( center, 3 ) == vector{ 7 } );
+
+  buckets.add( { .x = 0, .y = 0 }, 6 );
+  buckets.add( { .x = 13, .y = 14 }, 4 );
+  buckets.add( { .x = 11, .y = 10 }, 3 );
+  buckets.add( { .x = 10, .y = 11 }, 1 );
+
+  REQUIRE( buckets.nearest( center, 0 ).empty() );
+  // Ties are broken by id.
+  REQUIRE( buckets.nearest( center, 1 ) == vector{ 1 } );
+  REQUIRE( buckets.nearest( center, 2 ) == vector{ 1, 3 } );
+  REQUIRE( buckets.nearest( center, 3 ) == vector{ 1, 3, 4 } );
+  REQUIRE( buckets.nearest( center, 4 ) ==
+           vector{ 1, 3, 4, 6 } );
+  REQUIRE( buckets.nearest( center, 10 ) ==
+           vector{ 1, 3, 4, 6, 7 } );
+
+  // Something closer in a farther bucket is still found before
+  // something farther in the same bucket.
+  REQUIRE( buckets.nearest( { .x = 7, .y = 7 }, 1 ) ==
+           vector{ 1 } );
+  REQUIRE( buckets.nearest( { .x = 7, .y = 7 }, 2 ) ==
+           vector{ 1, 3 } );
+  REQUIRE( buckets.nearest( { .x = 15, .y = 15 }, 1 ) ==
+           vector{ 4 } );
+  // Center in an empty bucket.
+  REQUIRE( buckets.nearest( { .x = 16, .y = 10 }, 2 ) ==
+           vector{ 3, 4 } );
+}
+
+TEST_CASE( "[ss/tile-buckets] equality" ) {
+  TileBuckets<int> b1, b2;
+  b1.add( { .x = 1, .y = 1 }, 1 );
+  b1.add( { .x = 2, .y = 1 }, 2 );
+  b2.add( { .x = 2, .y = 1 }, 2 );
+  REQUIRE( b1 != b2 );
+  b2.add( { .x = 1, .y = 1 }, 1 );
+  REQUIRE( b1 == b2 );
+}
+
+} // namespace
+} // namespace rn
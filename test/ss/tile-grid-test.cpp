@@ -0,0 +1,106 @@
+/****************************************************************
+**tile-grid-test.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-18.
+*
+* Description: Unit tests for the src/ss/tile-grid.* module.
+*
+*****************************************************************/
+#include "test/testing.hpp"
+
+// Under test.
+#include "src/ss/tile-grid.hpp"
+
+// C++ standard library
+#include <vector>
+
+// Must be last.
+#include "test/catch-common.hpp" // IWYU pragma: keep
+
+namespace rn {
+namespace {
+
+using namespace std;
+
+using ::gfx::point;
+using ::gfx::rect;
+
+/****************************************************************
+** Test Cases
+*****************************************************************/
+TEST_CASE( "[ss/tile-grid] read/write" ) {
+  TileGrid<int> grid;
+  REQUIRE( grid.size() == Delta{} );
+  REQUIRE( grid[{ .x = 0, .y = 0 }] == 0 );
+  REQUIRE( grid[{ .x = 5, .y = 3 }] == 0 );
+  REQUIRE( grid[{ .x = -1, .y = 3 }] == 0 );
+
+  grid.mut( { .x = 2, .y = 1 } ) = 7;
+  REQUIRE( grid.size() == Delta{ .w = 3, .h = 2 } );
+  REQUIRE( grid[{ .x = 2, .y = 1 }] == 7 );
+  REQUIRE( grid[{ .x = 1, .y = 1 }] == 0 );
+
+  // Growing keeps the existing records.
+  grid.mut( { .x = 4, .y = 0 } ) = 3;
+  REQUIRE( grid.size() == Delta{ .w = 6, .h = 2 } );
+  REQUIRE( grid[{ .x = 2, .y = 1 }] == 7 );
+  REQUIRE( grid[{ .x = 4, .y = 0 }] == 3 );
+
+  grid.mut( { .x = 0, .y = 9 } ) = 1;
+  REQUIRE( grid.size() == Delta{ .w = 6, .h = 10 } );
+  REQUIRE( grid[{ .x = 2, .y = 1 }] == 7 );
+  REQUIRE( grid[{ .x = 4, .y = 0 }] == 3 );
+  REQUIRE( grid[{ .x = 0, .y = 9 }] == 1 );
+
+  grid.reset( { .x = 2, .y = 1 } );
+  REQUIRE( grid[{ .x = 2, .y = 1 }] == 0 );
+  // Out of bounds is a no-op.
+  grid.reset( { .x = 20, .y = 1 } );
+  REQUIRE( grid.size() == Delta{ .w = 6, .h = 10 } );
+
+  grid.clear();
+  REQUIRE( grid.size() == Delta{} );
+  REQUIRE( grid[{ .x = 4, .y = 0 }] == 0 );
+}
+
+TEST_CASE( "[ss/tile-grid] equality" ) {
+  TileGrid<int> grid1;
+  TileGrid<int> grid2;
+  REQUIRE( grid1 == grid2 );
+
+  grid1.mut( { .x = 1, .y = 1 } ) = 2;
+  REQUIRE( grid1 != grid2 );
+  grid2.mut( { .x = 1, .y = 1 } ) = 2;
+  REQUIRE( grid1 == grid2 );
+
+  // Different sizes but the same records.
+  grid2.mut( { .x = 8, .y = 8 } ) = 0;
+  REQUIRE( grid1.size() != grid2.size() );
+  REQUIRE( grid1 == grid2 );
+  REQUIRE( grid2 == grid1 );
+}
+
+TEST_CASE( "[ss/tile-grid] for_each_in" ) {
+  TileGrid<int> grid;
+  grid.mut( { .x = 1, .y = 0 } ) = 1;
+  grid.mut( { .x = 1, .y = 1 } ) = 2;
+
+  vector<pair<point, int>> seen;
+  grid.for_each_in( rect{ .origin = { .x = 1, .y = 0 },
+                          .size   = { .w = 2, .h = 2 } },
+                    [&]( int const n, point const p ) {
+                      seen.push_back( { p, n } );
+                    } );
+  vector<pair<point, int>> const expected{
+    { { .x = 1, .y = 0 }, 1 },
+    { { .x = 2, .y = 0 }, 0 },
+    { { .x = 1, .y = 1 }, 2 },
+    { { .x = 2, .y = 1 }, 0 },
+  };
+  REQUIRE( seen == expected );
+}
+
+} // namespace
+} // namespace rn
@@ -16,10 +16,17 @@
 // Testing
 #include "test/fake/world.hpp"
 
+// Revolution Now
+#include "src/unit-mgr.hpp"
+
 // ss
 #include "src/ss/dwelling.rds.hpp"
 
+// gfx
+#include "src/gfx/iter.hpp"
+
 // refl
+#include "src/refl/query-enum.hpp"
 #include "src/refl/to-str.hpp"
 
 // base
@@ -530,5 +537,264 @@ TEST_CASE( "[ss/units] ordered_euro_units_from_tile" ) {
                { .x = 2, .y = 1 } ) == expected );
 }
 
+TEST_CASE( "[ss/units] euro_units_for_player" ) {
+  using enum e_unit_type;
+  using enum e_player;
+  using E = UnitOwnership::e;
+  world w;
+  set<UnitId> expected;
+
+  auto const f = [&]( e_player const player ) {
+    return w.units().euro_units_for_player( player );
+  };
+  auto const g = [&]( e_player const player, E const kind ) {
+    return w.units().euro_units_for_player( player, kind );
+  };
+
+  // Sanity check that the indices match what we'd get if we
+  // were to rebuild them from scratch, e.g. on load.
+  auto const check_rebuilt = [&] {
+    UnitsState const rebuilt(
+        wrapped::UnitsState( w.units().refl() ) );
+    for( e_player const player : refl::enum_values<e_player> ) {
+      INFO( fmt::format( "player={}", player ) );
+      REQUIRE( rebuilt.euro_units_for_player( player ) ==
+               f( player ) );
+      for( E const kind : { E::free, E::world, E::cargo,
+                            E::harbor, E::colony, E::dwelling } )
+        REQUIRE( rebuilt.euro_units_for_player(
+                     player, kind ) == g( player, kind ) );
+    }
+  };
+
+  REQUIRE( f( french ).empty() );
+  REQUIRE( f( english ).empty() );
+  REQUIRE( g( french, E::world ).empty() );
+
+  Unit const& ship = w.add_unit_in_port( merchantman ); // 1
+  w.add_unit_in_cargo( free_colonist, ship.id() );      // 2
+  w.add_unit_on_map( soldier, { .x = 1, .y = 1 } );     // 3
+  w.add_unit_on_map( soldier, { .x = 1, .y = 1 },
+                     english ); // 4
+  Colony const& colony = w.add_colony( { .x = 2, .y = 2 } );
+  w.add_unit_indoors( colony.id, e_indoor_job::bells ); // 5
+
+  expected = { UnitId{ 1 }, UnitId{ 2 }, UnitId{ 3 },
+               UnitId{ 5 } };
+  REQUIRE( f( french ) == expected );
+  expected = { UnitId{ 4 } };
+  REQUIRE( f( english ) == expected );
+
+  expected = { UnitId{ 1 } };
+  REQUIRE( g( french, E::harbor ) == expected );
+  expected = { UnitId{ 2 } };
+  REQUIRE( g( french, E::cargo ) == expected );
+  expected = { UnitId{ 3 } };
+  REQUIRE( g( french, E::world ) == expected );
+  expected = { UnitId{ 5 } };
+  REQUIRE( g( french, E::colony ) == expected );
+  REQUIRE( g( french, E::dwelling ).empty() );
+  REQUIRE( g( french, E::free ).empty() );
+  expected = { UnitId{ 4 } };
+  REQUIRE( g( english, E::world ) == expected );
+  REQUIRE( g( english, E::harbor ).empty() );
+  check_rebuilt();
+
+  // Ownership change.
+  testing_friend_change_to_map( w.units(), UnitId{ 5 },
+                                { .x = 1, .y = 1 } );
+  expected = { UnitId{ 3 }, UnitId{ 5 } };
+  REQUIRE( g( french, E::world ) == expected );
+  REQUIRE( g( french, E::colony ).empty() );
+  check_rebuilt();
+
+  // Player change, which also changes the cargo.
+  change_unit_player( w.ss(), w.ts(),
+                      w.units().unit_for( ship.id() ), english );
+  expected = { UnitId{ 3 }, UnitId{ 5 } };
+  REQUIRE( f( french ) == expected );
+  expected = { UnitId{ 1 }, UnitId{ 2 }, UnitId{ 4 } };
+  REQUIRE( f( english ) == expected );
+  REQUIRE( g( french, E::harbor ).empty() );
+  expected = { UnitId{ 1 } };
+  REQUIRE( g( english, E::harbor ) == expected );
+  expected = { UnitId{ 2 } };
+  REQUIRE( g( english, E::cargo ) == expected );
+  check_rebuilt();
+
+  // Destruction.
+  testing_friend_destroy_unit( w.units(), UnitId{ 3 } );
+  expected = { UnitId{ 5 } };
+  REQUIRE( f( french ) == expected );
+  REQUIRE( g( french, E::world ) == expected );
+  check_rebuilt();
+}
+
+TEST_CASE( "[ss/units] unit_stats_for_player" ) {
+  using enum e_unit_type;
+  using enum e_player;
+  world w;
+  PlayerUnitStats french_expected, english_expected;
+
+  auto const f = [&]( e_player const player ) {
+    return w.units().unit_stats_for_player( player );
+  };
+
+  // Should match what we'd get if we were to rebuild it from
+  // scratch, e.g. on load.
+  auto const check_rebuilt = [&] {
+    UnitsState const rebuilt(
+        wrapped::UnitsState( w.units().refl() ) );
+    for( e_player const player : refl::enum_values<e_player> ) {
+      INFO( fmt::format( "player={}", player ) );
+      REQUIRE( rebuilt.unit_stats_for_player( player ) ==
+               f( player ) );
+    }
+  };
+
+  REQUIRE( f( french ) == PlayerUnitStats{} );
+  REQUIRE( f( english ) == PlayerUnitStats{} );
+
+  Unit const& ship = w.add_unit_in_port( merchantman ); // 1
+  w.add_unit_in_cargo( free_colonist, ship.id() );      // 2
+  w.add_unit_in_port( expert_farmer );                  // 3
+  Unit const& caravel_unit =
+      w.add_unit_on_map( caravel, { .x = 0, .y = 0 } ); // 4
+  w.add_unit_on_map( free_colonist, { .x = 1, .y = 1 },
+                     english ); // 5
+
+  french_expected.total                     = 4;
+  french_expected.colonists                 = 2;
+  french_expected.by_type[merchantman]      = 1;
+  french_expected.by_type[free_colonist]    = 1;
+  french_expected.by_type[expert_farmer]    = 1;
+  french_expected.by_type[caravel]          = 1;
+  french_expected.on_dock                   = 1;
+  french_expected.in_cargo_of_ships_in_port = 1;
+  english_expected.total                    = 1;
+  english_expected.colonists                = 1;
+  english_expected.by_type[free_colonist]   = 1;
+  REQUIRE( f( french ) == french_expected );
+  REQUIRE( f( english ) == english_expected );
+  check_rebuilt();
+
+  // Cargo of a ship that is not in port.
+  w.add_unit_in_cargo( free_colonist, caravel_unit.id() ); // 6
+  french_expected.total                  = 5;
+  french_expected.colonists              = 3;
+  french_expected.by_type[free_colonist] = 2;
+  REQUIRE( f( french ) == french_expected );
+  check_rebuilt();
+
+  // Ship leaving port.
+  w.ship_to_outbound( ship.id() );
+  french_expected.in_cargo_of_ships_in_port = 0;
+  REQUIRE( f( french ) == french_expected );
+  check_rebuilt();
+
+  // Type change.
+  change_unit_type( w.ss(), w.ts(),
+                    w.units().unit_for( UnitId{ 3 } ),
+                    free_colonist );
+  french_expected.by_type[expert_farmer] = 0;
+  french_expected.by_type[free_colonist] = 3;
+  REQUIRE( f( french ) == french_expected );
+  check_rebuilt();
+
+  // Player change, which also changes the cargo.
+  change_unit_player( w.ss(), w.ts(),
+                      w.units().unit_for( ship.id() ), english );
+  french_expected.total                   = 3;
+  french_expected.colonists               = 2;
+  french_expected.by_type[merchantman]    = 0;
+  french_expected.by_type[free_colonist]  = 2;
+  english_expected.total                  = 3;
+  english_expected.colonists              = 2;
+  english_expected.by_type[merchantman]   = 1;
+  english_expected.by_type[free_colonist] = 2;
+  REQUIRE( f( french ) == french_expected );
+  REQUIRE( f( english ) == english_expected );
+  check_rebuilt();
+
+  // Destruction.
+  testing_friend_destroy_unit( w.units(), UnitId{ 3 } );
+  french_expected.total                  = 2;
+  french_expected.colonists              = 1;
+  french_expected.by_type[free_colonist] = 1;
+  french_expected.on_dock                = 0;
+  REQUIRE( f( french ) == french_expected );
+  check_rebuilt();
+}
+
+TEST_CASE( "[ss/units] on_tile" ) {
+  using enum e_unit_type;
+  using enum e_player;
+  world w;
+  point const tile{ .x = 1, .y = 1 };
+
+  auto const f = [&] { return w.units().on_tile( tile ); };
+
+  // Should match what we'd get if we were to rebuild it from
+  // scratch, e.g. on load.
+  auto const check_rebuilt = [&] {
+    UnitsState const rebuilt(
+        wrapped::UnitsState( w.units().refl() ) );
+    for( point const p : gfx::rect_iterator(
+             gfx::rect{ .size = { .w = 3, .h = 3 } } ) ) {
+      INFO( fmt::format( "p={}", p ) );
+      REQUIRE( rebuilt.on_tile( p ) == w.units().on_tile( p ) );
+    }
+  };
+
+  REQUIRE( f() == UnitsOnTile{} );
+  // Off the map.
+  REQUIRE( w.units().on_tile( { .x = 100, .y = 100 } ) ==
+           UnitsOnTile{} );
+
+  Unit const& soldier1 = w.add_unit_on_map( soldier, tile );
+  REQUIRE( f() == UnitsOnTile{ .count  = 1,
+                               .kind   = e_unit_kind::euro,
+                               .player = french } );
+  Unit const& soldier2 = w.add_unit_on_map( soldier, tile );
+  REQUIRE( f() == UnitsOnTile{ .count  = 2,
+                               .kind   = e_unit_kind::euro,
+                               .player = french } );
+  check_rebuilt();
+
+  // Player change.
+  change_unit_player( w.ss(), w.ts(),
+                      w.units().unit_for( soldier1.id() ),
+                      english );
+  change_unit_player( w.ss(), w.ts(),
+                      w.units().unit_for( soldier2.id() ),
+                      english );
+  REQUIRE( f() == UnitsOnTile{ .count  = 2,
+                               .kind   = e_unit_kind::euro,
+                               .player = english } );
+  check_rebuilt();
+
+  // Leaving the tile.
+  testing_friend_change_to_map( w.units(), soldier1.id(),
+                                { .x = 0, .y = 1 } );
+  REQUIRE( f().count == 1 );
+  REQUIRE( w.units().on_tile( { .x = 0, .y = 1 } ).count == 1 );
+  testing_friend_destroy_unit( w.units(), soldier2.id() );
+  REQUIRE( f() == UnitsOnTile{} );
+  check_rebuilt();
+
+  // Native units.
+  Dwelling const& dwelling =
+      w.add_dwelling( { .x = 2, .y = 2 }, e_tribe::inca );
+  NativeUnit const& brave = w.add_native_unit_on_map(
+      e_native_unit_type::brave, tile, dwelling.id );
+  REQUIRE( f() ==
+           UnitsOnTile{ .count       = 1,
+                        .kind        = e_unit_kind::native,
+                        .dwelling_id = dwelling.id } );
+  check_rebuilt();
+  w.units().destroy_unit( brave.id );
+  REQUIRE( f() == UnitsOnTile{} );
+}
+
 } // namespace
 } // namespace rn
@@ -48,5 +48,57 @@ TEST_CASE( "[text] rendered_text_size (no crash on empty)" ) {
   REQUIRE( f() == expected );
 }
 
+TEST_CASE( "[text] reflow_text_markup" ) {
+  TextReflowInfo const r_info{ .max_cols = 11 };
+  string_view const text = "hello [big]\n  world foo";
+
+  ReflowedText const expected{
+    .lines = {
+      { { .text = "hello " },
+        { .text = "big", .style = { .highlight = true } } },
+      { { .text = "world foo" } } } };
+  REQUIRE( reflow_text_markup( r_info, text ) == expected );
+
+  clear_text_layout_cache();
+  ReflowedText const& cached1 =
+      reflow_text_markup_cached( e_font{}, r_info, text );
+  REQUIRE( cached1 == expected );
+  ReflowedText const& cached2 =
+      reflow_text_markup_cached( e_font{}, r_info, text );
+  // Served from the cache.
+  REQUIRE( &cached2 == &cached1 );
+
+  // Different reflow info is a different entry.
+  ReflowedText const& cached3 = reflow_text_markup_cached(
+      e_font{}, TextReflowInfo{ .max_cols = 100 }, text );
+  REQUIRE( cached3.lines.size() == 1 );
+  clear_text_layout_cache();
+}
+
+TEST_CASE( "[text] rendered_text_size (reflowed)" ) {
+  rr::MockTextometer textometer;
+  rr::TextLayout const text_layout;
+  ReflowedText const reflowed{
+    .lines = { { { .text = "ab" }, { .text = "c" } },
+               { { .text = "def" } } } };
+
+  textometer.EXPECT__font_height().returns( 8 );
+  textometer.EXPECT__spacing_between_chars( text_layout )
+      .by_default()
+      .returns( 1 );
+  textometer.EXPECT__spacing_between_lines( text_layout )
+      .returns( 2 );
+  textometer.EXPECT__dimensions_for_line( text_layout, "ab" )
+      .returns( size{ .w = 10, .h = 8 } );
+  textometer.EXPECT__dimensions_for_line( text_layout, "c" )
+      .returns( size{ .w = 5, .h = 8 } );
+  textometer.EXPECT__dimensions_for_line( text_layout, "def" )
+      .returns( size{ .w = 12, .h = 8 } );
+
+  size const expected{ .w = 16, .h = 18 };
+  REQUIRE( rendered_text_size( textometer, text_layout, reflowed )
+               .to_gfx() == expected );
+}
+
 } // namespace
 } // namespace rn
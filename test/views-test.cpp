@@ -0,0 +1,180 @@
+/****************************************************************
+**views-test.cpp
+*
+* Project: Revolution Now
+*
+* Created by David P. Sicilia on 2026-10-19.
+*
+* Description: Unit tests for the views module.
+*
+*****************************************************************/
+#include "test/testing.hpp"
+
+// Under test.
+#include "src/views.hpp"
+
+// Testing.
+#include "test/fake/renderer.hpp"
+
+// render
+#include "src/render/painter.hpp"
+#include "src/render/renderer.hpp"
+
+// Must be last.
+#include "test/catch-common.hpp" // IWYU pragma: keep
+
+namespace rn {
+namespace {
+
+using namespace std;
+
+using ::gfx::pixel;
+
+/****************************************************************
+** Fake Views
+*****************************************************************/
+// Draws a solid rect and records how many times it was drawn.
+struct CountingView : public ui::View {
+  CountingView( Delta size ) : size_( size ) {}
+
+  // Implement Object
+  void draw( rr::Renderer& renderer,
+             Coord coord ) const override {
+    ++draws;
+    renderer.painter().draw_solid_rect(
+        Rect::from( coord, size_ ), pixel::red() );
+  }
+
+  // Implement Object
+  Delta delta() const override { return size_; }
+
+  Delta size_;
+  mutable int draws = 0;
+};
+
+/****************************************************************
+** Test Cases
+*****************************************************************/
+TEST_CASE( "[views] RetainedView" ) {
+  rr::FakeRenderer fake;
+  rr::Renderer& renderer = fake.renderer();
+
+  auto owned_child =
+      make_unique<CountingView>( Delta{ .w = 10, .h = 20 } );
+  CountingView& child = *owned_child;
+  ui::RetainedView view( std::move( owned_child ) );
+  Coord const coord{ .x = 3, .y = 4 };
+
+  vector<rr::GenericVertex> first;
+  vector<rr::GenericVertex> vertices;
+
+  auto const draw = [&] {
+    renderer.capture( [&] { view.draw( renderer, coord ); },
+                      vertices );
+  };
+
+  REQUIRE_FALSE( view.is_retained() );
+  renderer.capture( [&] { view.draw( renderer, coord ); },
+                    first );
+  REQUIRE( child.draws == 1 );
+  REQUIRE( view.is_retained() );
+  REQUIRE( first.size() == 6 );
+
+  SECTION( "unchanged" ) {
+    draw();
+    draw();
+    REQUIRE( child.draws == 1 );
+    REQUIRE( view.is_retained() );
+    REQUIRE( vertices == first );
+  }
+
+  SECTION( "children updated" ) {
+    view.children_updated();
+    REQUIRE_FALSE( view.is_retained() );
+    draw();
+    REQUIRE( child.draws == 2 );
+    REQUIRE( view.is_retained() );
+    draw();
+    REQUIRE( child.draws == 2 );
+  }
+
+  SECTION( "child resized" ) {
+    child.size_ = Delta{ .w = 11, .h = 20 };
+    draw();
+    REQUIRE( child.draws == 2 );
+    REQUIRE( vertices != first );
+    draw();
+    REQUIRE( child.draws == 2 );
+  }
+
+  SECTION( "moved" ) {
+    renderer.capture(
+        [&] {
+          view.draw( renderer, coord + Delta{ .w = 1 } );
+        },
+        vertices );
+    REQUIRE( child.draws == 2 );
+    REQUIRE( vertices != first );
+  }
+
+  SECTION( "renderer mods changed" ) {
+    {
+      SCOPED_RENDERER_MOD_MUL( painter_mods.alpha, .5 );
+      draw();
+    }
+    REQUIRE( child.draws == 2 );
+    draw();
+    REQUIRE( child.draws == 3 );
+    REQUIRE( vertices == first );
+  }
+
+  SECTION( "mouse enter" ) {
+    view.on_mouse_enter( coord );
+    REQUIRE_FALSE( view.is_retained() );
+    draw();
+    REQUIRE( child.draws == 2 );
+  }
+
+  SECTION( "invalidated" ) {
+    view.invalidate();
+    REQUIRE_FALSE( view.is_retained() );
+    draw();
+    REQUIRE( child.draws == 2 );
+    REQUIRE( vertices == first );
+  }
+}
+
+TEST_CASE( "[views] RetainedDrawing" ) {
+  rr::FakeRenderer fake;
+  rr::Renderer& renderer = fake.renderer();
+
+  ui::RetainedDrawing retained;
+  Coord const coord{ .x = 1, .y = 2 };
+  Delta const size{ .w = 5, .h = 6 };
+  int draws = 0;
+
+  auto const draw = [&] {
+    retained.draw( renderer, coord, size, [&] {
+      ++draws;
+      renderer.painter().draw_solid_rect(
+          Rect::from( coord, size ), pixel::red() );
+    } );
+  };
+
+  REQUIRE_FALSE( retained.is_retained() );
+  draw();
+  REQUIRE( draws == 1 );
+  REQUIRE( retained.is_retained() );
+  draw();
+  REQUIRE( draws == 1 );
+
+  retained.invalidate();
+  REQUIRE_FALSE( retained.is_retained() );
+  draw();
+  REQUIRE( draws == 2 );
+  draw();
+  REQUIRE( draws == 2 );
+}
+
+} // namespace
+} // namespace rn